@@ -0,0 +1,66 @@
+#!/bin/bash
+#*******************************************************************************
+# Copyright 2020 FUJITSU LIMITED
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *******************************************************************************/
+
+# Runs the benchdnn CI batches with every SVE vector length. With user mode
+# emulation the vector length of the process is the largest one enabled with
+# the sve<bits>=on properties.
+#
+# Below 512 bits only the kernels which take the vector length at generation
+# time are available: the f32 forward convolution on the nxc activations, the
+# f32 eltwise and the eltwise post-ops for the algorithms the injector
+# generates natively, the reorders, the inner products and the matmul. The
+# remaining cases of these batches run the reference code there. Pooling has
+# no such kernel and is tested with 512 bits only.
+
+QEMU=/local_qemu_5.0.0/bin/qemu-aarch64
+cd /github/workspace/build/tests/benchdnn
+
+BATCHES="--conv --batch=inputs/conv/test_conv_ci
+--eltwise --batch=inputs/eltwise/test_eltwise_ci
+--reorder --batch=inputs/reorder/test_reorder_ci
+--ip --batch=inputs/ip/test_ip_ci
+--matmul --batch=inputs/matmul/test_matmul_ci"
+
+BATCHES_512="--pool --batch=inputs/pool/test_pool_ci"
+
+rm -f check.log
+run_batches() {
+    local vl=$1
+    while read -r batch; do
+        echo "sve${vl}: ${batch}"
+        ${QEMU} -cpu max,sve${vl}=on ./benchdnn ${batch} | tail -n 1 >> check.log
+    done <<< "$2"
+}
+
+for vl in 128 256 512; do
+    run_batches ${vl} "${BATCHES}"
+done
+run_batches 512 "${BATCHES_512}"
+
+NUM_TP=`wc -l check.log | cut -f 1 -d " "`
+NUM_OK=`grep "failed:0 " check.log | wc -l | cut -f 1 -d " "`
+
+echo "TP NUM: ${NUM_TP}"
+echo "TP OK : ${NUM_OK}"
+
+if [ ${NUM_TP} = ${NUM_OK} ] ; then
+    echo "Congratulation!"
+    exit 0
+else
+    echo "Something wrong!"
+    exit 1
+fi
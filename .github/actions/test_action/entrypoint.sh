@@ -58,3 +58,10 @@ echo "# Test oneDNN"
 echo "# Wait for a few minutes"
 echo "##################################################"
 .github/automation/test.sh --test-kind gtest --build-dir $(pwd)/build --report-dir $(pwd)/report
+
+# Test all the SVE vector lengths
+echo "##################################################"
+echo "# Test oneDNN with SVE vector lengths 128/256/512"
+echo "# Wait for a few minutes"
+echo "##################################################"
+.github/actions/test_action/benchdnn_vl.sh
@@ -254,6 +254,27 @@ dnnl_status_t DNNL_API dnnl_primitive_create(dnnl_primitive_t *primitive,
 dnnl_status_t DNNL_API dnnl_primitive_execute(const_dnnl_primitive_t primitive,
         dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
 
+/// Executes a sequence of primitives one after another.
+///
+/// The result is the same as the result of calling dnnl_primitive_execute()
+/// for each primitive in order. On CPU engines with the OpenMP runtime, the
+/// whole sequence runs in a single parallel region and the primitives are
+/// separated by lightweight barriers instead of forking and joining a
+/// parallel region per primitive, which pays off for sequences of small
+/// primitives.
+///
+/// @param stream Stream to use.
+/// @param count Number of primitives.
+/// @param primitives Array of @p count primitives to execute.
+/// @param nargs Array of @p count numbers of arguments, one per primitive.
+/// @param args Array of @p count arrays of arguments, one per primitive.
+///     See dnnl_primitive_execute() for the requirements on the arguments.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. The execution stops at the first primitive that fails.
+dnnl_status_t DNNL_API dnnl_primitive_execute_sequence(dnnl_stream_t stream,
+        int count, const const_dnnl_primitive_t *primitives, const int *nargs,
+        const dnnl_exec_arg_t *const *args);
+
 /// Retrieves a constant reference to the primitive descriptor of a given
 /// primitive.
 ///
@@ -1153,6 +1174,58 @@ dnnl_status_t DNNL_API dnnl_memory_set_ocl_mem_object(
         dnnl_memory_t memory, cl_mem mem_object);
 #endif
 
+/// Returns the size of a blob holding a memory object.
+///
+/// A blob stores the memory descriptor of a memory object followed by its
+/// data, including the padding area and the additional buffers such as the
+/// compensations of int8 weights. The data starts at a page boundary of the
+/// blob, so a blob written to a file can be memory-mapped and used as the
+/// buffer of a memory object without copying, see
+/// dnnl_memory_create_from_blob().
+///
+/// @param memory Memory object.
+/// @param size Output size of the blob in bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_get_blob_size(
+        const_dnnl_memory_t memory, size_t *size);
+
+/// Writes a memory object to a blob.
+///
+/// @param memory Memory object. Its engine must be a CPU engine.
+/// @param blob Blob to write to.
+/// @param size Size of the blob in bytes. It must be at least the size
+///     returned by dnnl_memory_get_blob_size().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_write_blob(
+        const_dnnl_memory_t memory, void *blob, size_t size);
+
+/// Creates a memory object over the data of a blob written by
+/// dnnl_memory_write_blob().
+///
+/// The memory object uses the data of the blob as its buffer, the data is
+/// neither copied nor written to, so the blob may be a read-only shared
+/// mapping of a file. The blob must stay valid for the lifetime of the memory
+/// object.
+///
+/// @note
+///     Blobs are only valid for the same version of the library. Blocked
+///     layouts of weights depend on the instruction set of the system, so the
+///     memory descriptor of the memory object should be compared to the one
+///     expected by the primitive before using it.
+///
+/// @param memory Output memory object.
+/// @param engine Engine to use. It must be a CPU engine.
+/// @param blob Blob. It must be aligned to 64 bytes, which pointers returned
+///     by mmap() are.
+/// @param size Size of the blob in bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. #dnnl_invalid_arguments is returned if the blob is not a
+///     valid blob of this version of the library or is misaligned.
+dnnl_status_t DNNL_API dnnl_memory_create_from_blob(dnnl_memory_t *memory,
+        dnnl_engine_t engine, const void *blob, size_t size);
+
 /// Destroys a memory object.
 ///
 /// @param memory Memory object to destroy.
@@ -3273,8 +3346,157 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Enables or disables collection of the primitive cache statistics. It is
+/// disabled by default, so that lookups are neither counted nor timed.
+///
+/// @note
+///     This setting overrides the DNNL_PRIMITIVE_CACHE_STATS environment
+///     variable.
+///
+/// @param enable Flag value. Set to 0 to disable and to 1 to enable.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_stats(int enable);
+
+/// Returns the primitive cache statistics.
+///
+/// The statistics help to choose the primitive cache capacity: a high number
+/// of evictions together with misses indicates that the working set of
+/// primitives does not fit into the cache.
+///
+/// @param stats Primitive cache statistics to query. All counters are zero
+/// when the primitive cache is disabled at build time.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_primitive_cache_stats_t *stats);
+
+/// Resets the primitive cache statistics to zero. The content of the cache
+/// is not affected.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_primitive_cache_stats(void);
+
+/// Returns the capacity of the reorder cache in megabytes.
+///
+/// @param capacity Reorder cache capacity to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_reorder_cache_capacity(int *capacity);
+
+/// Sets the capacity of the reorder cache in megabytes.
+///
+/// The reorder cache keeps the results of reorders on CPU engines, so that a
+/// reorder executed again with the same source memory object, the same data
+/// in it and an identical primitive, such as the reorders of the same weights
+/// for the forward and backward convolutions, copies the cached result
+/// instead of reordering, or does nothing if the destination still holds it.
+/// Reorders with runtime scales or zero points are not cached. Entries are
+/// evicted in the least recently used order once their total size exceeds
+/// the capacity.
+///
+/// The library knows that the data of a memory object may have changed when
+/// a primitive writes to it, when it is unmapped, or when its handle is set.
+/// Hence, a change of the data of a source or destination memory object made
+/// outside of the library must be followed by a call to
+/// dnnl_memory_set_data_handle() with the same handle, otherwise the reorder
+/// may produce stale data.
+///
+/// @param capacity Reorder cache capacity to set. Setting the @p capacity to
+///     0 clears the reorder cache and disables it, which is the default
+///     unless the DNNL_REORDER_CACHE_CAPACITY environment variable is set.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_reorder_cache_capacity(int capacity);
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_profiling
+/// @{
+
+/// Starts recording primitive executions. Every call to
+/// dnnl_primitive_execute() then waits for the stream and stores a
+/// #dnnl_profiling_record_t in a buffer of the calling thread. Records that
+/// do not fit into the buffer are dropped until it is drained.
+///
+/// @sa @ref dev_guide_profilers
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_profiling_start(void);
+
+/// Stops recording primitive executions. Collected records are kept until
+/// they are drained.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_profiling_stop(void);
+
+/// Moves collected records to a user buffer. Records that do not fit into
+/// the buffer are kept for the next call.
+///
+/// @param records Output buffer for at least @p capacity records. May be
+///     NULL if @p capacity is 0.
+/// @param capacity Number of records the buffer can hold.
+/// @param count Output number of records written to the buffer.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p count is NULL or @p records is NULL while @p capacity is not 0, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_profiling_drain(
+        dnnl_profiling_record_t *records, size_t capacity, size_t *count);
+
+/// Writes records to a file in the Chrome trace event format, which can be
+/// opened with chrome://tracing or Perfetto.
+///
+/// @param records Records to write.
+/// @param count Number of records.
+/// @param file_name Name of the output file.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     arguments are invalid or the file cannot be written, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_profiling_write_chrome_trace(
+        const dnnl_profiling_record_t *records, size_t count,
+        const char *file_name);
+
+/// Enables or disables hardware performance counters for primitive
+/// executions. While they are enabled, every call to dnnl_primitive_execute()
+/// waits for the stream and adds the counts of the submitting thread and of
+/// the threads of the library parallel regions to the statistics of the
+/// implementation. Verbose output then also contains the counters of each
+/// execution.
+///
+/// @note
+///     This setting overrides the DNNL_PERF_COUNTERS environment variable.
+///     The counters are read with the Linux perf_event interface, the
+///     system may restrict it (see /proc/sys/kernel/perf_event_paranoid).
+///     Counts of primitives executed concurrently from several threads are
+///     not separated from each other.
+///
+/// @param enable Set to 0 to disable and to 1 to enable.
+/// @returns #dnnl_success/#dnnl::status::success on success and
+///     #dnnl_unimplemented/#dnnl::status::unimplemented if the counters are
+///     not supported on the system.
+dnnl_status_t DNNL_API dnnl_set_perf_counters(int enable);
+
+/// Returns the performance counters collected since the last reset.
+///
+/// @param impl_name Implementation name as returned by the
+///     #dnnl_query_impl_info_str query. Pass NULL to get the sum over all
+///     implementations.
+/// @param counters Output counters.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p counters is NULL, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_perf_counters(
+        const char *impl_name, dnnl_perf_counters_t *counters);
+
+/// Resets the performance counter statistics of all implementations.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_perf_counters(void);
+
+/// @} dnnl_api_profiling
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -3304,6 +3526,36 @@ dnnl_status_t DNNL_API dnnl_set_verbose(int level);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_jit_dump(int enable);
 
+/// Configures whether JIT generators emit native instructions where available
+/// rather than the instructions translated from the x64 implementation. Only
+/// applicable to AArch64.
+///
+/// @note
+///     This setting overrides the DNNL_JIT_NATIVE environment variable.
+///
+/// @param enable Flag value. Set to 0 to use translated code and to 1 to use
+///     native code.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_jit_native(int enable);
+
+/// Queries whether JIT generators emit native instructions where available.
+///
+/// @param enable Output flag value: 1 if native code is used and 0
+///     otherwise.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p enable is NULL, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_jit_native(int *enable);
+
+/// Returns the total size of the code generated by JIT kernels since the
+/// library was loaded. Each kernel is accounted once, when its code is
+/// finalized.
+///
+/// @param size Output size in bytes.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p size is NULL, and #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_jit_code_size(size_t *size);
+
 /// Returns library version information.
 /// @returns Pointer to a constant structure containing
 ///  - major: major version number,
@@ -3405,6 +3657,20 @@ dnnl_status_t DNNL_API dnnl_set_max_cpu_isa(dnnl_cpu_isa_t isa);
 ///     dispatch to.
 dnnl_cpu_isa_t DNNL_API dnnl_get_effective_cpu_isa(void);
 
+/// Returns the statistics of the CPU scratchpad arena.
+///
+/// Scratchpads of CPU primitives, including the global one, are taken from
+/// an arena that keeps released buffers for reuse. Kept buffers above the
+/// limit set by the DNNL_SCRATCHPAD_ARENA_IDLE_LIMIT_MB environment variable
+/// (1024 by default) are returned to the system.
+///
+/// @param stats Output statistics.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p stats is NULL, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_scratchpad_arena_stats(
+        dnnl_scratchpad_arena_stats_t *stats);
+
 /// @} dnnl_api_service
 
 /// @addtogroup dnnl_api_blas
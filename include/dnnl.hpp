@@ -358,6 +358,21 @@ struct primitive : public handle<dnnl_primitive_t> {
             const std::unordered_map<int, memory> &args) const;
 };
 
+/// Executes a sequence of primitives one after another in a specified stream.
+///
+/// The result is the same as the result of calling primitive::execute() for
+/// each primitive in order, but on CPU engines with the OpenMP runtime the
+/// sequence runs in a single parallel region. See
+/// dnnl_primitive_execute_sequence().
+///
+/// @param astream Stream object. The stream must belong to the same engine
+///     as the primitives.
+/// @param primitives Primitives to execute.
+/// @param args Arguments maps, one per primitive.
+inline void execute_sequence(const stream &astream,
+        const std::vector<primitive> &primitives,
+        const std::vector<std::unordered_map<int, memory>> &args);
+
 /// Converts primitive kind enum value from C++ API to C API type.
 ///
 /// @param akind C++ API primitive kind enum value.
@@ -2048,6 +2063,24 @@ struct memory : public handle<dnnl_memory_t> {
     memory(const desc &md, const engine &aengine)
         : memory(md, aengine, DNNL_MEMORY_ALLOCATE) {}
 
+    /// Constructs a memory object over the data of a blob written by
+    /// memory::write_blob() without copying it.
+    ///
+    /// The blob may be a read-only shared mapping of a file and must stay
+    /// valid for the lifetime of the memory object. See
+    /// dnnl_memory_create_from_blob() for the requirements on the blob.
+    ///
+    /// @param aengine Engine to use. It must be a CPU engine.
+    /// @param blob Blob aligned to 64 bytes.
+    /// @param size Size of the blob in bytes.
+    memory(const engine &aengine, const void *blob, size_t size) {
+        dnnl_memory_t result;
+        error::wrap_c_api(dnnl_memory_create_from_blob(
+                                  &result, aengine.get(), blob, size),
+                "could not create a memory object from a blob");
+        reset(result);
+    }
+
     /// Returns the associated memory descriptor.
     desc get_desc() const {
         const dnnl_memory_desc_t *cdesc;
@@ -2168,6 +2201,31 @@ struct memory : public handle<dnnl_memory_t> {
                 "could not unmap memory object data");
     }
 
+    /// Returns the size of a blob holding the memory object.
+    ///
+    /// @sa dnnl_memory_get_blob_size()
+    ///
+    /// @returns The size of the blob in bytes.
+    size_t get_blob_size() const {
+        size_t size;
+        error::wrap_c_api(dnnl_memory_get_blob_size(get(), &size),
+                "could not get the size of a blob of a memory object");
+        return size;
+    }
+
+    /// Writes the memory descriptor and the data of the memory object to a
+    /// blob that can be used to construct memory objects later.
+    ///
+    /// @sa dnnl_memory_write_blob()
+    ///
+    /// @param blob Blob to write to.
+    /// @param size Size of the blob in bytes. It must be at least
+    ///     memory::get_blob_size().
+    void write_blob(void *blob, size_t size) const {
+        error::wrap_c_api(dnnl_memory_write_blob(get(), blob, size),
+                "could not write a memory object to a blob");
+    }
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     /// Returns the OpenCL memory object associated with the memory.
     cl_mem get_ocl_mem_object() const {
@@ -9907,6 +9965,33 @@ inline status set_jit_dump(int enable) {
     return static_cast<status>(dnnl_set_jit_dump(enable));
 }
 
+/// @copydoc dnnl_set_jit_native()
+inline status set_jit_native(int enable) {
+    return static_cast<status>(dnnl_set_jit_native(enable));
+}
+
+/// Queries whether JIT generators emit native instructions where available.
+///
+/// @returns 1 if native code is used and 0 otherwise.
+inline int get_jit_native() {
+    int enable = 0;
+    error::wrap_c_api(
+            dnnl_get_jit_native(&enable), "could not get jit native flag");
+    return enable;
+}
+
+/// Returns the total size of the code generated by JIT kernels.
+///
+/// @sa dnnl_get_jit_code_size()
+///
+/// @returns The size in bytes.
+inline size_t get_jit_code_size() {
+    size_t size = 0;
+    error::wrap_c_api(
+            dnnl_get_jit_code_size(&size), "could not get jit code size");
+    return size;
+}
+
 /// @copydoc dnnl_set_jit_profiling_flags()
 inline status set_jit_profiling_flags(unsigned flags) {
     return static_cast<status>(dnnl_set_jit_profiling_flags(flags));
@@ -9952,6 +10037,18 @@ inline cpu_isa get_effective_cpu_isa() {
     return static_cast<cpu_isa>(dnnl_get_effective_cpu_isa());
 }
 
+/// Scratchpad arena statistics. See @ref dnnl_scratchpad_arena_stats_t.
+using scratchpad_arena_stats_t = dnnl_scratchpad_arena_stats_t;
+
+/// Returns the statistics of the CPU scratchpad arena.
+/// @sa dnnl_get_scratchpad_arena_stats
+inline scratchpad_arena_stats_t get_scratchpad_arena_stats() {
+    scratchpad_arena_stats_t result;
+    error::wrap_c_api(dnnl_get_scratchpad_arena_stats(&result),
+            "could not get scratchpad arena stats");
+    return result;
+}
+
 /// @} dnnl_api_service
 
 /// @addtogroup dnnl_api_primitive_cache Primitive Cache
@@ -9975,8 +10072,121 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Primitive cache statistics. See @ref dnnl_primitive_cache_stats_t.
+using primitive_cache_stats_t = dnnl_primitive_cache_stats_t;
+
+/// @copydoc dnnl_set_primitive_cache_stats()
+inline void set_primitive_cache_stats(int enable) {
+    error::wrap_c_api(dnnl_set_primitive_cache_stats(enable),
+            "could not set primitive cache stats");
+}
+
+/// Returns the primitive cache statistics.
+/// @sa dnnl_get_primitive_cache_stats
+inline primitive_cache_stats_t get_primitive_cache_stats() {
+    primitive_cache_stats_t result;
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(&result),
+            "could not get primitive cache stats");
+    return result;
+}
+
+/// @copydoc dnnl_reset_primitive_cache_stats()
+inline void reset_primitive_cache_stats() {
+    error::wrap_c_api(dnnl_reset_primitive_cache_stats(),
+            "could not reset primitive cache stats");
+}
+
+/// Returns the capacity of the reorder cache in megabytes.
+/// @sa dnnl_get_reorder_cache_capacity
+inline int get_reorder_cache_capacity() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_reorder_cache_capacity(&result),
+            "could not get reorder cache capacity");
+    return result;
+}
+
+/// @copydoc dnnl_set_reorder_cache_capacity(int capacity)
+inline void set_reorder_cache_capacity(int capacity) {
+    error::wrap_c_api(dnnl_set_reorder_cache_capacity(capacity),
+            "could not set reorder cache capacity");
+}
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_profiling Profiling
+///
+/// A set of functions that record primitive executions in-process.
+///
+/// @{
+
+/// Record of a primitive execution. See @ref dnnl_profiling_record_t.
+using profiling_record_t = dnnl_profiling_record_t;
+
+/// @copydoc dnnl_profiling_start()
+inline void profiling_start() {
+    error::wrap_c_api(dnnl_profiling_start(), "could not start profiling");
+}
+
+/// @copydoc dnnl_profiling_stop()
+inline void profiling_stop() {
+    error::wrap_c_api(dnnl_profiling_stop(), "could not stop profiling");
+}
+
+/// Returns all collected records and removes them from the profiler.
+/// @sa dnnl_profiling_drain
+inline std::vector<profiling_record_t> profiling_drain() {
+    std::vector<profiling_record_t> result;
+    const size_t chunk = 1024;
+    size_t count = 0;
+    do {
+        const size_t size = result.size();
+        result.resize(size + chunk);
+        error::wrap_c_api(
+                dnnl_profiling_drain(result.data() + size, chunk, &count),
+                "could not drain profiling records");
+        result.resize(size + count);
+    } while (count == chunk);
+    return result;
+}
+
+/// Writes records to a file in the Chrome trace event format.
+/// @sa dnnl_profiling_write_chrome_trace
+inline void profiling_write_chrome_trace(
+        const std::vector<profiling_record_t> &records,
+        const std::string &file_name) {
+    error::wrap_c_api(dnnl_profiling_write_chrome_trace(records.data(),
+                              records.size(), file_name.c_str()),
+            "could not write chrome trace");
+}
+
+/// Performance counters. See @ref dnnl_perf_counters_t.
+using perf_counters_t = dnnl_perf_counters_t;
+
+/// @copydoc dnnl_set_perf_counters()
+inline status set_perf_counters(int enable) {
+    return static_cast<status>(dnnl_set_perf_counters(enable));
+}
+
+/// Returns the performance counters of an implementation, or the sum over
+/// all implementations if @p impl_name is empty.
+/// @sa dnnl_get_perf_counters
+inline perf_counters_t get_perf_counters(const std::string &impl_name = "") {
+    perf_counters_t result;
+    error::wrap_c_api(
+            dnnl_get_perf_counters(
+                    impl_name.empty() ? nullptr : impl_name.c_str(), &result),
+            "could not get performance counters");
+    return result;
+}
+
+/// @copydoc dnnl_reset_perf_counters()
+inline void reset_perf_counters() {
+    error::wrap_c_api(dnnl_reset_perf_counters(),
+            "could not reset performance counters");
+}
+
+/// @} dnnl_api_profiling
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -10066,6 +10276,33 @@ inline void primitive::execute(const stream &astream,
             "could not execute a primitive");
 }
 
+inline void execute_sequence(const stream &astream,
+        const std::vector<primitive> &primitives,
+        const std::vector<std::unordered_map<int, memory>> &args) {
+    if (primitives.size() != args.size())
+        DNNL_THROW_ERROR(dnnl_invalid_arguments,
+                "numbers of primitives and arguments maps differ");
+
+    const size_t count = primitives.size();
+    std::vector<const_dnnl_primitive_t> c_primitives(count);
+    std::vector<std::vector<dnnl_exec_arg_t>> c_args(count);
+    std::vector<int> c_nargs(count);
+    std::vector<const dnnl_exec_arg_t *> c_args_ptrs(count);
+    for (size_t i = 0; i < count; i++) {
+        c_primitives[i] = primitives[i].get();
+        c_args[i].reserve(args[i].size());
+        for (const auto &a : args[i])
+            c_args[i].push_back({a.first, a.second.get(true)});
+        c_nargs[i] = (int)c_args[i].size();
+        c_args_ptrs[i] = c_args[i].data();
+    }
+
+    error::wrap_c_api(dnnl_primitive_execute_sequence(astream.get(),
+                              (int)count, c_primitives.data(), c_nargs.data(),
+                              c_args_ptrs.data()),
+            "could not execute a sequence of primitives");
+}
+
 /// @endcond
 
 #undef DNNL_DEFINE_BITMASK_OPS
@@ -2210,6 +2210,9 @@ typedef const struct dnnl_stream_attr *const_dnnl_stream_attr_t;
 /// Threadpool runtime (CPU only)
 #define DNNL_RUNTIME_THREADPOOL 8u
 
+/// Built-in threadpool runtime (CPU only)
+#define DNNL_RUNTIME_NATIVE 16u
+
 /// OpenCL runtime
 #define DNNL_RUNTIME_OCL 256u
 
@@ -2295,8 +2298,75 @@ typedef enum {
 
 } dnnl_cpu_isa_t;
 
+/// Statistics of the CPU scratchpad arena, which keeps scratchpad buffers for
+/// reuse by primitives. The sizes are in bytes and include the rounding of
+/// the requests to size classes.
+typedef struct {
+    uint64_t in_use_bytes; ///< Buffers currently used by scratchpads
+    uint64_t idle_bytes; ///< Buffers kept for reuse
+    uint64_t peak_bytes; ///< Maximum of in_use_bytes + idle_bytes
+    uint64_t hits; ///< Number of requests served with a kept buffer
+    uint64_t misses; ///< Number of requests that allocated a new buffer
+} dnnl_scratchpad_arena_stats_t;
+
 /// @} dnnl_api_service
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Primitive cache statistics. The counters accumulate while the collection is
+/// enabled with dnnl_set_primitive_cache_stats(), until the next call to
+/// dnnl_reset_primitive_cache_stats().
+typedef struct {
+    uint64_t hits; ///< Number of lookups that found the requested primitive
+    uint64_t misses; ///< Number of lookups that had to create a primitive
+    uint64_t evictions; ///< Number of entries evicted from the cache
+    uint64_t lookup_time_ns; ///< Total time spent in cache lookups
+    uint64_t lock_wait_time_ns; ///< Part of lookup time spent waiting on locks
+} dnnl_primitive_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
+/// @addtogroup dnnl_api_profiling
+/// @{
+
+/// A primitive execution recorded by the profiler. The strings are owned by
+/// the library and stay valid until it is unloaded.
+typedef struct {
+    /// Kind of the executed primitive.
+    dnnl_primitive_kind_t kind;
+    /// Name of the implementation, for example `jit:avx2`.
+    const char *impl_name;
+    /// Primitive description in the verbose format, including the shapes.
+    /// Empty when verbose mode is disabled at build time.
+    const char *info;
+    /// Monotonic time stamp of the execution start, in nanoseconds.
+    uint64_t start_ns;
+    /// Monotonic time stamp of the execution end, in nanoseconds.
+    uint64_t end_ns;
+    /// Number of threads that executed the primitive.
+    int nthr;
+    /// Index of the thread that submitted the primitive.
+    int tid;
+} dnnl_profiling_record_t;
+
+/// Hardware performance counters of primitive executions, aggregated per
+/// implementation name. A counter that is not supported by the CPU or not
+/// permitted by the system is zero.
+typedef struct {
+    uint64_t executions; ///< Number of executions
+    uint64_t time_ns; ///< Total execution time
+    uint64_t cycles; ///< CPU cycles
+    uint64_t instructions; ///< Retired instructions
+    uint64_t l1d_misses; ///< L1 data cache read misses
+    /// L2 data cache refills on AArch64, last level cache read misses on
+    /// other CPUs
+    uint64_t l2_misses;
+    uint64_t sve_instructions; ///< Retired SVE instructions (AArch64 only)
+} dnnl_perf_counters_t;
+
+/// @} dnnl_api_profiling
+
 /// @} dnnl_api
 
 #ifdef __cplusplus
@@ -614,6 +614,7 @@ enum runtime_kind_t {
     dnnl_runtime_omp,
     dnnl_runtime_tbb,
     dnnl_runtime_threadpool,
+    dnnl_runtime_native,
     dnnl_runtime_ocl,
 };
 
@@ -623,6 +624,7 @@ const runtime_kind_t seq = dnnl_runtime_seq;
 const runtime_kind_t omp = dnnl_runtime_omp;
 const runtime_kind_t tbb = dnnl_runtime_tbb;
 const runtime_kind_t threadpool = dnnl_runtime_threadpool;
+const runtime_kind_t native = dnnl_runtime_native;
 const runtime_kind_t ocl = dnnl_runtime_ocl;
 } // namespace runtime_kind
 
@@ -825,6 +827,11 @@ const stream_flags_t default_flags = dnnl_stream_default_flags;
 using stream_t = dnnl_stream;
 using stream_attr_t = dnnl_stream_attr;
 
+using primitive_cache_stats_t = dnnl_primitive_cache_stats_t;
+using profiling_record_t = dnnl_profiling_record_t;
+using perf_counters_t = dnnl_perf_counters_t;
+using scratchpad_arena_stats_t = dnnl_scratchpad_arena_stats_t;
+
 /* forward declaration of the internal primitive_desc types */
 struct batch_normalization_bwd_pd_t;
 struct batch_normalization_fwd_pd_t;
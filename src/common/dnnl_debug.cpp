@@ -42,6 +42,7 @@ const char *dnnl_runtime2str(unsigned runtime) {
         case DNNL_RUNTIME_TBB: return "TBB";
         case DNNL_RUNTIME_OCL: return "OpenCL";
         case DNNL_RUNTIME_THREADPOOL: return "threadpool";
+        case DNNL_RUNTIME_NATIVE: return "native";
         default: return "unknown";
     }
 }
@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_thread.hpp"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+
+namespace dnnl {
+namespace impl {
+namespace stream_partition {
+
+namespace {
+thread_local int partition_nthr = 0;
+} // namespace
+
+void set_num_threads(int nthr) {
+    partition_nthr = nthr;
+}
+
+int get_num_threads() {
+    return partition_nthr;
+}
+
+} // namespace stream_partition
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -34,15 +34,39 @@ inline void dnnl_thr_barrier() {}
 
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
 #include "omp.h"
+#include "persistent_region.hpp"
 #define DNNL_THR_SYNC 1
+namespace dnnl {
+namespace impl {
+namespace stream_partition {
+
+// A thread of an out-of-order CPU stream owns a part of the OpenMP threads
+// only, and parallel() never starts a larger team on it. The number is 0 on
+// other threads. The getter is exported, since the tests and benchdnn
+// instantiate parallel() as well.
+void set_num_threads(int nthr);
+int DNNL_API get_num_threads();
+
+} // namespace stream_partition
+} // namespace impl
+} // namespace dnnl
 inline int dnnl_get_max_threads() {
+    // The master of a persistent region hands its work to the team of the
+    // region only.
+    if (dnnl::impl::persistent_region::is_master())
+        return dnnl::impl::persistent_region::get_num_threads();
     return omp_get_max_threads();
 }
 inline int dnnl_in_parallel() {
-    return omp_in_parallel();
+    return omp_in_parallel() && !dnnl::impl::persistent_region::is_master();
 }
 inline void dnnl_thr_barrier() {
+    using namespace dnnl::impl;
+    if (persistent_region::in_item()) {
+        persistent_region::item_barrier();
+    } else if (!persistent_region::is_master()) {
 #pragma omp barrier
+    }
 }
 
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
@@ -107,6 +131,19 @@ inline int dnnl_in_parallel() {
 inline void dnnl_thr_barrier() {
     assert(!"no barrier with THREADPOOL");
 }
+
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_NATIVE
+#include "native_threadpool.hpp"
+#define DNNL_THR_SYNC 0
+inline int dnnl_get_max_threads() {
+    return dnnl::impl::native_threadpool::get_num_threads();
+}
+inline int dnnl_in_parallel() {
+    return dnnl::impl::native_threadpool::in_parallel();
+}
+inline void dnnl_thr_barrier() {
+    assert(!"no barrier with NATIVE");
+}
 #endif
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
@@ -191,6 +228,35 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
     balance211(ny, grp_nthr, grp_ithr, ny_start, ny_end);
 }
 
+// Same as balance211(), but the work is first split between n_nodes NUMA
+// nodes and then between the threads of each node, so that the slices of the
+// threads of a node are adjacent and the work of a node does not depend on
+// how many threads the other nodes have. Threads are assumed to be bound
+// compactly: the threads of node i are the i-th group of balance211(team,
+// n_nodes). Work and memory split with the same n_nodes stay node-local.
+template <typename T, typename U>
+inline void balance211_numa(
+        T n, U team, U tid, int n_nodes, T &n_start, T &n_end) {
+    if (n_nodes <= 1 || (int)team < n_nodes) {
+        balance211(n, team, tid, n_start, n_end);
+        return;
+    }
+
+    int node = 0;
+    U node_tid_start {0}, node_tid_end {0};
+    for (; node < n_nodes; node++) {
+        balance211(team, (U)n_nodes, (U)node, node_tid_start, node_tid_end);
+        if (tid < node_tid_end) break;
+    }
+
+    T node_start {0}, node_end {0};
+    balance211(n, n_nodes, node, node_start, node_end);
+    balance211(node_end - node_start, (U)(node_tid_end - node_tid_start),
+            (U)(tid - node_tid_start), n_start, n_end);
+    n_start += node_start;
+    n_end += node_start;
+}
+
 } // namespace impl
 } // namespace dnnl
 
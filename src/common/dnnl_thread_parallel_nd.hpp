@@ -38,6 +38,9 @@
  *                                         convenience)
  */
 
+#include "perf_counters.hpp"
+#include "profiler.hpp"
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "counting_barrier.hpp"
 #endif
@@ -49,7 +52,10 @@ namespace {
 inline int adjust_num_threads(int nthr, size_t work_amount) {
     if (nthr == 0) nthr = dnnl_get_max_threads();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-    return (work_amount == 1 || omp_in_parallel()) ? 1 : nthr;
+    return (work_amount == 1 || dnnl_in_parallel()) ? 1 : nthr;
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_NATIVE
+    if (dnnl_in_parallel()) return 1;
+    return (int)std::min((size_t)nthr, work_amount);
 #else
     return (int)std::min((size_t)nthr, work_amount);
 #endif
@@ -69,16 +75,36 @@ void parallel(int nthr, F f) {
         return;
     }
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    if (persistent_region::is_master()) {
+        nthr = nstl::min(nthr, persistent_region::get_num_threads());
+        profiler::note_nthr(nthr);
+        persistent_region::parallel_for(nthr, [&](int ithr, int nthr) {
+            perf_counters::thread_scope_t perf_scope;
+            f(ithr, nthr);
+        });
+        return;
+    }
+    // The team size of a primitive is chosen at creation, for all the
+    // threads, so on a thread of a stream it would oversubscribe the cores.
+    const int partition_nthr = stream_partition::get_num_threads();
+    if (partition_nthr > 0) nthr = nstl::min(nthr, partition_nthr);
 #pragma omp parallel num_threads(nthr)
     {
         int nthr_ = omp_get_num_threads();
         int ithr_ = omp_get_thread_num();
         assert(nthr_ == nthr);
+        if (ithr_ == 0) profiler::note_nthr(nthr_);
+        perf_counters::thread_scope_t perf_scope;
         f(ithr_, nthr_);
     }
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    profiler::note_nthr(nthr);
     tbb::parallel_for(
-            0, nthr, [&](int ithr) { f(ithr, nthr); },
+            0, nthr,
+            [&](int ithr) {
+                perf_counters::thread_scope_t perf_scope;
+                f(ithr, nthr);
+            },
             tbb::static_partitioner());
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
@@ -89,18 +115,28 @@ void parallel(int nthr, F f) {
             f(ithr, nthr);
         threadpool_utils::activate_threadpool(tp);
     } else {
+        profiler::note_nthr(nthr);
         bool async = tp->get_flags() & dnnl::threadpool_iface::ASYNCHRONOUS;
         counting_barrier_t b;
         if (async) b.init(nthr);
         tp->parallel_for(nthr, [tp, &f, &b, async](int ithr, int nthr) {
             bool is_master = threadpool_utils::get_active_threadpool() == tp;
             if (!is_master) threadpool_utils::activate_threadpool(tp);
-            f(ithr, nthr);
+            {
+                perf_counters::thread_scope_t perf_scope;
+                f(ithr, nthr);
+            }
             if (!is_master) threadpool_utils::deactivate_threadpool();
             if (async) b.notify();
         });
         if (async) b.wait();
     }
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_NATIVE
+    profiler::note_nthr(nthr);
+    native_threadpool::parallel_for(nthr, [&](int ithr, int nthr) {
+        perf_counters::thread_scope_t perf_scope;
+        f(ithr, nthr);
+    });
 #endif
 #endif
 }
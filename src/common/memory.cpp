@@ -17,6 +17,8 @@
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <atomic>
 
 #include "dnnl.h"
 
@@ -70,7 +72,7 @@ bool memory_desc_sanity_check(const memory_desc_t *md) {
 
 dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
         const dnnl::impl::memory_desc_t *md, unsigned flags, void *handle)
-    : engine_(engine), md_(*md) {
+    : engine_(engine), md_(*md), version_(next_version()) {
     const size_t size = memory_desc_wrapper(md_).size();
 
     memory_storage_t *memory_storage_ptr;
@@ -91,9 +93,16 @@ status_t dnnl_memory::set_data_handle(void *handle, stream_t *stream) {
     if (handle != old_handle) {
         CHECK(memory_storage()->set_data_handle(handle));
     }
+    // Setting the same handle again tells that the data has been changed.
+    bump_version();
     return zero_pad(stream);
 }
 
+uint64_t dnnl_memory::next_version() {
+    static std::atomic<uint64_t> version(0);
+    return ++version;
+}
+
 status_t dnnl_memory_desc_init_by_tag(memory_desc_t *memory_desc, int ndims,
         const dims_t dims, data_type_t data_type, format_tag_t tag) {
     if (any_null(memory_desc)) return invalid_arguments;
@@ -540,9 +549,126 @@ status_t dnnl_memory_unmap_data(const memory_t *memory, void *mapped_ptr) {
     bool args_ok = !any_null(memory);
     if (!args_ok) return invalid_arguments;
 
+    memory->bump_version();
     return memory->memory_storage()->unmap_data(mapped_ptr, nullptr);
 }
 
+namespace {
+// Layout of a blob: the header, then the data at a page boundary so that the
+// data of a memory-mapped blob is page-aligned.
+struct blob_header_t {
+    char magic[8];
+    uint32_t version[3];
+    uint32_t md_size;
+    uint64_t data_offset;
+    uint64_t data_size;
+    memory_desc_t md;
+};
+
+const char blob_magic[8] = {'D', 'N', 'N', 'L', 'B', 'L', 'O', 'B'};
+constexpr size_t blob_data_offset = 4096;
+static_assert(sizeof(blob_header_t) <= blob_data_offset,
+        "blob header does not fit into a page");
+constexpr size_t blob_alignment = 64;
+
+// The header comes from a file, so the blocking description is checked
+// before the memory descriptor wrapper indexes its arrays with it.
+bool blob_md_ok(const memory_desc_t &md) {
+    if (!memory_desc_sanity_check(&md)) return false;
+    if (md.format_kind != format_kind::blocked) return false;
+
+    const auto &blk = md.format_desc.blocking;
+    if (blk.inner_nblks < 0 || blk.inner_nblks > DNNL_MAX_NDIMS) return false;
+    for (int i = 0; i < blk.inner_nblks; i++)
+        if (blk.inner_blks[i] <= 0 || blk.inner_idxs[i] < 0
+                || blk.inner_idxs[i] >= md.ndims)
+            return false;
+    for (int d = 0; d < md.ndims; d++)
+        if (md.padded_dims[d] < md.dims[d] || md.padded_offsets[d] < 0
+                || md.padded_offsets[d] + md.dims[d] > md.padded_dims[d])
+            return false;
+    return true;
+}
+} // namespace
+
+status_t dnnl_memory_get_blob_size(const memory_t *memory, size_t *size) {
+    if (any_null(memory, size)) return invalid_arguments;
+    *size = blob_data_offset + memory_desc_wrapper(memory->md()).size();
+    return success;
+}
+
+status_t dnnl_memory_write_blob(
+        const memory_t *memory, void *blob, size_t size) {
+    if (any_null(memory, blob)) return invalid_arguments;
+    if (memory->engine()->kind() != engine_kind::cpu) return unimplemented;
+
+    const size_t data_size = memory_desc_wrapper(memory->md()).size();
+    if (size < blob_data_offset + data_size) return invalid_arguments;
+
+    blob_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, blob_magic, sizeof(blob_magic));
+    header.version[0] = DNNL_VERSION_MAJOR;
+    header.version[1] = DNNL_VERSION_MINOR;
+    header.version[2] = DNNL_VERSION_PATCH;
+    header.md_size = sizeof(memory_desc_t);
+    header.data_offset = blob_data_offset;
+    header.data_size = data_size;
+    header.md = *memory->md();
+
+    char *ptr = static_cast<char *>(blob);
+    memset(ptr, 0, blob_data_offset);
+    memcpy(ptr, &header, sizeof(header));
+    if (data_size == 0) return success;
+
+    void *data = nullptr;
+    CHECK(memory->get_data_handle(&data));
+    if (data == nullptr) return invalid_arguments;
+    memcpy(ptr + blob_data_offset, data, data_size);
+    return success;
+}
+
+status_t dnnl_memory_create_from_blob(memory_t **memory, engine_t *engine,
+        const void *blob, size_t size) {
+    if (any_null(memory, engine, blob)) return invalid_arguments;
+    if (engine->kind() != engine_kind::cpu) return unimplemented;
+    if (size < blob_data_offset
+            || reinterpret_cast<uintptr_t>(blob) % blob_alignment != 0)
+        return invalid_arguments;
+
+    blob_header_t header;
+    memcpy(&header, blob, sizeof(header));
+    const bool header_ok
+            = memcmp(header.magic, blob_magic, sizeof(blob_magic)) == 0
+            && header.version[0] == DNNL_VERSION_MAJOR
+            && header.version[1] == DNNL_VERSION_MINOR
+            && header.version[2] == DNNL_VERSION_PATCH
+            && header.md_size == sizeof(memory_desc_t)
+            && header.data_offset == blob_data_offset
+            && header.data_size <= size - blob_data_offset;
+    if (!header_ok || !blob_md_ok(header.md)) return invalid_arguments;
+
+    const auto mdw = memory_desc_wrapper(header.md);
+    if (mdw.format_any() || mdw.has_runtime_dims_or_strides()
+            || mdw.size() != header.data_size)
+        return invalid_arguments;
+
+    // The padding area was zeroed when the blob was written, the data may be
+    // read-only.
+    void *data = const_cast<char *>(static_cast<const char *>(blob))
+            + blob_data_offset;
+    auto _memory = new memory_t(engine, &header.md,
+            memory_flags_t::use_runtime_ptr | memory_flags_t::omit_zero_pad,
+            data);
+    if (_memory == nullptr) return out_of_memory;
+    if (_memory->memory_storage() == nullptr) {
+        delete _memory;
+        return out_of_memory;
+    }
+    *memory = _memory;
+    return success;
+}
+
 status_t dnnl_memory_destroy(memory_t *memory) {
     delete memory;
     return success;
@@ -18,6 +18,7 @@
 #define COMMON_MEMORY_HPP
 
 #include <assert.h>
+#include <atomic>
 #include <memory>
 
 #include "dnnl.h"
@@ -58,6 +59,13 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
     /** zeros padding */
     dnnl::impl::status_t zero_pad(dnnl_stream *stream) const;
 
+    /** returns the version of the data. Versions are unique across memory
+     * objects and change whenever the library knows the data may have been
+     * changed: on a handle update, an unmap, or a write by a primitive */
+    uint64_t version() const { return version_; }
+    /** marks the data as changed */
+    void bump_version() const { version_ = next_version(); }
+
 protected:
     dnnl::impl::engine_t *engine_;
     const dnnl::impl::memory_desc_t md_;
@@ -67,6 +75,9 @@ private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_memory);
 
     std::unique_ptr<dnnl::impl::memory_storage_t> memory_storage_;
+    mutable std::atomic<uint64_t> version_;
+
+    static uint64_t next_version();
 };
 
 #endif
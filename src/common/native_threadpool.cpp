@@ -0,0 +1,256 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_NATIVE
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "native_threadpool.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace native_threadpool {
+
+namespace {
+
+inline void cpu_relax() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// CPUs the process may run on.
+std::vector<int> get_cpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int c = 0; c < CPU_SETSIZE; c++)
+            if (CPU_ISSET(c, &set)) cpus.push_back(c);
+    }
+#endif
+    if (cpus.empty()) {
+        const int n = (int)nstl::max(std::thread::hardware_concurrency(), 1u);
+        for (int c = 0; c < n; c++)
+            cpus.push_back(c);
+    }
+    return cpus;
+}
+
+thread_local bool in_parallel_ = false;
+
+struct job_t {
+    job_t(task_fn_t fn, const void *arg, int nthr, uint64_t epoch)
+        : fn(fn), arg(arg), nthr(nthr), epoch(epoch), n_done(0) {}
+
+    const task_fn_t fn;
+    const void *const arg;
+    const int nthr;
+    const uint64_t epoch;
+    std::atomic<int> n_done;
+};
+
+struct pool_t {
+    pool_t()
+        : cpus_(get_cpus())
+        , nthr_(nstl::max(1,
+                  getenv_int("DNNL_NATIVE_NUM_THREADS", (int)cpus_.size())))
+        , pin_(getenv_int("DNNL_NATIVE_PIN_THREADS", 0) != 0)
+        , spin_count_(getenv_int("DNNL_NATIVE_SPIN_COUNT", 100000)) {}
+
+    int nthr() const { return nthr_; }
+
+    void parallel_for(int nthr, task_fn_t fn, const void *arg) {
+        // A region is run by one caller at a time, the other ones run their
+        // regions on their own.
+        std::unique_lock<std::mutex> region_lock(
+                region_mutex_, std::defer_lock);
+        if (nthr_ == 1 || !region_lock.try_lock()) {
+            run_sequential(nthr, fn, arg);
+            return;
+        }
+
+        start_workers();
+        if (n_claims_ < nthr) {
+            // No worker looks at the claims between the regions.
+            claims_.reset(new std::atomic<uint64_t>[nthr]);
+            for (int i = 0; i < nthr; i++)
+                claims_[i].store(0, std::memory_order_relaxed);
+            n_claims_ = nthr;
+        }
+
+        job_t job(fn, arg, nthr, epoch_.load(std::memory_order_relaxed) + 1);
+        job_.store(&job);
+        epoch_.store(job.epoch);
+        if (n_parked_.load() > 0) {
+            std::lock_guard<std::mutex> guard(park_mutex_);
+            park_cv_.notify_all();
+        }
+
+        in_parallel_ = true;
+        run(job, 0);
+        while (job.n_done.load(std::memory_order_acquire) < nthr)
+            cpu_relax();
+        in_parallel_ = false;
+
+        // Workers that picked the job up may still be looking for items.
+        job_.store(nullptr);
+        while (n_active_.load() > 0)
+            cpu_relax();
+    }
+
+private:
+    void run_sequential(int nthr, task_fn_t fn, const void *arg) {
+        const bool was_in_parallel = in_parallel_;
+        in_parallel_ = true;
+        for (int ithr = 0; ithr < nthr; ithr++)
+            fn(arg, ithr, nthr);
+        in_parallel_ = was_in_parallel;
+    }
+
+    bool try_claim(const job_t &job, int ithr) {
+        uint64_t claim = claims_[ithr].load(std::memory_order_relaxed);
+        return claim != job.epoch
+                && claims_[ithr].compare_exchange_strong(claim, job.epoch);
+    }
+
+    void execute(job_t &job, int ithr) {
+        job.fn(job.arg, ithr, job.nthr);
+        job.n_done.fetch_add(1, std::memory_order_release);
+    }
+
+    void run(job_t &job, int tid) {
+        // Own items first, so that static partitions keep their threads.
+        for (int ithr = tid; ithr < job.nthr; ithr += nthr_)
+            if (try_claim(job, ithr)) execute(job, ithr);
+        // Then the items of the threads that are late.
+        for (int i = 0; i < job.nthr; i++) {
+            const int ithr = (tid + i) % job.nthr;
+            if (try_claim(job, ithr)) execute(job, ithr);
+        }
+    }
+
+    void start_workers() {
+        if (!workers_.empty()) return;
+        for (int tid = 1; tid < nthr_; tid++)
+            workers_.emplace_back(&pool_t::worker, this, tid);
+        // The pool is never destroyed, see pool().
+        for (auto &w : workers_)
+            w.detach();
+    }
+
+    void worker(int tid) {
+#if defined(__linux__)
+        if (pin_) {
+            // The calling thread keeps the first CPU.
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpus_[tid % cpus_.size()], &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+#endif
+        uint64_t seen = 0;
+        for (;;) {
+            uint64_t epoch = 0;
+            int spins = 0;
+            while ((epoch = epoch_.load(std::memory_order_acquire)) == seen) {
+                if (++spins < spin_count_) {
+                    cpu_relax();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(park_mutex_);
+                n_parked_++;
+                park_cv_.wait(lock, [&]() { return epoch_.load() != seen; });
+                n_parked_--;
+                spins = 0;
+            }
+            seen = epoch;
+
+            n_active_++;
+            job_t *job = job_.load();
+            if (job) {
+                in_parallel_ = true;
+                run(*job, tid);
+                in_parallel_ = false;
+            }
+            n_active_--;
+        }
+    }
+
+    const std::vector<int> cpus_;
+    const int nthr_;
+    const bool pin_;
+    const int spin_count_;
+
+    std::mutex region_mutex_;
+    std::vector<std::thread> workers_;
+    std::unique_ptr<std::atomic<uint64_t>[]> claims_;
+    int n_claims_ = 0;
+
+    std::atomic<uint64_t> epoch_ {0};
+    std::atomic<job_t *> job_ {nullptr};
+    std::atomic<int> n_active_ {0};
+
+    std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+    std::atomic<int> n_parked_ {0};
+};
+
+pool_t &pool() {
+    // Never destroyed: the workers may still be parked at the program exit.
+    static pool_t *p = new pool_t();
+    return *p;
+}
+
+} // namespace
+
+int get_num_threads() {
+    return pool().nthr();
+}
+
+bool in_parallel() {
+    return in_parallel_;
+}
+
+void parallel_for(int nthr, task_fn_t fn, const void *arg) {
+    if (nthr <= 1 || in_parallel_) {
+        for (int ithr = 0; ithr < nthr; ithr++)
+            fn(arg, ithr, nthr);
+        return;
+    }
+    pool().parallel_for(nthr, fn, arg);
+}
+
+} // namespace native_threadpool
+} // namespace impl
+} // namespace dnnl
+
+#endif
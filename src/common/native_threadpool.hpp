@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_NATIVE_THREADPOOL_HPP
+#define COMMON_NATIVE_THREADPOOL_HPP
+
+/* This header must be included by dnnl_thread.hpp only */
+
+namespace dnnl {
+namespace impl {
+namespace native_threadpool {
+
+// Threadpool of the NATIVE CPU runtime. The calling thread takes part in
+// every parallel region as thread 0 and the workers of the pool are created
+// on the first use. The pool is configured with environment variables:
+// - DNNL_NATIVE_NUM_THREADS: number of threads including the calling one
+//   (the number of CPUs the process may run on by default),
+// - DNNL_NATIVE_PIN_THREADS: if non-zero, worker i is bound to the i-th CPU
+//   the process may run on (Linux only, off by default),
+// - DNNL_NATIVE_SPIN_COUNT: number of polls of an idle worker before it
+//   sleeps until the next parallel region.
+//
+// Item ithr of a region is first offered to thread ithr % nthr_pool, so a
+// static balance211() split of the same work lands on the same threads in
+// every region. Items not started by their thread are stolen by the threads
+// that are done with their own ones.
+//
+// The functions used by parallel() are exported, since the tests and benchdnn
+// instantiate it as well.
+
+int DNNL_API get_num_threads();
+bool DNNL_API in_parallel();
+
+using task_fn_t = void (*)(const void *arg, int ithr, int nthr);
+
+// Calls fn(arg, ithr, nthr) for every ithr in [0, nthr) and returns when all
+// the calls are done. Regions started from a parallel region or while the
+// pool runs a region started by another thread are executed sequentially.
+void DNNL_API parallel_for(int nthr, task_fn_t fn, const void *arg);
+
+template <typename F>
+void parallel_for(int nthr, const F &f) {
+    parallel_for(
+            nthr,
+            [](const void *arg, int ithr, int nthr) {
+                (*static_cast<const F *>(arg))(ithr, nthr);
+            },
+            &f);
+}
+
+} // namespace native_threadpool
+} // namespace impl
+} // namespace dnnl
+
+#endif
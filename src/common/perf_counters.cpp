@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <mutex>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "perf_counters.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace perf_counters {
+
+#if defined(__linux__)
+std::atomic<bool> enabled_(getenv_int("DNNL_PERF_COUNTERS", 0) != 0);
+#else
+std::atomic<bool> enabled_(false);
+#endif
+
+namespace {
+
+std::atomic<uint64_t> totals[n_counters];
+
+std::mutex stats_mutex;
+std::unordered_map<std::string, perf_counters_t> stats;
+
+#if defined(__linux__)
+struct event_t {
+    uint32_t type;
+    uint64_t config;
+};
+
+// Events that do not exist on the CPU or are not permitted are skipped and
+// read as zero.
+const event_t *get_event(int c) {
+    static const event_t events[n_counters] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE,
+                    PERF_COUNT_HW_CACHE_L1D
+                            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+#if defined(__aarch64__)
+            // Armv8 PMU common events: L2D_CACHE_REFILL, SVE_INST_RETIRED.
+            {PERF_TYPE_RAW, 0x17},
+            {PERF_TYPE_RAW, 0x8002},
+#else
+            // No generic L2 event, the last level cache is counted instead.
+            {PERF_TYPE_HW_CACHE,
+                    PERF_COUNT_HW_CACHE_LL
+                            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_RAW, 0},
+#endif
+    };
+#if !defined(__aarch64__)
+    if (c == sve_instructions) return nullptr;
+#endif
+    return &events[c];
+}
+
+// Counters of one thread, read with a single read() of the group leader.
+struct thread_counters_t {
+    thread_counters_t() {
+        for (int c = 0; c < n_counters; c++)
+            index_[c] = -1;
+        for (int c = 0; c < n_counters; c++) {
+            const event_t *e = get_event(c);
+            if (e == nullptr) continue;
+
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = e->type;
+            attr.config = e->config;
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+
+            const int fd = (int)syscall(
+                    __NR_perf_event_open, &attr, 0, -1, leader_, 0);
+            if (fd < 0) continue;
+            if (leader_ < 0) leader_ = fd;
+            index_[c] = n_opened_++;
+        }
+    }
+
+    ~thread_counters_t() {
+        // Closing the leader also releases the group.
+        if (leader_ >= 0) close(leader_);
+    }
+
+    void read_values(uint64_t values[n_counters]) const {
+        uint64_t buf[1 + n_counters] = {0};
+        if (leader_ < 0 || ::read(leader_, buf, sizeof(buf)) <= 0) {
+            for (int c = 0; c < n_counters; c++)
+                values[c] = 0;
+            return;
+        }
+        for (int c = 0; c < n_counters; c++)
+            values[c] = index_[c] >= 0 ? buf[1 + index_[c]] : 0;
+    }
+
+private:
+    int leader_ = -1;
+    int n_opened_ = 0;
+    int index_[n_counters];
+};
+
+thread_counters_t &thread_counters() {
+    thread_local thread_counters_t counters;
+    return counters;
+}
+#endif
+
+thread_local int depth = 0;
+thread_local uint64_t start_values[n_counters];
+
+} // namespace
+
+void thread_begin() {
+    if (depth++ > 0) return;
+#if defined(__linux__)
+    thread_counters().read_values(start_values);
+#endif
+}
+
+void thread_end() {
+    if (--depth > 0) return;
+#if defined(__linux__)
+    uint64_t values[n_counters];
+    thread_counters().read_values(values);
+    for (int c = 0; c < n_counters; c++)
+        totals[c].fetch_add(values[c] - start_values[c]);
+#endif
+}
+
+void get_totals(uint64_t values[n_counters]) {
+    for (int c = 0; c < n_counters; c++)
+        values[c] = totals[c].load();
+}
+
+void record(const char *impl_name, uint64_t time_ns,
+        const uint64_t values[n_counters]) {
+    std::lock_guard<std::mutex> guard(stats_mutex);
+    auto &s = stats[impl_name];
+    s.executions++;
+    s.time_ns += time_ns;
+    s.cycles += values[cycles];
+    s.instructions += values[instructions];
+    s.l1d_misses += values[l1d_misses];
+    s.l2_misses += values[l2_misses];
+    s.sve_instructions += values[sve_instructions];
+}
+
+} // namespace perf_counters
+} // namespace impl
+} // namespace dnnl
+
+using namespace dnnl::impl;
+
+status_t dnnl_set_perf_counters(int enable) {
+#if defined(__linux__)
+    perf_counters::enabled_.store(enable != 0);
+    return status::success;
+#else
+    return enable ? status::unimplemented : status::success;
+#endif
+}
+
+status_t dnnl_get_perf_counters(
+        const char *impl_name, perf_counters_t *counters) {
+    if (counters == nullptr) return status::invalid_arguments;
+
+    *counters = perf_counters_t();
+    std::lock_guard<std::mutex> guard(perf_counters::stats_mutex);
+    for (const auto &e : perf_counters::stats) {
+        if (impl_name != nullptr && e.first != impl_name) continue;
+        counters->executions += e.second.executions;
+        counters->time_ns += e.second.time_ns;
+        counters->cycles += e.second.cycles;
+        counters->instructions += e.second.instructions;
+        counters->l1d_misses += e.second.l1d_misses;
+        counters->l2_misses += e.second.l2_misses;
+        counters->sve_instructions += e.second.sve_instructions;
+    }
+    return status::success;
+}
+
+status_t dnnl_reset_perf_counters() {
+    std::lock_guard<std::mutex> guard(perf_counters::stats_mutex);
+    perf_counters::stats.clear();
+    return status::success;
+}
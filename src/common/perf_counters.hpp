@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERF_COUNTERS_HPP
+#define COMMON_PERF_COUNTERS_HPP
+
+#include <atomic>
+#include <stdint.h>
+
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace perf_counters {
+
+// Hardware counters are read with perf_event_open() (Linux only). Every
+// thread opens its own counters on first use. A primitive execution is
+// measured on the submitting thread and on each thread of the parallel
+// regions it starts, and the results are aggregated per implementation name.
+//
+// Counts of concurrent executions submitted from different threads are not
+// separated from each other.
+enum counter_t {
+    cycles,
+    instructions,
+    l1d_misses,
+    l2_misses,
+    sve_instructions,
+    n_counters,
+};
+
+// The state and the hooks used by parallel() are exported, since the tests
+// and benchdnn instantiate it as well.
+extern DNNL_API std::atomic<bool> enabled_;
+
+inline bool is_enabled() {
+    return enabled_.load(std::memory_order_relaxed);
+}
+
+// Nested scopes on the same thread are counted once, by the outermost one.
+void DNNL_API thread_begin();
+void DNNL_API thread_end();
+
+// Counts the enclosing code on the current thread if counters are enabled.
+struct thread_scope_t {
+    thread_scope_t() : active_(is_enabled()) {
+        if (active_) thread_begin();
+    }
+    ~thread_scope_t() {
+        if (active_) thread_end();
+    }
+
+private:
+    const bool active_;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(thread_scope_t);
+};
+
+// Sums of the counts of all threads since the library was loaded.
+void get_totals(uint64_t values[n_counters]);
+
+// Adds an execution and its counts to the statistics of impl_name.
+void record(const char *impl_name, uint64_t time_ns,
+        const uint64_t values[n_counters]);
+
+} // namespace perf_counters
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+
+#include <assert.h>
+#include <atomic>
+#include <thread>
+
+#include "omp.h"
+
+#include "persistent_region.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_region {
+
+namespace {
+
+inline void cpu_relax() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// Spins until done() and gives the CPU away after a while, so that the
+// threads of an oversubscribed team make progress.
+template <typename F>
+void spin_until(const F &done) {
+    for (int spins = 0; !done(); spins++) {
+        if (spins < 4096)
+            cpu_relax();
+        else
+            std::this_thread::yield();
+    }
+}
+
+struct region_t {
+    // Size of the team, written by the master before the workers start.
+    int nthr = 1;
+
+    // The current call. The fields are written by the master before epoch is
+    // advanced and are not changed until every thread has acknowledged it.
+    task_fn_t fn = nullptr;
+    const void *arg = nullptr;
+    int call_nthr = 0;
+    bool shutdown = false;
+    std::atomic<uint64_t> epoch {0};
+    std::atomic<int> n_acks {0};
+
+    // Barrier of the items of the current call.
+    std::atomic<int> barrier_count {0};
+    std::atomic<uint64_t> barrier_gen {0};
+};
+
+thread_local region_t *master_region = nullptr;
+thread_local region_t *item_region = nullptr;
+
+void run_item(region_t &r, int ithr) {
+    if (ithr >= r.call_nthr) return;
+    item_region = &r;
+    r.fn(r.arg, ithr, r.call_nthr);
+    item_region = nullptr;
+}
+
+void worker(region_t &r, int ithr) {
+    uint64_t seen = 0;
+    for (;;) {
+        spin_until([&]() {
+            return r.epoch.load(std::memory_order_acquire) != seen;
+        });
+        seen++;
+        if (r.shutdown) {
+            r.n_acks.fetch_add(1, std::memory_order_release);
+            return;
+        }
+        run_item(r, ithr);
+        r.n_acks.fetch_add(1, std::memory_order_release);
+    }
+}
+
+// Publishes the current call and waits until all the workers are done with
+// it.
+void post(region_t &r, bool run_master_item) {
+    r.n_acks.store(0, std::memory_order_relaxed);
+    r.epoch.fetch_add(1, std::memory_order_release);
+    if (run_master_item) run_item(r, 0);
+    spin_until([&]() {
+        return r.n_acks.load(std::memory_order_acquire) == r.nthr - 1;
+    });
+}
+
+} // namespace
+
+void run(int nthr, body_fn_t body, void *arg) {
+    if (nthr <= 1 || omp_in_parallel() || master_region) {
+        body(arg);
+        return;
+    }
+
+    region_t r;
+#pragma omp parallel num_threads(nthr)
+    {
+        const int ithr = omp_get_thread_num();
+        if (ithr == 0) {
+            // The team may be smaller than requested.
+            r.nthr = omp_get_num_threads();
+            if (r.nthr > 1) master_region = &r;
+        }
+#pragma omp barrier
+        if (ithr == 0) {
+            body(arg);
+            if (master_region) {
+                master_region = nullptr;
+                r.shutdown = true;
+                post(r, false);
+            }
+        } else if (r.nthr > 1) {
+            worker(r, ithr);
+        }
+    }
+}
+
+bool is_master() {
+    return master_region != nullptr && item_region == nullptr;
+}
+
+bool in_item() {
+    return item_region != nullptr;
+}
+
+int get_num_threads() {
+    return master_region ? master_region->nthr : 1;
+}
+
+void parallel_for(int nthr, task_fn_t fn, const void *arg) {
+    region_t &r = *master_region;
+    assert(nthr <= r.nthr);
+    r.fn = fn;
+    r.arg = arg;
+    r.call_nthr = nthr;
+    r.barrier_count.store(0, std::memory_order_relaxed);
+    post(r, true);
+}
+
+void item_barrier() {
+    region_t &r = *item_region;
+    const int n = r.call_nthr;
+    if (n <= 1) return;
+    const uint64_t gen = r.barrier_gen.load(std::memory_order_acquire);
+    if (r.barrier_count.fetch_add(1, std::memory_order_acq_rel) == n - 1) {
+        r.barrier_count.store(0, std::memory_order_relaxed);
+        r.barrier_gen.fetch_add(1, std::memory_order_release);
+    } else {
+        spin_until([&]() {
+            return r.barrier_gen.load(std::memory_order_acquire) != gen;
+        });
+    }
+}
+
+} // namespace persistent_region
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_REGION_HPP
+#define COMMON_PERSISTENT_REGION_HPP
+
+/* This header must be included by dnnl_thread.hpp only */
+
+namespace dnnl {
+namespace impl {
+namespace persistent_region {
+
+// A persistent region is a single OpenMP parallel region that stays open
+// while its master thread executes a sequence of primitives. The other
+// threads of the team wait for work in a spin loop, and every parallel()
+// call of the master hands its items to them instead of opening a new OpenMP
+// region: item ithr runs on thread ithr of the team and the call returns
+// once all the threads have seen it, which replaces the fork and the join of
+// an OpenMP region with a single lightweight barrier.
+//
+// dnnl_thr_barrier() called from the items synchronizes the threads running
+// items of the same call.
+//
+// The functions used by parallel() are exported, since the tests and benchdnn
+// instantiate it as well.
+
+using task_fn_t = void (*)(const void *arg, int ithr, int nthr);
+using body_fn_t = void (*)(void *arg);
+
+// Runs body(arg) on the calling thread as the master of a persistent region
+// of nthr threads. The body runs without a region if nthr is 1 or if the
+// calling thread is already in a parallel region.
+void run(int nthr, body_fn_t body, void *arg);
+
+// Returns true if the calling thread is the master of a persistent region
+// and is not running an item.
+bool DNNL_API is_master();
+
+// Returns true if the calling thread is running an item.
+bool DNNL_API in_item();
+
+// Number of threads of the region of the calling master thread.
+int DNNL_API get_num_threads();
+
+// Runs fn(arg, ithr, nthr) for every ithr in [0, nthr) on the team of the
+// region of the calling master thread, nthr must not exceed the team size.
+void DNNL_API parallel_for(int nthr, task_fn_t fn, const void *arg);
+
+template <typename F>
+void parallel_for(int nthr, const F &f) {
+    parallel_for(
+            nthr,
+            [](const void *arg, int ithr, int nthr) {
+                (*static_cast<const F *>(arg))(ithr, nthr);
+            },
+            &f);
+}
+
+// Barrier of the threads running items of the current parallel_for().
+void DNNL_API item_barrier();
+
+} // namespace persistent_region
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -15,11 +15,16 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <vector>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "primitive.hpp"
+#include "perf_counters.hpp"
 #include "primitive_desc.hpp"
+#include "profiler.hpp"
+#include "reorder_cache.hpp"
 #include "reorder_pd.hpp"
 #include "scratchpad_debug.hpp"
 #include "stream.hpp"
@@ -44,6 +49,20 @@ void unpoison_outputs(const exec_args_t &args) {
         msan_unpoison(p, s);
     }
 }
+
+// Executes the primitive and marks its outputs as changed, see
+// memory_t::version().
+status_t execute_and_update_versions(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (primitive_iface->pd()->impl()->kind() == primitive_kind::reorder
+            && reorder_cache::is_enabled())
+        return reorder_cache::execute(primitive_iface, ctx);
+
+    status_t status = primitive_iface->execute(ctx);
+    for (const auto &arg : ctx.args())
+        if (!arg.second.is_const) arg.second.mem->bump_version();
+    return status;
+}
 } // namespace
 
 namespace dnnl {
@@ -73,6 +92,69 @@ nested_scratchpad_t::~nested_scratchpad_t() {
 #endif
 }
 
+status_t primitive_execute(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    stream_t *stream = ctx.stream();
+    status_t status = status::success;
+    stream->before_exec_hook();
+
+    const bool verbose = get_verbose();
+    const bool profiling = profiler::is_enabled();
+    const bool counting = perf_counters::is_enabled();
+    if (verbose || profiling || counting) {
+        using namespace perf_counters;
+        uint64_t counts[n_counters], counts_end[n_counters];
+        if (counting) {
+            get_totals(counts);
+            thread_begin();
+        }
+        if (profiling) profiler::take_nthr();
+        const uint64_t start_ns = profiler::get_nsec();
+        status = execute_and_update_versions(primitive_iface, ctx);
+        // Executions of host asynchronous streams are already on the
+        // stream's thread and are complete here.
+        if (!stream->is_host_async()) stream->wait();
+        const uint64_t end_ns = profiler::get_nsec();
+        if (counting) {
+            thread_end();
+            get_totals(counts_end);
+            for (int c = 0; c < n_counters; c++)
+                counts[c] = counts_end[c] - counts[c];
+            perf_counters::record(primitive_iface->pd()->impl()->name(),
+                    end_ns - start_ns, counts);
+        }
+        if (profiling) {
+            profiling_record_t rec;
+            primitive_iface->init_profiling_record(rec);
+            rec.start_ns = start_ns;
+            rec.end_ns = end_ns;
+            rec.nthr = profiler::take_nthr();
+            profiler::record(rec);
+        }
+        if (verbose && counting) {
+            printf("dnnl_verbose,exec,%s,%g,cycles:%" PRIu64
+                   ",instructions:%" PRIu64 ",l1d_misses:%" PRIu64
+                   ",l2_misses:%" PRIu64 ",sve_instructions:%" PRIu64 "\n",
+                    primitive_iface->pd()->info(), 1e-6 * (end_ns - start_ns),
+                    counts[cycles], counts[instructions], counts[l1d_misses],
+                    counts[l2_misses], counts[sve_instructions]);
+            fflush(0);
+        } else if (verbose) {
+            printf("dnnl_verbose,exec,%s,%g\n", primitive_iface->pd()->info(),
+                    1e-6 * (end_ns - start_ns));
+            fflush(0);
+        }
+    } else {
+        status = execute_and_update_versions(primitive_iface, ctx);
+    }
+
+    stream->after_exec_hook();
+
+    if (msan_enabled) unpoison_outputs(ctx.args());
+
+    return status;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -102,26 +184,73 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
             primitive_iface->pd()->impl().get(), nargs, c_args, args);
     if (status != status::success) return status;
 
-    stream->before_exec_hook();
+    if (stream->is_host_async())
+        return stream->enqueue(primitive_iface, std::move(args));
 
     exec_ctx_t ctx(stream, std::move(args));
+    return primitive_execute(primitive_iface, ctx);
+}
 
-    if (get_verbose()) {
-        double ms = get_msec();
-        status = primitive_iface->execute(ctx);
-        stream->wait();
-        ms = get_msec() - ms;
-        printf("dnnl_verbose,exec,%s,%g\n", primitive_iface->pd()->info(), ms);
-        fflush(0);
-    } else {
-        status = primitive_iface->execute(ctx);
+namespace {
+struct sequence_t {
+    stream_t *stream;
+    int count;
+    const primitive_iface_t *const *primitive_ifaces;
+    std::vector<exec_args_t> args;
+    status_t status;
+};
+
+void execute_sequence(void *arg) {
+    auto &seq = *static_cast<sequence_t *>(arg);
+    for (int i = 0; i < seq.count; i++) {
+        exec_ctx_t ctx(seq.stream, std::move(seq.args[i]));
+        seq.status = primitive_execute(seq.primitive_ifaces[i], ctx);
+        if (seq.status != status::success) return;
     }
+}
+} // namespace
 
-    stream->after_exec_hook();
+status_t dnnl_primitive_execute_sequence(stream_t *stream, int count,
+        const primitive_iface_t *const *primitive_ifaces, const int *nargs,
+        const dnnl_exec_arg_t *const *c_args) {
+    bool ok = stream != nullptr && count >= 0
+            && IMPLICATION(count > 0,
+                    !utils::any_null(primitive_ifaces, nargs, c_args));
+    if (!ok) return invalid_arguments;
 
-    if (msan_enabled) unpoison_outputs(ctx.args());
+    sequence_t seq {stream, count, primitive_ifaces, {}, success};
+    seq.args.resize(count);
+    for (int i = 0; i < count; i++) {
+        const primitive_iface_t *primitive_iface = primitive_ifaces[i];
+        ok = primitive_iface != nullptr
+                && primitive_iface->engine() == stream->engine()
+                && IMPLICATION(nargs[i] > 0, c_args[i] != nullptr);
+        if (!ok) return invalid_arguments;
+
+        status_t status = cvt_primtive_args(primitive_iface->pd()->impl().get(),
+                nargs[i], c_args[i], seq.args[i]);
+        if (status != status::success) return status;
+    }
 
-    return status;
+    if (stream->is_host_async()) {
+        for (int i = 0; i < count; i++) {
+            status_t status = stream->enqueue(
+                    primitive_ifaces[i], std::move(seq.args[i]));
+            if (status != status::success) return status;
+        }
+        return success;
+    }
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Primitives of a persistent region hand their work to the team of the
+    // region, see persistent_region.hpp.
+    if (stream->engine()->kind() == engine_kind::cpu && count > 1) {
+        persistent_region::run(dnnl_get_max_threads(), execute_sequence, &seq);
+        return seq.status;
+    }
+#endif
+    execute_sequence(&seq);
+    return seq.status;
 }
 
 status_t dnnl_primitive_get_primitive_desc(
@@ -204,6 +333,21 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
+    } else if (scratchpad_ && scratchpad_->is_global()
+            && ctx.stream()->is_host_async()) {
+        std::lock_guard<std::mutex> guard(async_scratchpad_mutex_);
+        if (!async_scratchpad_) {
+            const size_t scratchpad_size = primitive_->pd()->scratchpad_size(
+                    scratchpad_mode::library);
+            async_scratchpad_.reset(create_scratchpad(
+                    pd_->engine(), scratchpad_size, false));
+            if (!async_scratchpad_
+                    || async_scratchpad_->get_memory_storage() == nullptr) {
+                async_scratchpad_.reset();
+                return out_of_memory;
+            }
+        }
+        mem_storage = async_scratchpad_->get_memory_storage();
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
     }
@@ -218,4 +362,19 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     return status;
 }
 
+void dnnl_primitive::init_profiling_record(profiling_record_t &rec) const {
+    const char *impl_name = profiling_impl_name_.load();
+    const char *info = profiling_info_.load();
+    if (!impl_name || !info) {
+        // Racing threads intern the same strings and get the same pointers.
+        impl_name = profiler::intern(primitive_->pd()->name());
+        info = profiler::intern(pd_->info());
+        profiling_impl_name_.store(impl_name);
+        profiling_info_.store(info);
+    }
+    rec.kind = primitive_->pd()->kind();
+    rec.impl_name = impl_name;
+    rec.info = info;
+}
+
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -29,7 +29,9 @@
 #include "rw_mutex.hpp"
 #include "scratchpad.hpp"
 
+#include <atomic>
 #include <future>
+#include <mutex>
 #include <type_traits>
 
 namespace dnnl {
@@ -149,6 +151,12 @@ private:
     std::unique_ptr<memory_tracking::grantor_t> grantor_;
 };
 
+// Executes the primitive on the calling thread with the stream hooks, verbose
+// output, profiling and counters. Used by dnnl_primitive_execute() and by the
+// threads of host asynchronous streams.
+status_t primitive_execute(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx);
+
 // The resource_t abstraction is a base class for all resource classes.
 // Those are responsible for holding a part of a primitive implementation that
 // cannot be stored in the primitive cache as part of the implementation.
@@ -251,11 +259,23 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     const primitive_desc_iface_t *pd() const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
+    // Fills the descriptive fields of a profiling record. The strings are
+    // interned on the first call.
+    void init_profiling_record(dnnl::impl::profiling_record_t &rec) const;
+
 private:
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+    // Executions on host asynchronous streams run on the threads of the
+    // stream, which do not see the thread-local global scratchpad and may run
+    // other primitives at the same time. They use a scratchpad of the
+    // primitive instead, created on the first such execution.
+    mutable std::unique_ptr<dnnl::impl::scratchpad_t> async_scratchpad_;
+    mutable std::mutex async_scratchpad_mutex_;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    mutable std::atomic<const char *> profiling_impl_name_ {nullptr};
+    mutable std::atomic<const char *> profiling_info_ {nullptr};
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
@@ -18,8 +18,8 @@
 #include "c_types_map.hpp"
 #include "rw_mutex.hpp"
 
-#include <list>
-#include <unordered_map>
+#include <chrono>
+#include <functional>
 
 namespace dnnl {
 namespace impl {
@@ -31,7 +31,7 @@ primitive_cache_t &primitive_cache() {
 #else
     static const int capacity = 0;
 #endif
-    static lru_primitive_cache_t cache(capacity);
+    static sharded_primitive_cache_t cache(capacity);
     return cache;
 }
 
@@ -45,109 +45,220 @@ status_t get_primitive_cache_size(int *size) {
     return dnnl::impl::status::success;
 }
 
-status_t lru_primitive_cache_t::set_capacity(int capacity) {
-    utils::lock_write_t lock_w(rw_mutex());
-    capacity_ = (size_t)capacity;
-    // Check if number of entries exceeds the new capacity
-    if (cache_list_.size() > capacity_) {
-        // Evict excess entries
-        size_t n_excess_entries = cache_list_.size() - capacity_;
-        evict(n_excess_entries);
-    }
+namespace {
+using steady_clock_t = std::chrono::steady_clock;
+
+uint64_t elapsed_ns(const steady_clock_t::time_point &start) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            steady_clock_t::now() - start)
+            .count();
+}
+} // namespace
+
+sharded_primitive_cache_t::sharded_primitive_cache_t(int capacity)
+    : capacity_(capacity)
+    , size_(0)
+    , evict_hand_(0)
+    , stats_enabled_(getenv_int("DNNL_PRIMITIVE_CACHE_STATS", 0) != 0) {}
+
+status_t sharded_primitive_cache_t::set_capacity(int capacity) {
+    capacity_ = capacity;
+    // Evict excess entries if the number of entries exceeds the new capacity
+    evict_excess(true);
     return status::success;
 }
 
-int lru_primitive_cache_t::get_capacity() const {
-    utils::lock_read_t lock_r(rw_mutex());
-    return (int)capacity_;
+int sharded_primitive_cache_t::get_capacity() const {
+    return capacity_;
 }
 
 // For undocumented API
-int lru_primitive_cache_t::get_size() const {
-    utils::lock_read_t lock_r(rw_mutex());
-    return (int)cache_list_.size();
+int sharded_primitive_cache_t::get_size() const {
+    return size_;
 }
 
-lru_primitive_cache_t::value_t lru_primitive_cache_t::get_or_add(
-        const key_t &key, const value_t &value, bool need_lock) {
-    // Cache is disabled
-    lock_read(need_lock);
-    if (capacity_ == 0) {
-        unlock_read(need_lock);
-        return value_t();
-    }
+void sharded_primitive_cache_t::set_stats_enabled(bool enabled) {
+    stats_enabled_ = enabled;
+}
 
-    unlock_read(need_lock);
-    lock_write(need_lock);
+void sharded_primitive_cache_t::get_stats(
+        primitive_cache_stats_t *stats) const {
+    *stats = primitive_cache_stats_t();
+    for (const auto &s : shards_) {
+        stats->hits += s.stats.hits;
+        stats->misses += s.stats.misses;
+        stats->evictions += s.stats.evictions;
+        stats->lookup_time_ns += s.stats.lookup_time_ns;
+        stats->lock_wait_time_ns += s.stats.lock_wait_time_ns;
+    }
+}
 
-    // Double check the capacity due to possible race condition
-    if (need_lock && capacity_ == 0) {
-        unlock_write(need_lock);
-        return value_t();
+void sharded_primitive_cache_t::reset_stats() {
+    for (auto &s : shards_) {
+        s.stats.hits = 0;
+        s.stats.misses = 0;
+        s.stats.evictions = 0;
+        s.stats.lookup_time_ns = 0;
+        s.stats.lock_wait_time_ns = 0;
     }
+}
 
-    // Check if the requested entry is present in the cache
-    auto e = get(key);
-    if (!e.valid()) {
-        // If the entry is missing in the cache then add it
-        add(key, value);
+sharded_primitive_cache_t::shard_t &sharded_primitive_cache_t::shard(
+        const key_t &key) {
+    // Per-shard hash maps use the low bits of the same hash, so select the
+    // shard by the high bits to keep the buckets inside a shard balanced.
+    const size_t h = std::hash<key_t>()(key);
+    return shards_[(h >> (sizeof(size_t) * 8 - 4)) % n_shards];
+}
+
+void sharded_primitive_cache_t::lock_read(shard_t &s, bool need_lock) {
+    if (!need_lock) return;
+    if (!stats_enabled_) {
+        s.mutex.lock_read();
+        return;
     }
-    unlock_write(need_lock);
-    return e;
+    const auto start = steady_clock_t::now();
+    s.mutex.lock_read();
+    stats_t::add(s.stats.lock_wait_time_ns, elapsed_ns(start));
 }
 
-void lru_primitive_cache_t::add(const key_t &key, const value_t &value) {
-    if (cache_list_.size() >= capacity_) {
-        // Evict the least recently used entry
-        evict(1);
+void sharded_primitive_cache_t::lock_write(shard_t &s, bool need_lock) {
+    if (!need_lock) return;
+    if (!stats_enabled_) {
+        s.mutex.lock_write();
+        return;
     }
-    // Place a new entry to cache_list_ and update cache_mapper_
-    cache_list_.emplace_front(key, value);
-    cache_mapper_.insert(std::make_pair(key, cache_list_.begin()));
-    assert(cache_list_.size() == cache_mapper_.size());
+    const auto start = steady_clock_t::now();
+    s.mutex.lock_write();
+    stats_t::add(s.stats.lock_wait_time_ns, elapsed_ns(start));
 }
 
-lru_primitive_cache_t::value_t lru_primitive_cache_t::get(const key_t &key) {
-    auto it = cache_mapper_.find(key);
-    if (it == cache_mapper_.end()) { return value_t(); }
+sharded_primitive_cache_t::value_t sharded_primitive_cache_t::get_or_add(
+        const key_t &key, const value_t &value, bool need_lock) {
+    // Cache is disabled
+    if (capacity_ == 0) return value_t();
+
+    const bool stats_enabled = stats_enabled_;
+    steady_clock_t::time_point start;
+    if (stats_enabled) start = steady_clock_t::now();
+    auto &s = shard(key);
 
-    // Move 1 cache_list_ node to the front of the cache_list_
-    cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
-    return cache_list_.front().second;
+    // Fast path: a hit only requires the shared lock of the shard
+    lock_read(s, need_lock);
+    auto e = s.get(key);
+    unlock_read(s, need_lock);
+
+    if (!e.valid()) {
+        lock_write(s, need_lock);
+        // Double check the entry due to possible race condition
+        e = s.get(key);
+        if (!e.valid()) {
+            s.add(key, value);
+            size_++;
+        }
+        unlock_write(s, need_lock);
+        // Shards are locked one at a time during eviction, hence it must
+        // happen after the lock of the current shard is released.
+        if (!e.valid()) evict_excess(need_lock);
+    }
+
+    if (stats_enabled) {
+        stats_t::add(e.valid() ? s.stats.hits : s.stats.misses, 1);
+        stats_t::add(s.stats.lookup_time_ns, elapsed_ns(start));
+    }
+    return e;
 }
 
-void lru_primitive_cache_t::remove_if_invalidated(
+void sharded_primitive_cache_t::remove_if_invalidated(
         const key_t &key, bool need_lock) {
-    lock_write(need_lock);
-    auto it = cache_mapper_.find(key);
-    if (it == cache_mapper_.end()) {
+    auto &s = shard(key);
+    lock_write(s, need_lock);
+    auto it = s.mapper.find(key);
+    if (it == s.mapper.end()) {
         // The entry has been already evicted at this point
-        unlock_write(need_lock);
+        unlock_write(s, need_lock);
         return;
     }
 
-    const auto &value = it->second->second;
+    const auto &value = it->second->value;
     if (value.get().primitive) {
         // If the entry is not invalidated
-        unlock_write(need_lock);
+        unlock_write(s, need_lock);
         return;
     }
 
     // Remove the invalidated entry
-    cache_list_.erase(it->second);
-    cache_mapper_.erase(it);
-    assert(cache_list_.size() == cache_mapper_.size());
-    unlock_write(need_lock);
+    s.remove(it);
+    size_--;
+    unlock_write(s, need_lock);
 }
 
-// Evicts n the least recently used entries
-void lru_primitive_cache_t::evict(size_t n) {
-    for (size_t e = 0; e < n; e++) {
-        cache_mapper_.erase(cache_list_.back().first);
-        cache_list_.pop_back();
+void sharded_primitive_cache_t::evict_excess(bool need_lock) {
+    while (size_ > capacity_) {
+        if (!evict_one(need_lock)) break;
     }
 }
 
+// Moves the global clock hand over the shards. Every shard is visited twice
+// at most: the first visit may only clear the reference bits, the second one
+// then finds an entry to evict unless the shard was emptied or all of its
+// entries were referenced again in the meantime.
+bool sharded_primitive_cache_t::evict_one(bool need_lock) {
+    for (int i = 0; i < 2 * n_shards; i++) {
+        auto &s = shards_[evict_hand_++ % n_shards];
+        lock_write(s, need_lock);
+        const bool evicted = s.evict_one();
+        unlock_write(s, need_lock);
+        if (evicted) {
+            size_--;
+            if (stats_enabled_) stats_t::add(s.stats.evictions, 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+sharded_primitive_cache_t::value_t sharded_primitive_cache_t::shard_t::get(
+        const key_t &key) {
+    auto it = mapper.find(key);
+    if (it == mapper.end()) return value_t();
+
+    // The bit may be set by several readers at a time, it is cleared by the
+    // clock hand under the exclusive lock only.
+    it->second->referenced.store(true, std::memory_order_relaxed);
+    return it->second->value;
+}
+
+void sharded_primitive_cache_t::shard_t::add(
+        const key_t &key, const value_t &value) {
+    // A new entry is placed right behind the clock hand so that it is visited
+    // last during the next sweep.
+    auto it = entries.emplace(hand, key, value);
+    mapper.insert(std::make_pair(key, it));
+    assert(entries.size() == mapper.size());
+}
+
+void sharded_primitive_cache_t::shard_t::remove(
+        std::unordered_map<key_t, std::list<entry_t>::iterator>::iterator it) {
+    if (hand == it->second) hand++;
+    entries.erase(it->second);
+    mapper.erase(it);
+    assert(entries.size() == mapper.size());
+}
+
+bool sharded_primitive_cache_t::shard_t::evict_one() {
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (hand == entries.end()) hand = entries.begin();
+        if (hand->referenced.exchange(false, std::memory_order_relaxed)) {
+            hand++;
+            continue;
+        }
+        remove(mapper.find(hand->key));
+        return true;
+    }
+    return false;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -168,3 +279,27 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
 #endif
     return dnnl::impl::status::success;
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl::impl::primitive_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl::impl::primitive_cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().get_stats(stats);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_stats(int enable) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().set_stats_enabled(enable != 0);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_reset_primitive_cache_stats() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    dnnl::impl::primitive_cache().reset_stats();
+#endif
+    return dnnl::impl::status::success;
+}
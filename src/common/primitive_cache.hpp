@@ -17,6 +17,7 @@
 #ifndef COMMON_PRIMITIVE_CACHE_HPP
 #define COMMON_PRIMITIVE_CACHE_HPP
 
+#include <atomic>
 #include <future>
 #include <list>
 #include <memory>
@@ -52,34 +53,24 @@ struct primitive_cache_t : public c_compatible {
 
     virtual int get_size() const = 0;
 
-protected:
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_read(bool need_lock) {
-        if (need_lock) rw_mutex().lock_read();
-    }
-
-    void lock_write(bool need_lock) {
-        if (need_lock) rw_mutex().lock_write();
-    }
-
-    void unlock_read(bool need_lock) {
-        if (need_lock) rw_mutex().unlock_read();
-    }
-
-    void unlock_write(bool need_lock) {
-        if (need_lock) rw_mutex().unlock_write();
-    }
+    virtual void set_stats_enabled(bool enabled) = 0;
+    virtual void get_stats(primitive_cache_stats_t *stats) const = 0;
+    virtual void reset_stats() = 0;
 };
 
-// The cache uses LRU replacement policy
-struct lru_primitive_cache_t : public primitive_cache_t {
-    lru_primitive_cache_t(int capacity) : capacity_(capacity) {}
+// The cache is split into shards selected by the key hash, each protected by
+// its own read-write lock, so that lookups of different primitives do not
+// contend. A lookup that hits only takes the read lock: instead of reordering
+// an LRU list it sets the reference bit of the entry. Eviction uses the clock
+// algorithm across shards, which approximates LRU: an entry is evicted once
+// the clock hand finds it without the reference bit set.
+//
+// The capacity is global: excess entries are evicted right after an insertion
+// or a capacity change, possibly from shards other than the one updated.
+struct sharded_primitive_cache_t : public primitive_cache_t {
+    sharded_primitive_cache_t(int capacity);
 
-    ~lru_primitive_cache_t() override = default;
+    ~sharded_primitive_cache_t() override = default;
 
     status_t set_capacity(int capacity) override;
     int get_capacity() const override;
@@ -90,15 +81,78 @@ struct lru_primitive_cache_t : public primitive_cache_t {
 
     int get_size() const override;
 
+    void set_stats_enabled(bool enabled) override;
+    void get_stats(primitive_cache_stats_t *stats) const override;
+    void reset_stats() override;
+
 private:
-    void evict(size_t n);
-    void add(const key_t &key, const value_t &value);
-    value_t get(const key_t &key);
-
-    size_t capacity_;
-    using cache_list_t = std::list<std::pair<key_t, value_t>>;
-    cache_list_t cache_list_;
-    std::unordered_map<key_t, cache_list_t::iterator> cache_mapper_;
+    static constexpr int n_shards = 16;
+
+    struct entry_t {
+        entry_t(const key_t &key, const value_t &value)
+            : key(key), value(value), referenced(true) {}
+
+        key_t key;
+        value_t value;
+        std::atomic<bool> referenced;
+    };
+
+    // Statistics are counted per shard, each on its own cache lines, so that
+    // lookups in different shards do not contend on them. They are summed
+    // when queried.
+    struct alignas(64) stats_t {
+        std::atomic<uint64_t> hits {0};
+        std::atomic<uint64_t> misses {0};
+        std::atomic<uint64_t> evictions {0};
+        std::atomic<uint64_t> lookup_time_ns {0};
+        std::atomic<uint64_t> lock_wait_time_ns {0};
+
+        static void add(std::atomic<uint64_t> &counter, uint64_t value) {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+    };
+
+    struct shard_t {
+        shard_t() : hand(entries.end()) {}
+
+        // Returns a valid value and marks the entry as referenced if the key
+        // is present.
+        value_t get(const key_t &key);
+        void add(const key_t &key, const value_t &value);
+        void remove(std::unordered_map<key_t,
+                std::list<entry_t>::iterator>::iterator it);
+        // Advances the clock hand over the shard once. Clears the reference
+        // bits on its way and evicts the first entry found without one.
+        // Returns false if nothing was evicted.
+        bool evict_one();
+
+        utils::rw_mutex_t mutex;
+        std::list<entry_t> entries;
+        std::unordered_map<key_t, std::list<entry_t>::iterator> mapper;
+        std::list<entry_t>::iterator hand;
+        stats_t stats;
+    };
+
+    shard_t &shard(const key_t &key);
+    // Evicts entries until the size fits the capacity.
+    void evict_excess(bool need_lock);
+    bool evict_one(bool need_lock);
+
+    void lock_read(shard_t &s, bool need_lock);
+    void lock_write(shard_t &s, bool need_lock);
+    void unlock_read(shard_t &s, bool need_lock) {
+        if (need_lock) s.mutex.unlock_read();
+    }
+    void unlock_write(shard_t &s, bool need_lock) {
+        if (need_lock) s.mutex.unlock_write();
+    }
+
+    std::atomic<int> capacity_;
+    std::atomic<int> size_;
+    std::atomic<unsigned> evict_hand_;
+    // Nothing is counted or timed unless statistics are enabled.
+    std::atomic<bool> stats_enabled_;
+    shard_t shards_[n_shards];
 };
 
 primitive_cache_t &primitive_cache();
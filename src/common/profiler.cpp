@@ -0,0 +1,207 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "dnnl.h"
+#include "dnnl_debug.h"
+
+#include "c_types_map.hpp"
+#include "profiler.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace profiler {
+
+std::atomic<bool> enabled_(false);
+
+namespace {
+
+// Single-producer single-consumer ring. head_ is only advanced by the owning
+// thread, tail_ only by drain() under the registry lock.
+struct ring_t {
+    ring_t(int tid) : head_(0), tail_(0), tid_(tid) {}
+
+    profiling_record_t buf_[ring_capacity];
+    std::atomic<size_t> head_;
+    std::atomic<size_t> tail_;
+    const int tid_;
+};
+
+struct registry_t {
+    std::mutex mutex;
+    // Rings are shared with their threads, so records of a finished thread
+    // can still be drained.
+    std::vector<std::shared_ptr<ring_t>> rings;
+    int next_tid = 0;
+
+    std::mutex strings_mutex;
+    std::unordered_set<std::string> strings;
+};
+
+registry_t &registry() {
+    static registry_t r;
+    return r;
+}
+
+ring_t &thread_ring() {
+    thread_local std::shared_ptr<ring_t> ring;
+    if (!ring) {
+        auto &r = registry();
+        std::lock_guard<std::mutex> guard(r.mutex);
+        ring = std::make_shared<ring_t>(r.next_tid++);
+        r.rings.push_back(ring);
+    }
+    return *ring;
+}
+
+void write_json_string(FILE *f, const char *str) {
+    fputc('"', f);
+    for (const char *c = str; *c; c++) {
+        switch (*c) {
+            case '"': fputs("\\\"", f); break;
+            case '\\': fputs("\\\\", f); break;
+            default:
+                if ((unsigned char)*c < 0x20)
+                    fprintf(f, "\\u%04x", (unsigned char)*c);
+                else
+                    fputc(*c, f);
+        }
+    }
+    fputc('"', f);
+}
+
+} // namespace
+
+uint64_t get_nsec() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(
+            steady_clock::now().time_since_epoch())
+            .count();
+}
+
+const char *intern(const char *str) {
+    auto &r = registry();
+    std::lock_guard<std::mutex> guard(r.strings_mutex);
+    return r.strings.emplace(str ? str : "").first->c_str();
+}
+
+namespace {
+thread_local int used_nthr = 1;
+} // namespace
+
+void note_nthr(int nthr) {
+    if (nthr > used_nthr) used_nthr = nthr;
+}
+
+int take_nthr() {
+    const int nthr = used_nthr;
+    used_nthr = 1;
+    return nthr;
+}
+
+void record(const profiling_record_t &rec) {
+    ring_t &ring = thread_ring();
+    const size_t head = ring.head_.load(std::memory_order_relaxed);
+    const size_t tail = ring.tail_.load(std::memory_order_acquire);
+    if (head - tail >= ring_capacity) return;
+
+    profiling_record_t &dst = ring.buf_[head % ring_capacity];
+    dst = rec;
+    dst.tid = ring.tid_;
+    ring.head_.store(head + 1, std::memory_order_release);
+}
+
+} // namespace profiler
+} // namespace impl
+} // namespace dnnl
+
+using namespace dnnl::impl;
+
+status_t dnnl_profiling_start() {
+    profiler::enabled_.store(true, std::memory_order_relaxed);
+    return status::success;
+}
+
+status_t dnnl_profiling_stop() {
+    profiler::enabled_.store(false, std::memory_order_relaxed);
+    return status::success;
+}
+
+status_t dnnl_profiling_drain(
+        profiling_record_t *records, size_t capacity, size_t *count) {
+    if (count == nullptr || (records == nullptr && capacity != 0))
+        return status::invalid_arguments;
+
+    auto &r = profiler::registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+
+    size_t n = 0;
+    for (auto it = r.rings.begin(); it != r.rings.end();) {
+        profiler::ring_t &ring = **it;
+        size_t tail = ring.tail_.load(std::memory_order_relaxed);
+        const size_t head = ring.head_.load(std::memory_order_acquire);
+        for (; tail < head && n < capacity; tail++)
+            records[n++] = ring.buf_[tail % profiler::ring_capacity];
+        ring.tail_.store(tail, std::memory_order_release);
+
+        // The thread is gone and there is nothing left to drain.
+        if (it->use_count() == 1 && tail == head)
+            it = r.rings.erase(it);
+        else
+            ++it;
+    }
+
+    *count = n;
+    return status::success;
+}
+
+status_t dnnl_profiling_write_chrome_trace(const profiling_record_t *records,
+        size_t count, const char *file_name) {
+    if (file_name == nullptr || (records == nullptr && count != 0))
+        return status::invalid_arguments;
+
+    FILE *f = dnnl::impl::fopen(file_name, "w");
+    if (f == nullptr) return status::invalid_arguments;
+
+    // Complete events ("ph":"X") with the time in microseconds.
+    fputs("{\"traceEvents\":[", f);
+    for (size_t i = 0; i < count; i++) {
+        const auto &rec = records[i];
+        fprintf(f,
+                "%s\n{\"ph\":\"X\",\"pid\":0,\"tid\":%d,"
+                "\"ts\":%.3f,\"dur\":%.3f,\"cat\":",
+                i == 0 ? "" : ",", rec.tid, 1e-3 * rec.start_ns,
+                1e-3 * (rec.end_ns - rec.start_ns));
+        profiler::write_json_string(f, dnnl_prim_kind2str(rec.kind));
+        fputs(",\"name\":", f);
+        profiler::write_json_string(f, rec.impl_name ? rec.impl_name : "");
+        fputs(",\"args\":{\"info\":", f);
+        profiler::write_json_string(f, rec.info ? rec.info : "");
+        fprintf(f, ",\"nthr\":%d}}", rec.nthr);
+    }
+    fputs("\n],\"displayTimeUnit\":\"ms\"}\n", f);
+
+    const bool ok = !ferror(f);
+    return fclose(f) == 0 && ok ? status::success : status::invalid_arguments;
+}
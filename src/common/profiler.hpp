@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PROFILER_HPP
+#define COMMON_PROFILER_HPP
+
+#include <atomic>
+#include <stdint.h>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace profiler {
+
+// Records of primitive executions are collected in a fixed-size ring per
+// thread. Only the owning thread writes to a ring and only drain() reads
+// from it, so recording needs neither locks nor read-modify-write atomics.
+// A record that does not fit into a full ring is dropped.
+enum { ring_capacity = 4096 };
+
+extern std::atomic<bool> enabled_;
+
+// Checked on every primitive execution, costs a single relaxed load when
+// profiling is off.
+inline bool is_enabled() {
+    return enabled_.load(std::memory_order_relaxed);
+}
+
+// Monotonic time stamp in nanoseconds.
+uint64_t get_nsec();
+
+// Returns a copy of the string that stays valid until the library is
+// unloaded. Takes a lock, so the result is expected to be cached.
+const char *intern(const char *str);
+
+void record(const profiling_record_t &rec);
+
+// parallel() notes the size of every team it starts, so that a record holds
+// the number of threads the execution actually used. take_nthr() returns the
+// largest team started by the current thread since its previous call. The
+// former is exported, since the tests and benchdnn instantiate parallel() as
+// well.
+void DNNL_API note_nthr(int nthr);
+int take_nthr();
+
+} // namespace profiler
+} // namespace impl
+} // namespace dnnl
+
+#endif
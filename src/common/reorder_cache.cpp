@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "memory.hpp"
+#include "primitive.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_hashing.hpp"
+#include "reorder_cache.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace reorder_cache {
+
+namespace {
+
+struct key_t {
+    key_t(const primitive_iface_t *primitive_iface, const void *src_handle,
+            uint64_t src_version)
+        : pd_key(primitive_iface->pd()->impl().get(),
+                primitive_iface->engine(), dnnl_get_max_threads())
+        , src_handle(src_handle)
+        , src_version(src_version) {}
+
+    bool operator==(const key_t &other) const {
+        return src_handle == other.src_handle
+                && src_version == other.src_version && pd_key == other.pd_key;
+    }
+
+    primitive_hashing::key_t pd_key;
+    const void *src_handle;
+    uint64_t src_version;
+};
+
+struct key_hash_t {
+    size_t operator()(const key_t &key) const {
+        size_t seed = std::hash<primitive_hashing::key_t>()(key.pd_key);
+        seed = primitive_hashing::hash_combine(seed, key.src_handle);
+        seed = primitive_hashing::hash_combine(seed, key.src_version);
+        return seed;
+    }
+};
+
+struct buffer_t {
+    buffer_t(size_t size) : size(size), data(malloc(size, 64)) {}
+    ~buffer_t() { free(data); }
+
+    const size_t size;
+    void *const data;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(buffer_t);
+};
+
+struct entry_t {
+    entry_t(const key_t &key, const std::shared_ptr<buffer_t> &buffer)
+        : key(key), buffer(buffer) {}
+
+    key_t key;
+    std::shared_ptr<buffer_t> buffer;
+    // Destination the entry was last copied to, used to skip the copy if the
+    // destination has not been changed since then.
+    const void *dst_handle = nullptr;
+    uint64_t dst_version = 0;
+};
+
+struct cache_t {
+    cache_t()
+        : capacity_((size_t)nstl::max(
+                          0, getenv_int("DNNL_REORDER_CACHE_CAPACITY", 0))
+                << 20) {}
+
+    size_t get_capacity() const { return capacity_; }
+
+    void set_capacity(size_t capacity) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        capacity_ = capacity;
+        evict_excess();
+    }
+
+    // Returns the buffer of the entry and the destination it was last copied
+    // to, and marks the entry as the most recently used one.
+    std::shared_ptr<buffer_t> get(const key_t &key, const void *&dst_handle,
+            uint64_t &dst_version) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = mapper_.find(key);
+        if (it == mapper_.end()) return nullptr;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        dst_handle = it->second->dst_handle;
+        dst_version = it->second->dst_version;
+        return it->second->buffer;
+    }
+
+    void add(const key_t &key, const std::shared_ptr<buffer_t> &buffer,
+            const void *dst_handle, uint64_t dst_version) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (buffer->size > capacity_) return;
+        auto it = mapper_.find(key);
+        if (it == mapper_.end()) {
+            entries_.emplace_front(key, buffer);
+            it = mapper_.insert(std::make_pair(key, entries_.begin())).first;
+            size_ += buffer->size;
+        }
+        it->second->dst_handle = dst_handle;
+        it->second->dst_version = dst_version;
+        evict_excess();
+    }
+
+private:
+    void evict_excess() {
+        while (size_ > capacity_ && !entries_.empty()) {
+            size_ -= entries_.back().buffer->size;
+            mapper_.erase(entries_.back().key);
+            entries_.pop_back();
+        }
+    }
+
+    std::mutex mutex_;
+    std::atomic<size_t> capacity_;
+    size_t size_ = 0;
+    std::list<entry_t> entries_;
+    std::unordered_map<key_t, std::list<entry_t>::iterator, key_hash_t>
+            mapper_;
+};
+
+cache_t &cache() {
+    static cache_t c;
+    return c;
+}
+
+void parallel_copy(void *dst, const void *src, size_t size) {
+    const size_t chunk = 64 * 1024;
+    parallel_nd(utils::div_up(size, chunk), [&](size_t i) {
+        const size_t off = i * chunk;
+        memcpy((char *)dst + off, (const char *)src + off,
+                nstl::min(chunk, size - off));
+    });
+}
+
+memory_t *get_arg(const exec_ctx_t &ctx, int arg) {
+    auto it = ctx.args().find(arg);
+    return it == ctx.args().end() ? nullptr : it->second.mem;
+}
+
+} // namespace
+
+bool is_enabled() {
+    return cache().get_capacity() > 0;
+}
+
+status_t execute(const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    memory_t *src = get_arg(ctx, DNNL_ARG_FROM);
+    memory_t *dst = get_arg(ctx, DNNL_ARG_TO);
+    const size_t n_args = 2 + (get_arg(ctx, DNNL_ARG_SCRATCHPAD) ? 1 : 0);
+
+    void *src_handle = nullptr, *dst_handle = nullptr;
+    if (src) CHECK(src->get_data_handle(&src_handle));
+    if (dst) CHECK(dst->get_data_handle(&dst_handle));
+
+    // Runtime scales and zero points are not part of the key, and the data
+    // of the other engines is not accessible here. With post-ops, e.g. sum,
+    // the result also depends on the previous destination data.
+    const size_t size = dst ? memory_desc_wrapper(dst->md()).size() : 0;
+    const auto &post_ops = primitive_iface->pd()->impl()->attr()->post_ops_;
+    const bool cacheable = ctx.args().size() == n_args && src && dst
+            && post_ops.has_default_values()
+            && src->engine()->kind() == engine_kind::cpu
+            && dst->engine()->kind() == engine_kind::cpu && src_handle
+            && dst_handle && src_handle != dst_handle && size > 0
+            && size <= cache().get_capacity();
+    if (!cacheable) {
+        status_t status = primitive_iface->execute(ctx);
+        if (dst) dst->bump_version();
+        return status;
+    }
+
+    const key_t key(primitive_iface, src_handle, src->version());
+    const void *cached_dst_handle = nullptr;
+    uint64_t cached_dst_version = 0;
+    auto buffer = cache().get(key, cached_dst_handle, cached_dst_version);
+    if (buffer) {
+        if (cached_dst_handle == dst_handle
+                && cached_dst_version == dst->version())
+            return status::success;
+        parallel_copy(dst_handle, buffer->data, size);
+        dst->bump_version();
+        cache().add(key, buffer, dst_handle, dst->version());
+        return status::success;
+    }
+
+    CHECK(primitive_iface->execute(ctx));
+    dst->bump_version();
+    buffer = std::make_shared<buffer_t>(size);
+    if (buffer->data == nullptr) return status::success;
+    parallel_copy(buffer->data, dst_handle, size);
+    cache().add(key, buffer, dst_handle, dst->version());
+    return status::success;
+}
+
+} // namespace reorder_cache
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl::impl::status_t dnnl_get_reorder_cache_capacity(int *capacity) {
+    if (capacity == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity = (int)(dnnl::impl::reorder_cache::cache().get_capacity() >> 20);
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_reorder_cache_capacity(int capacity) {
+    if (capacity < 0) return dnnl::impl::status::invalid_arguments;
+    dnnl::impl::reorder_cache::cache().set_capacity((size_t)capacity << 20);
+    return dnnl::impl::status::success;
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_REORDER_CACHE_HPP
+#define COMMON_REORDER_CACHE_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_exec_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace reorder_cache {
+
+// Cache of the results of reorders on CPU engines, disabled by default.
+//
+// An entry holds the destination data of a reorder and is keyed on the
+// primitive (operation descriptor with the source and destination memory
+// descriptors, attributes and implementation), the source data handle and
+// the version of the source memory object, see memory_t::version(). An
+// execution that hits the cache copies the entry to the destination instead
+// of reordering, or does nothing if the destination still holds the entry
+// written by a previous execution.
+//
+// The entries are evicted in the LRU order once their total size exceeds the
+// capacity, set in MiB by DNNL_REORDER_CACHE_CAPACITY or
+// dnnl_set_reorder_cache_capacity().
+
+bool is_enabled();
+
+// Executes a reorder through the cache and updates the version of its
+// destination memory object.
+status_t execute(const primitive_iface_t *primitive_iface, exec_ctx_t &ctx);
+
+} // namespace reorder_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,26 +14,53 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <memory>
-
 #include "engine.hpp"
 #include "utils.hpp"
 
 #include "scratchpad.hpp"
+#include "scratchpad_arena.hpp"
 
 namespace dnnl {
 namespace impl {
 
 namespace {
 
+// Creates a memory storage of at least size bytes. If the buffer is taken
+// from the scratchpad arena, arena_capacity is set to the buffer size and the
+// buffer must be released with release_scratchpad_memory_storage(), otherwise
+// it is set to 0 and the storage owns the buffer.
 memory_storage_t *create_scratchpad_memory_storage(
-        engine_t *engine, size_t size) {
+        engine_t *engine, size_t size, size_t &arena_capacity) {
     memory_storage_t *mem_storage = nullptr;
-    auto status = engine->create_memory_storage(&mem_storage, size);
-    UNUSED(status);
+    arena_capacity = 0;
+    if (!scratchpad_arena::is_enabled(engine)) {
+        auto status = engine->create_memory_storage(&mem_storage, size);
+        UNUSED(status);
+        return mem_storage;
+    }
+
+    size_t capacity = 0;
+    void *ptr = scratchpad_arena::acquire(size, capacity);
+    if (ptr == nullptr) return nullptr;
+    auto status = engine->create_memory_storage(
+            &mem_storage, memory_flags_t::use_runtime_ptr, size, ptr);
+    if (status != status::success) {
+        scratchpad_arena::release(ptr, capacity);
+        return nullptr;
+    }
+    arena_capacity = capacity;
     return mem_storage;
 }
 
+void release_scratchpad_memory_storage(
+        memory_storage_t *mem_storage, size_t arena_capacity) {
+    if (mem_storage == nullptr) return;
+    void *ptr = nullptr;
+    if (arena_capacity) mem_storage->get_data_handle(&ptr);
+    delete mem_storage;
+    if (arena_capacity) scratchpad_arena::release(ptr, arena_capacity);
+}
+
 } // namespace
 
 /*
@@ -42,22 +69,26 @@ memory_storage_t *create_scratchpad_memory_storage(
 */
 struct concurrent_scratchpad_t : public scratchpad_t {
     concurrent_scratchpad_t(engine_t *engine, size_t size) {
-        auto *mem_storage = create_scratchpad_memory_storage(engine, size);
+        mem_storage_ = create_scratchpad_memory_storage(
+                engine, size, arena_capacity_);
         size_ = size;
-        if (mem_storage == nullptr) size_ = 0;
+        if (mem_storage_ == nullptr) size_ = 0;
+    }
 
-        mem_storage_.reset(mem_storage);
+    ~concurrent_scratchpad_t() {
+        release_scratchpad_memory_storage(mem_storage_, arena_capacity_);
     }
 
     const memory_storage_t *get_memory_storage() const override {
-        return mem_storage_.get();
+        return mem_storage_;
     }
 
     size_t size() const override { return size_; }
 
 private:
-    std::unique_ptr<memory_storage_t> mem_storage_;
+    memory_storage_t *mem_storage_;
     size_t size_;
+    size_t arena_capacity_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(concurrent_scratchpad_t);
 };
@@ -71,12 +102,14 @@ struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         UNUSED(engine);
         if (size > size_) {
-            delete mem_storage_;
+            release_scratchpad_memory_storage(mem_storage_, arena_capacity_);
             // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
+            mem_storage_ = create_scratchpad_memory_storage(
+                    engine, size, arena_capacity_);
             if (mem_storage_ == nullptr) {
                 // Recreate scratchpad with original capacity
-                mem_storage_ = create_scratchpad_memory_storage(engine, size_);
+                mem_storage_ = create_scratchpad_memory_storage(
+                        engine, size_, arena_capacity_);
                 if (mem_storage_ == nullptr) size_ = 0;
             } else
                 size_ = size;
@@ -87,9 +120,10 @@ struct global_scratchpad_t : public scratchpad_t {
     ~global_scratchpad_t() {
         reference_count_--;
         if (reference_count_ == 0) {
-            delete mem_storage_;
+            release_scratchpad_memory_storage(mem_storage_, arena_capacity_);
             mem_storage_ = nullptr;
             size_ = 0;
+            arena_capacity_ = 0;
         }
     }
 
@@ -99,9 +133,12 @@ struct global_scratchpad_t : public scratchpad_t {
 
     size_t size() const override { return size_; }
 
+    bool is_global() const override { return true; }
+
 private:
     thread_local static memory_storage_t *mem_storage_;
     thread_local static size_t size_;
+    thread_local static size_t arena_capacity_;
     thread_local static unsigned int reference_count_;
 };
 
@@ -112,6 +149,7 @@ private:
 // Tested by tests/gtests/test_global_scratchad.cpp
 thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
+thread_local size_t global_scratchpad_t::arena_capacity_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
 /*
@@ -27,6 +27,9 @@ struct scratchpad_t {
     virtual ~scratchpad_t() {}
     virtual const memory_storage_t *get_memory_storage() const = 0;
     virtual size_t size() const = 0;
+    // Returns true if the scratchpad is the thread-local global one, which is
+    // only accessible from the thread that created the primitive.
+    virtual bool is_global() const { return false; }
 };
 
 scratchpad_t *create_scratchpad(
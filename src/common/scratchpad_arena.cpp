@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "memory_debug.hpp"
+#include "scratchpad_arena.hpp"
+#include "utils.hpp"
+
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace scratchpad_arena {
+
+namespace {
+
+enum {
+    min_class_log2 = 12, // 4 KiB
+    max_class_log2 = 47,
+    classes_per_log2 = 4,
+    n_classes = (max_class_log2 - min_class_log2) * classes_per_log2 + 1,
+};
+
+const size_t huge_page_size = 2 * 1024 * 1024;
+
+// Index and size of the smallest class that fits size bytes: 4 KiB, then
+// 2^k * {5/4, 6/4, 7/4, 8/4} for k >= 12.
+int get_class(size_t size, size_t &class_size) {
+    if (size <= ((size_t)1 << min_class_log2)) {
+        class_size = (size_t)1 << min_class_log2;
+        return 0;
+    }
+    int k = 0;
+    while (((size - 1) >> (k + 1)) != 0)
+        k++;
+    if (k >= max_class_log2) return -1;
+    const size_t step = (size_t)1 << (k - 2);
+    const size_t n_steps = utils::div_up(size, step); // in [5, 8]
+    class_size = n_steps * step;
+    return 1 + (k - min_class_log2) * classes_per_log2 + (int)n_steps - 5;
+}
+
+struct bucket_t {
+    std::mutex mutex;
+    std::vector<void *> free_list;
+};
+
+struct arena_t {
+    bucket_t buckets[n_classes];
+
+    std::atomic<size_t> in_use_bytes {0};
+    std::atomic<size_t> idle_bytes {0};
+    std::atomic<size_t> peak_bytes {0};
+    std::atomic<uint64_t> hits {0};
+    std::atomic<uint64_t> misses {0};
+
+    // Idle buffers above this limit are returned to the system.
+    const size_t idle_limit = (size_t)getenv_int(
+                                      "DNNL_SCRATCHPAD_ARENA_IDLE_LIMIT_MB",
+                                      1024)
+            << 20;
+
+    void update_peak() {
+        const size_t cur = in_use_bytes + idle_bytes;
+        size_t peak = peak_bytes.load();
+        while (cur > peak && !peak_bytes.compare_exchange_weak(peak, cur)) {}
+    }
+};
+
+arena_t &arena() {
+    // Never destroyed: scratchpads of thread-local and static objects may be
+    // released during the program exit.
+    static arena_t *a = new arena_t();
+    return *a;
+}
+
+void *system_alloc(size_t size) {
+    const bool huge = size >= huge_page_size;
+    void *ptr = impl::malloc(size, huge ? (int)huge_page_size : getpagesize());
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (ptr && huge) madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+    if (ptr && cpu::platform::is_numa_first_touch_enabled())
+        cpu::platform::numa_first_touch(ptr, size);
+    return ptr;
+}
+
+} // namespace
+
+bool is_enabled(engine_t *engine) {
+    // Memory debug mode protects every scratchpad buffer on its own.
+    return engine->kind() == engine_kind::cpu && !memory_debug::is_mem_debug();
+}
+
+void *acquire(size_t size, size_t &capacity) {
+    auto &a = arena();
+    const int c = get_class(size, capacity);
+    if (c < 0) return nullptr;
+
+    void *ptr = nullptr;
+    {
+        auto &b = a.buckets[c];
+        std::lock_guard<std::mutex> guard(b.mutex);
+        if (!b.free_list.empty()) {
+            ptr = b.free_list.back();
+            b.free_list.pop_back();
+        }
+    }
+
+    if (ptr) {
+        a.hits++;
+        a.idle_bytes -= capacity;
+    } else {
+        a.misses++;
+        ptr = system_alloc(capacity);
+        if (ptr == nullptr) return nullptr;
+    }
+    a.in_use_bytes += capacity;
+    a.update_peak();
+    return ptr;
+}
+
+void release(void *ptr, size_t capacity) {
+    if (ptr == nullptr) return;
+    auto &a = arena();
+    size_t class_size = 0;
+    const int c = get_class(capacity, class_size);
+    assert(c >= 0 && class_size == capacity);
+
+    a.in_use_bytes -= capacity;
+    if (a.idle_bytes + capacity > a.idle_limit) {
+        impl::free(ptr);
+        return;
+    }
+
+    a.idle_bytes += capacity;
+    auto &b = a.buckets[c];
+    std::lock_guard<std::mutex> guard(b.mutex);
+    b.free_list.push_back(ptr);
+}
+
+void get_stats(scratchpad_arena_stats_t *stats) {
+    auto &a = arena();
+    stats->in_use_bytes = a.in_use_bytes;
+    stats->idle_bytes = a.idle_bytes;
+    stats->peak_bytes = a.peak_bytes;
+    stats->hits = a.hits;
+    stats->misses = a.misses;
+}
+
+} // namespace scratchpad_arena
+} // namespace impl
+} // namespace dnnl
+
+dnnl::impl::status_t dnnl_get_scratchpad_arena_stats(
+        dnnl::impl::scratchpad_arena_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    dnnl::impl::scratchpad_arena::get_stats(stats);
+    return dnnl::impl::status::success;
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SCRATCHPAD_ARENA_HPP
+#define COMMON_SCRATCHPAD_ARENA_HPP
+
+#include <stddef.h>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace scratchpad_arena {
+
+// Pool of CPU scratchpad buffers shared by all primitives. Requests are
+// rounded up to size classes (four per power of two, so at most 25% is
+// wasted) and released buffers are kept in a free list per class, so
+// creating a primitive or growing the global scratchpad does not go to the
+// system allocator and does not fault in fresh pages when a buffer of the
+// same class was used before.
+//
+// Buffers of 2 MiB and more are aligned to 2 MiB and advised to be backed by
+// transparent huge pages. On NUMA systems the pages of a new buffer are
+// first touched with the balance211_numa() split of the threads, otherwise
+// they are placed by the first touch of the threads computing on it.
+//
+// Free lists are shared rather than per thread: a primitive and its
+// scratchpad are often destroyed by a thread other than the one that created
+// them, which would strand buffers in per-thread lists.
+
+// Returns true if scratchpads of the engine can be taken from the arena.
+bool is_enabled(engine_t *engine);
+
+// Returns a buffer of at least size bytes, its actual size is returned in
+// capacity. Returns nullptr if the system is out of memory.
+void *acquire(size_t size, size_t &capacity);
+
+// Returns a buffer obtained with acquire() to the arena.
+void release(void *ptr, size_t capacity);
+
+void get_stats(scratchpad_arena_stats_t *stats);
+
+} // namespace scratchpad_arena
+} // namespace impl
+} // namespace dnnl
+
+#endif
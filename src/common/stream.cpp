@@ -31,7 +31,8 @@ using namespace dnnl::impl::utils;
 status_t dnnl_stream_create_v2(stream_t **stream, engine_t *engine,
         unsigned flags, const stream_attr_t *attr) {
     bool args_ok = true && !utils::any_null(stream, engine)
-            && flags == stream_flags::default_flags;
+            && utils::one_of(flags, stream_flags::default_order,
+                    stream_flags::in_order, stream_flags::out_of_order);
     if (!args_ok) return invalid_arguments;
 
     return engine->create_stream(stream, flags, attr);
@@ -22,6 +22,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "primitive_exec_types.hpp"
 #include "stream_attr.hpp"
 #include "utils.hpp"
 
@@ -48,6 +49,18 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 
     const dnnl::impl::stream_attr_t *attr() const { return &attr_; }
 
+    /** returns true if the stream executes primitives on its own host
+     * threads, in which case primitive executions are passed to enqueue() */
+    virtual bool is_host_async() const { return false; }
+
+    /** schedules an execution of the primitive with the arguments, to be
+     * completed by wait() */
+    virtual dnnl::impl::status_t enqueue(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_args_t &&args) {
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual void before_exec_hook() {}
     virtual void after_exec_hook() {}
 
@@ -28,6 +28,7 @@
 #include <sys/types.h>
 #endif
 
+#include <atomic>
 #include <climits>
 #include <cstdio>
 #include <cstdlib>
@@ -150,6 +151,18 @@ bool get_jit_dump() {
     return jit_dump.get();
 }
 
+static setting_t<bool> jit_native {true};
+bool get_jit_native() {
+    if (!jit_native.initialized())
+        jit_native.set(!!getenv_int("DNNL_JIT_NATIVE", jit_native.get()));
+    return jit_native.get();
+}
+
+static std::atomic<size_t> jit_code_size {0};
+void add_jit_code_size(size_t size) {
+    jit_code_size += size;
+}
+
 static setting_t<unsigned> jit_profiling_flags {DNNL_JIT_PROFILE_VTUNE};
 unsigned get_jit_profiling_flags() {
     if (!jit_profiling_flags.initialized()) {
@@ -201,6 +214,26 @@ dnnl_status_t dnnl_set_jit_dump(int enabled) {
     return status::success;
 }
 
+dnnl_status_t dnnl_set_jit_native(int enable) {
+    using namespace dnnl::impl;
+    jit_native.set(enable);
+    return status::success;
+}
+
+dnnl_status_t dnnl_get_jit_native(int *enable) {
+    using namespace dnnl::impl;
+    if (enable == nullptr) return status::invalid_arguments;
+    *enable = get_jit_native();
+    return status::success;
+}
+
+dnnl_status_t dnnl_get_jit_code_size(size_t *size) {
+    using namespace dnnl::impl;
+    if (size == nullptr) return status::invalid_arguments;
+    *size = jit_code_size;
+    return status::success;
+}
+
 dnnl_status_t dnnl_set_jit_profiling_flags(unsigned flags) {
     using namespace dnnl::impl;
     unsigned mask = DNNL_JIT_PROFILE_VTUNE;
@@ -498,6 +498,12 @@ int getenv_int(const char *name, int default_value = 0);
 bool get_jit_dump();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
+// Accounts the size in bytes of the code generated by JIT generators.
+void add_jit_code_size(size_t size);
+// Whether the JIT generators emit native instructions where available rather
+// than the instructions translated from the x64 implementation (AArch64 only).
+// Controlled by DNNL_JIT_NATIVE, enabled by default.
+bool get_jit_native();
 FILE *fopen(const char *filename, const char *mode);
 int getpagesize();
 
@@ -75,6 +75,9 @@ int get_verbose() {
         printf("dnnl_verbose,info,cpu,runtime:%s\n",
                 dnnl_runtime2str(dnnl_version()->cpu_runtime));
         printf("dnnl_verbose,info,cpu,isa:%s\n", cpu::platform::get_isa_info());
+        printf("dnnl_verbose,info,cpu,numa_nodes:%d,first_touch:%s\n",
+                cpu::platform::get_num_numa_nodes(),
+                cpu::platform::is_numa_first_touch_enabled() ? "yes" : "no");
         printf("dnnl_verbose,info,gpu,runtime:%s\n",
                 dnnl_runtime2str(dnnl_version()->gpu_runtime));
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
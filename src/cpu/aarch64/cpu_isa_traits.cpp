@@ -18,6 +18,15 @@
 #include <cstring>
 #include <mutex>
 
+#if defined(__linux__)
+#include <sys/prctl.h>
+// Older kernel headers do not define the SVE controls.
+#ifndef PR_SVE_GET_VL
+#define PR_SVE_GET_VL 51
+#define PR_SVE_VL_LEN_MASK 0xffff
+#endif
+#endif
+
 #include "common/utils.hpp"
 
 #include "cpu/aarch64/cpu_isa_traits.hpp"
@@ -202,6 +211,20 @@ cpu_isa_t get_max_cpu_isa_mask(bool soft) {
 #endif
 }
 
+int get_sve_length() {
+    // The vector length of a process does not change unless it is set with
+    // prctl(PR_SVE_SET_VL), which the library never does.
+    static const int sve_length = []() {
+#if defined(__linux__)
+        const int ret = prctl(PR_SVE_GET_VL);
+        return ret < 0 ? 0 : (ret & PR_SVE_VL_LEN_MASK);
+#else
+        return 0;
+#endif
+    }();
+    return sve_length;
+}
+
 status_t set_max_cpu_isa(dnnl_cpu_isa_t isa) {
     using namespace dnnl::impl::status;
 #ifdef DNNL_ENABLE_MAX_CPU_ISA
@@ -80,6 +80,10 @@ enum cpu_isa_t : unsigned {
 const char *get_isa_info();
 
 cpu_isa_t DNNL_API get_max_cpu_isa_mask(bool soft = false);
+
+// Returns the SVE vector length of the calling process in bytes, or 0 if SVE
+// is not available.
+int get_sve_length();
 status_t set_max_cpu_isa(dnnl_cpu_isa_t isa);
 dnnl_cpu_isa_t get_effective_cpu_isa();
 
@@ -198,21 +202,27 @@ static inline bool mayiuse(const cpu_isa_t cpu_isa, bool soft = false) {
     unsigned cpu_isa_mask = aarch64::get_max_cpu_isa_mask(soft);
     if ((cpu_isa_mask & cpu_isa) != cpu_isa) return false;
 
+    // The 512-bit kernels, translated or native, hard-code the vector length
+    // and are only correct on 512-bit SVE implementations.
+    const bool sve_512 = get_sve_length() == cpu_isa_traits<sve>::vlen;
+
     switch (cpu_isa) {
         case sse41: return cpu.has(Cpu::tSSE41);
         case avx: return cpu.has(Cpu::tAVX);
         case avx2: return cpu.has(Cpu::tAVX2);
-        case avx512_common: return cpu.has(Cpu::tAVX512F);
+        case avx512_common: return cpu.has(Cpu::tAVX512F) && sve_512;
         case avx512_core:
             return cpu.has(Cpu::tAVX512F) && cpu.has(Cpu::tAVX512BW)
-                    && cpu.has(Cpu::tAVX512VL) && cpu.has(Cpu::tAVX512DQ);
+                    && cpu.has(Cpu::tAVX512VL) && cpu.has(Cpu::tAVX512DQ)
+                    && sve_512;
         case avx512_core_vnni:
             return cpu.has(Cpu::tAVX512F) && cpu.has(Cpu::tAVX512BW)
                     && cpu.has(Cpu::tAVX512VL) && cpu.has(Cpu::tAVX512DQ)
-                    && cpu.has(Cpu::tAVX512_VNNI);
+                    && cpu.has(Cpu::tAVX512_VNNI) && sve_512;
         case avx512_mic:
             return cpu.has(Cpu::tAVX512F) && cpu.has(Cpu::tAVX512CD)
-                    && cpu.has(Cpu::tAVX512ER) && cpu.has(Cpu::tAVX512PF);
+                    && cpu.has(Cpu::tAVX512ER) && cpu.has(Cpu::tAVX512PF)
+                    && sve_512;
         case avx512_mic_4ops:
             return mayiuse(avx512_mic, soft) && cpu.has(Cpu::tAVX512_4FMAPS)
                     && cpu.has(Cpu::tAVX512_4VNNIW);
@@ -220,14 +230,24 @@ static inline bool mayiuse(const cpu_isa_t cpu_isa, bool soft = false) {
             return mayiuse(avx512_core_vnni, soft)
                     && cpu.has(Cpu::tAVX512_BF16);
         case simd: return true && cpu.has(Cpu::tSIMD);
-        case sve256: return true && cpu.has(Cpu::tSVE);
-        case sve: return true && cpu.has(Cpu::tSVE);
+        case sve256:
+            return cpu.has(Cpu::tSVE)
+                    && get_sve_length() >= cpu_isa_traits<sve256>::vlen;
+        case sve: return cpu.has(Cpu::tSVE) && sve_512;
         case isa_any: return true;
         case isa_all: return false;
     }
     return false;
 }
 
+// Kernels which take the vector length from get_sve_length() when the code
+// is generated run on any SVE implementation. They are enabled by the same
+// max ISA setting as the smallest fixed-length SVE kernels.
+static inline bool mayiuse_sve_any_vl(bool soft = false) {
+    return (get_max_cpu_isa_mask(soft) & sve256) == sve256
+            && cpu.has(Xbyak::util::Cpu::tSVE) && get_sve_length() > 0;
+}
+
 inline bool isa_has_bf16(cpu_isa_t isa) {
     return false;
 }
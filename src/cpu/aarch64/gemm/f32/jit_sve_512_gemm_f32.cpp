@@ -0,0 +1,461 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <mutex>
+
+#include "dnnl_types.h"
+
+#include "common/bfloat16.hpp"
+#include "common/bit_cast.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/gemm/f32/gemm_utils_f32.hpp"
+#include "cpu/gemm/gemm_msan_unpoison.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/gemm/f32/jit_sve_512_gemm_f32.hpp"
+#include "cpu/aarch64/gemm/f32/jit_sve_512_gemm_f32_kern.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+using namespace gemm_utils;
+
+namespace sve_512_gemm_f32 {
+
+using kern_t = jit_sve_512_gemm_f32_kern;
+
+constexpr dim_t unroll_m = kern_t::unroll_m;
+constexpr dim_t unroll_n = kern_t::unroll_n;
+
+// Cache blocking for A64FX: a kc x unroll_n micro-panel of B stays in L1 while
+// the packed mc x kc block of A is streamed from the core's share of the CMG
+// L2. The packed kc x nc block of B is reused across all A blocks.
+blocking_t get_blocking() {
+    static blocking_t blk = [] {
+        blocking_t b;
+        const dim_t l1_size = platform::get_A64FX_cache_size(1, true, 1);
+        const dim_t l2_size = platform::get_A64FX_cache_size(2, true, 1);
+
+        b.kc = nstl::max(dim_t(kern_t::unroll_k),
+                rnd_dn(l1_size / 4 / (unroll_n * (dim_t)sizeof(float)),
+                        dim_t(kern_t::unroll_k)));
+        b.kc = nstl::min(b.kc, dim_t(384));
+        b.mc = rnd_dn(l2_size / 2 / (b.kc * (dim_t)sizeof(float)), unroll_m);
+        b.mc = nstl::max(unroll_m, nstl::min(b.mc, 10 * unroll_m));
+        b.nc = rnd_up(4 * b.mc, unroll_n);
+        return b;
+    }();
+    return blk;
+}
+
+const kern_t *get_kern(bool beta_zero) {
+    static std::unique_ptr<kern_t> kernel_table[2];
+    static std::once_flag initialized;
+    std::call_once(initialized, [] {
+        for (bool b0 : {false, true})
+            kernel_table[b0].reset(new kern_t(b0));
+    });
+    return kernel_table[beta_zero].get();
+}
+
+// The bf16 sources are widened to f32 while their panels are packed, so the
+// conversion is inlined rather than a call to the bfloat16_t operator.
+inline float to_f32(float v) {
+    return v;
+}
+inline float to_f32(bfloat16_t v) {
+    return utils::bit_cast<float>((uint32_t)v.raw_bits_ << 16);
+}
+
+// Packs an m x k block of op(A) into unroll_m-row panels, each laid out as
+// k consecutive columns of unroll_m elements. Alpha is folded in here and
+// rows past m are zero-filled so that the microkernel never needs a tail.
+template <typename data_t>
+void copy_a(bool isTransA, dim_t m, dim_t k, const data_t *a, dim_t lda,
+        float alpha, float *ws) {
+    for (dim_t i0 = 0; i0 < m; i0 += unroll_m) {
+        const dim_t mu = nstl::min(unroll_m, m - i0);
+        float *panel = ws + i0 * k;
+        if (!isTransA) {
+            for (dim_t p = 0; p < k; p++) {
+                const data_t *a_p = a + i0 + p * lda;
+                float *w = panel + p * unroll_m;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < mu; i++)
+                    w[i] = alpha * to_f32(a_p[i]);
+                for (dim_t i = mu; i < unroll_m; i++)
+                    w[i] = 0.f;
+            }
+        } else {
+            for (dim_t i = 0; i < mu; i++) {
+                const data_t *a_i = a + (i0 + i) * lda;
+                for (dim_t p = 0; p < k; p++)
+                    panel[p * unroll_m + i] = alpha * to_f32(a_i[p]);
+            }
+            for (dim_t p = 0; p < k; p++)
+                for (dim_t i = mu; i < unroll_m; i++)
+                    panel[p * unroll_m + i] = 0.f;
+        }
+    }
+}
+
+// Packs a k x n block of op(B) into unroll_n-column panels, each laid out as
+// k consecutive rows of unroll_n elements with zero-filled tail columns.
+template <typename data_t>
+void copy_b(bool isTransB, dim_t n, dim_t k, const data_t *b, dim_t ldb,
+        float *ws) {
+    for (dim_t j0 = 0; j0 < n; j0 += unroll_n) {
+        const dim_t nu = nstl::min(unroll_n, n - j0);
+        float *panel = ws + j0 * k;
+        if (!isTransB) {
+            for (dim_t j = 0; j < nu; j++) {
+                const data_t *b_j = b + (j0 + j) * ldb;
+                for (dim_t p = 0; p < k; p++)
+                    panel[p * unroll_n + j] = to_f32(b_j[p]);
+            }
+        } else {
+            for (dim_t p = 0; p < k; p++) {
+                const data_t *b_p = b + j0 + p * ldb;
+                PRAGMA_OMP_SIMD()
+                for (dim_t j = 0; j < nu; j++)
+                    panel[p * unroll_n + j] = to_f32(b_p[j]);
+            }
+        }
+        for (dim_t p = 0; p < k; p++)
+            for (dim_t j = nu; j < unroll_n; j++)
+                panel[p * unroll_n + j] = 0.f;
+    }
+}
+
+template void copy_a(bool isTransA, dim_t m, dim_t k, const float *a,
+        dim_t lda, float alpha, float *ws);
+template void copy_a(bool isTransA, dim_t m, dim_t k, const bfloat16_t *a,
+        dim_t lda, float alpha, float *ws);
+template void copy_b(bool isTransB, dim_t n, dim_t k, const float *b,
+        dim_t ldb, float *ws);
+template void copy_b(bool isTransB, dim_t n, dim_t k, const bfloat16_t *b,
+        dim_t ldb, float *ws);
+
+// Computes a full tile from the packed panels like the microkernel does, for
+// the bf16 GEMM on cores with SVE vectors shorter than 512 bits.
+void ref_kern(const jit_sve_512_gemm_f32_call_s *p, bool beta_zero) {
+    const dim_t ldc = p->ldc / sizeof(float);
+    for (dim_t j = 0; j < unroll_n; j++) {
+        float acc[unroll_m] = {0.f};
+        for (dim_t l = 0; l < p->k; l++) {
+            const float *a_l = p->a + l * unroll_m;
+            const float b_lj = p->b[l * unroll_n + j];
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < unroll_m; i++)
+                acc[i] += a_l[i] * b_lj;
+        }
+        float *c_j = p->c + j * ldc;
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < unroll_m; i++)
+            c_j[i] = beta_zero ? acc[i] : c_j[i] + acc[i];
+    }
+}
+
+void block_ker(dim_t m, dim_t n, dim_t k, const float *a_pack,
+        const float *b_pack, float *c, dim_t ldc, float beta) {
+    const bool use_jit = mayiuse(sve);
+    const kern_t *ker_b0 = use_jit ? get_kern(true) : nullptr;
+    const kern_t *ker_b1 = use_jit ? get_kern(false) : nullptr;
+    auto ker = [&](jit_sve_512_gemm_f32_call_s *p, bool beta_zero) {
+        if (use_jit)
+            (beta_zero ? *ker_b0 : *ker_b1)(p);
+        else
+            ref_kern(p, beta_zero);
+    };
+
+    float c_tail[unroll_m * unroll_n];
+
+    for (dim_t j = 0; j < n; j += unroll_n) {
+        const dim_t nu = nstl::min(unroll_n, n - j);
+        for (dim_t i = 0; i < m; i += unroll_m) {
+            const dim_t mu = nstl::min(unroll_m, m - i);
+            float *c_ij = c + i + j * ldc;
+
+            jit_sve_512_gemm_f32_call_s p;
+            p.a = a_pack + i * k;
+            p.b = b_pack + j * k;
+            p.k = k;
+
+            if (mu == unroll_m && nu == unroll_n) {
+                if (beta != 0.f && beta != 1.f) {
+                    for (dim_t jj = 0; jj < unroll_n; jj++) {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t ii = 0; ii < unroll_m; ii++)
+                            c_ij[ii + jj * ldc] *= beta;
+                    }
+                }
+                p.c = c_ij;
+                p.ldc = ldc * sizeof(float);
+                ker(&p, beta == 0.f);
+            } else {
+                p.c = c_tail;
+                p.ldc = unroll_m * sizeof(float);
+                ker(&p, true);
+                for (dim_t jj = 0; jj < nu; jj++) {
+                    float *c_j = c_ij + jj * ldc;
+                    const float *t_j = c_tail + jj * unroll_m;
+                    if (beta == 0.f) {
+                        for (dim_t ii = 0; ii < mu; ii++)
+                            c_j[ii] = t_j[ii];
+                    } else {
+                        for (dim_t ii = 0; ii < mu; ii++)
+                            c_j[ii] = beta * c_j[ii] + t_j[ii];
+                    }
+                }
+            }
+        }
+    }
+}
+
+size_t ws_elems_per_thr() {
+    const blocking_t blk = get_blocking();
+    return (size_t)(blk.mc + blk.nc) * blk.kc;
+}
+
+template <typename data_t>
+void sgemm_ithr(bool isTransA, bool isTransB, dim_t m, dim_t n, dim_t k,
+        float alpha, const data_t *a, dim_t lda, const data_t *b, dim_t ldb,
+        float beta, float *c, dim_t ldc, float *ws) {
+    if (m <= 0 || n <= 0) return;
+
+    if (k <= 0 || alpha == 0.f) {
+        for (dim_t j = 0; j < n; j++) {
+            float *c_j = c + j * ldc;
+            if (beta == 0.f) {
+                for (dim_t i = 0; i < m; i++)
+                    c_j[i] = 0.f;
+            } else if (beta != 1.f) {
+                for (dim_t i = 0; i < m; i++)
+                    c_j[i] *= beta;
+            }
+        }
+        return;
+    }
+
+    const blocking_t blk = get_blocking();
+    float *a_pack = ws;
+    float *b_pack = ws + blk.mc * blk.kc;
+
+    dim_t size_k;
+    for (dim_t Bk = 0; Bk < k; Bk += size_k) {
+        size_k = k - Bk;
+        if (size_k >= 2 * blk.kc)
+            size_k = blk.kc;
+        else if (size_k > blk.kc)
+            size_k = (size_k + 1) / 2;
+
+        const float cur_beta = Bk == 0 ? beta : 1.f;
+
+        for (dim_t Bn = 0; Bn < n; Bn += blk.nc) {
+            const dim_t size_n = nstl::min(blk.nc, n - Bn);
+            const data_t *cur_b
+                    = isTransB ? b + Bn + Bk * ldb : b + Bk + Bn * ldb;
+            copy_b(isTransB, size_n, size_k, cur_b, ldb, b_pack);
+
+            for (dim_t Bm = 0; Bm < m; Bm += blk.mc) {
+                const dim_t size_m = nstl::min(blk.mc, m - Bm);
+                const data_t *cur_a
+                        = isTransA ? a + Bk + Bm * lda : a + Bm + Bk * lda;
+                copy_a(isTransA, size_m, size_k, cur_a, lda, alpha, a_pack);
+
+                block_ker(size_m, size_n, size_k, a_pack, b_pack,
+                        c + Bm + Bn * ldc, ldc, cur_beta);
+            }
+        }
+    }
+}
+
+template <typename data_t>
+dnnl_status_t gemm_driver(const char *transa, const char *transb,
+        const dim_t *p_m, const dim_t *p_n, const dim_t *p_k,
+        const float *p_alpha, const data_t *A, const dim_t *p_lda,
+        const data_t *B, const dim_t *p_ldb, const float *p_beta, float *C,
+        const dim_t *p_ldc, const float *bias) {
+
+    if (!(utils::one_of(*transa, 'n', 'N', 't', 'T')
+                && utils::one_of(*transb, 'n', 'N', 't', 'T')))
+        return dnnl_unimplemented;
+
+    const bool isTransA = (*transa == 'T' || *transa == 't');
+    const bool isTransB = (*transb == 'T' || *transb == 't');
+    const dim_t m = *p_m, n = *p_n, k = *p_k;
+    const dim_t lda = *p_lda, ldb = *p_ldb, ldc = *p_ldc;
+    const float alpha = *p_alpha, beta = *p_beta;
+
+    if (m <= 0 || n <= 0) return dnnl_success;
+
+    int nthr_to_use = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+    int nthr_m = 1, nthr_n = 1, nthr_k = 1;
+    dim_t MB, NB, KB;
+
+    // Determine threading partitioning
+    calc_nthr_nocopy_avx512_common(
+            m, n, k, nthr_to_use, &nthr_m, &nthr_n, &nthr_k, &MB, &NB, &KB);
+    assert(IMPLICATION(!dnnl_thr_syncable(), nthr_k == 1));
+
+    float *c_buffers = nullptr;
+    if (nthr_k > 1) {
+        c_buffers = (float *)malloc(
+                sizeof(*c_buffers) * nthr_m * nthr_n * (nthr_k - 1) * MB * NB,
+                PAGE_4K);
+        if (!c_buffers) {
+            nthr_k = 1;
+            KB = k;
+        }
+    }
+
+    const int nthr_mn = nthr_m * nthr_n;
+    nthr_to_use = nthr_mn * nthr_k;
+
+    const size_t ws_size_per_thr
+            = rnd_up(ws_elems_per_thr() * sizeof(float), PAGE_4K);
+    float *ws_buffers
+            = (float *)malloc(nthr_to_use * ws_size_per_thr, PAGE_4K);
+    if (!ws_buffers) {
+        free(c_buffers);
+        return dnnl_out_of_memory;
+    }
+
+    auto get_thr_block = [&](dim_t &from, dim_t &to, dim_t &myN, dim_t NB,
+                                 dim_t N, int ithr) {
+        from = NB * (ithr);
+        to = NB * (ithr + 1);
+        if (to > N) to = N;
+        myN = to - from;
+    };
+
+    parallel(nthr_to_use, [&](int ithr, int nthr) {
+        assert(nthr_to_use == nthr);
+        MAYBE_UNUSED(nthr);
+
+        const int ithr_mn = ithr % nthr_mn;
+        const int ithr_m = ithr_mn % nthr_m;
+        const int ithr_n = ithr_mn / nthr_m;
+        const int ithr_k = ithr / nthr_mn;
+
+        const int cbase = (ithr_m + nthr_m * ithr_n) * (nthr_k - 1);
+
+        float *ws = ws_buffers + ithr * ws_size_per_thr / sizeof(float);
+
+        dim_t m_from = 0, m_to = 0, myM = 0, n_from = 0, n_to = 0, myN = 0,
+              k_from = 0, k_to = 0, myK = 0;
+
+        get_thr_block(m_from, m_to, myM, MB, m, ithr_m);
+        get_thr_block(n_from, n_to, myN, NB, n, ithr_n);
+        get_thr_block(k_from, k_to, myK, KB, k, ithr_k);
+
+        if (myM > 0 && myN > 0) {
+            float myBeta, *myC;
+            dim_t ld;
+            if (ithr_k == 0) {
+                myC = &(C[m_from + n_from * ldc]);
+                myBeta = beta;
+                ld = ldc;
+            } else {
+                myC = c_buffers + MB * NB * (cbase + ithr_k - 1);
+                myBeta = 0.0f;
+                ld = MB;
+            }
+            const data_t *myA = isTransA ? &(A[k_from + m_from * lda])
+                                        : &(A[m_from + k_from * lda]);
+            const data_t *myB = isTransB ? &(B[n_from + k_from * ldb])
+                                        : &(B[k_from + n_from * ldb]);
+
+            sgemm_ithr(isTransA, isTransB, myM, myN, myK, alpha, myA, lda,
+                    myB, ldb, myBeta, myC, ld, ws);
+        }
+    });
+
+    if (nthr_k > 1) {
+        parallel(nthr_to_use, [&](int ithr, int nthr) {
+            assert(nthr_to_use == nthr);
+            MAYBE_UNUSED(nthr);
+
+            const int ithr_mn = ithr % nthr_mn;
+            const int ithr_m = ithr_mn % nthr_m;
+            const int ithr_k = ithr / nthr_mn;
+            const int ithr_n = ithr_mn / nthr_m;
+
+            dim_t n_from = 0, n_to = 0, myN = 0;
+            dim_t m_from = 0, m_to = 0, myM = 0;
+
+            const int cbase = (ithr_m + nthr_m * ithr_n) * (nthr_k - 1);
+
+            get_thr_block(n_from, n_to, myN, NB, n, ithr_n);
+            get_thr_block(m_from, m_to, myM, MB, m, ithr_m);
+
+            // sum matrices partitioned along K dimension
+            dim_t offset = 0, block = 0;
+            partition_unit_diff(ithr_k, nthr_k, myN, &offset, &block);
+            for (int ik = 1; ik < nthr_k; ++ik) {
+                float *myC = c_buffers
+                        + MB * ((dim_t)NB * (cbase + ik - 1) + offset);
+
+                sum_two_matrices(myM, block, myC, MB,
+                        &C[m_from + (n_from + offset) * ldc], ldc);
+            }
+        });
+    }
+
+    if (bias) {
+        parallel_nd(n, m, [&](dim_t j, dim_t i) { C[j * ldc + i] += bias[i]; });
+    }
+
+    free(ws_buffers);
+    free(c_buffers);
+
+    msan_unpoison_matrix(C, m, n, ldc, sizeof(*C));
+
+    return dnnl_success;
+}
+
+} // namespace sve_512_gemm_f32
+
+dnnl_status_t jit_sve_512_gemm_f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc, const float *bias) {
+    return sve_512_gemm_f32::gemm_driver(transa, transb, M, N, K, alpha, A,
+            lda, B, ldb, beta, C, ldc, bias);
+}
+
+dnnl_status_t jit_sve_512_gemm_bf16bf16f32(const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const bfloat16_t *A, const dim_t *lda,
+        const bfloat16_t *B, const dim_t *ldb, const float *beta, float *C,
+        const dim_t *ldc) {
+    return sve_512_gemm_f32::gemm_driver(transa, transb, M, N, K, alpha, A,
+            lda, B, ldb, beta, C, ldc, (const float *)nullptr);
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
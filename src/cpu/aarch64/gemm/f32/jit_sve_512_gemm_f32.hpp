@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_F32_JIT_SVE_512_GEMM_F32_HPP
+#define CPU_AARCH64_GEMM_F32_JIT_SVE_512_GEMM_F32_HPP
+
+#include "dnnl_types.h"
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+
+#include "cpu/gemm/f32/gemm_utils_f32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace sve_512_gemm_f32 {
+
+struct blocking_t {
+    dim_t mc, nc, kc;
+};
+
+blocking_t get_blocking();
+
+// Packing and block-level compute routines, shared with the packed gemm API.
+// The panels are always f32, bf16 sources are converted while packing.
+template <typename data_t>
+void copy_a(bool isTransA, dim_t m, dim_t k, const data_t *a, dim_t lda,
+        float alpha, float *ws);
+template <typename data_t>
+void copy_b(bool isTransB, dim_t n, dim_t k, const data_t *b, dim_t ldb,
+        float *ws);
+void block_ker(dim_t m, dim_t n, dim_t k, const float *a_pack,
+        const float *b_pack, float *c, dim_t ldc, float beta);
+
+} // namespace sve_512_gemm_f32
+
+// Column-major sgemm with packing of A and B panels and an SVE-512 JIT
+// microkernel. Only 'N' and 'T' transpositions are supported.
+dnnl_status_t jit_sve_512_gemm_f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc,
+        const float *bias = nullptr);
+
+// Same driver for bf16 A and B, the panels are converted to f32 as they are
+// packed so no converted copy of A or B is made. On cores with SVE vectors
+// shorter than 512 bits the tiles are computed without the JIT microkernel.
+dnnl_status_t jit_sve_512_gemm_bf16bf16f32(const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const bfloat16_t *A, const dim_t *lda,
+        const bfloat16_t *B, const dim_t *ldb, const float *beta, float *C,
+        const dim_t *ldc);
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_GEMM_F32_JIT_SVE_512_GEMM_F32_HPP
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_F32_JIT_SVE_512_GEMM_F32_KERN_HPP
+#define CPU_AARCH64_GEMM_F32_JIT_SVE_512_GEMM_F32_KERN_HPP
+
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_sve_512_gemm_f32_call_s {
+    const float *a; // packed A panel: k x unroll_m, alpha already applied
+    const float *b; // packed B panel: k x unroll_n
+    float *c;
+    dim_t ldc; // in bytes
+    dim_t k;
+};
+
+// Register-blocked microkernel computing a full unroll_m x unroll_n tile of C
+// from packed A and B panels. Accumulators occupy 3 x 8 zmm-sized SVE
+// registers; the remaining 8 registers hold the A column and the broadcast B
+// values. When beta_zero is false the tile is accumulated into C (beta == 1),
+// any other beta has to be applied by the caller.
+struct jit_sve_512_gemm_f32_kern : public jit_generator {
+    enum {
+        typesize = sizeof(float),
+        simd_w = 16,
+        n_m_regs = 3,
+        unroll_m = n_m_regs * simd_w,
+        unroll_n = 8,
+        unroll_k = 4,
+    };
+
+    jit_sve_512_gemm_f32_kern(bool beta_zero);
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_512_gemm_f32_kern)
+
+    void operator()(jit_sve_512_gemm_f32_call_s *p) const { ker_(p); }
+
+private:
+    using reg64_t = const xa::XReg;
+
+    void (*ker_)(jit_sve_512_gemm_f32_call_s *);
+    const bool beta_zero_;
+
+    reg64_t param = abi_param1_aarch64;
+    reg64_t reg_a = x1;
+    reg64_t reg_b = x2;
+    reg64_t reg_c = x3;
+    reg64_t reg_ldc = x5;
+    reg64_t reg_k = x6;
+    reg64_t reg_c_col = x7;
+    reg64_t reg_tmp_imm = x17;
+
+    const xa::PReg reg_p_all_ones = p2;
+
+    enum {
+        acc_base_idx = 0,
+        a_base_idx = n_m_regs * unroll_n,
+        b_base_idx = a_base_idx + n_m_regs,
+        n_b_regs = 32 - b_base_idx,
+    };
+
+    xa::ZReg zreg_acc(int n, int m) const {
+        return xa::ZReg(acc_base_idx + n * n_m_regs + m);
+    }
+    xa::ZRegS zreg_acc_s(int n, int m) const {
+        return xa::ZRegS(acc_base_idx + n * n_m_regs + m);
+    }
+    xa::ZRegS zreg_a_s(int m) const { return xa::ZRegS(a_base_idx + m); }
+    xa::ZRegS zreg_b_s(int n) const {
+        return xa::ZRegS(b_base_idx + n % n_b_regs);
+    }
+
+    void fma_step(int uk);
+    void store_tile();
+    void generate();
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_GEMM_F32_JIT_SVE_512_GEMM_F32_KERN_HPP
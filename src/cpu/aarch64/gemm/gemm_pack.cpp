@@ -0,0 +1,535 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/simple_q10n.hpp"
+
+#include "cpu/gemm/gemm_msan_unpoison.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/gemm/f32/jit_sve_512_gemm_f32.hpp"
+#include "cpu/aarch64/gemm/f32/jit_sve_512_gemm_f32_kern.hpp"
+#include "cpu/aarch64/gemm/gemm_pack.hpp"
+#include "cpu/aarch64/gemm/gemm_pack_storage.hpp"
+#include "cpu/aarch64/gemm/gemm_partition.hpp"
+#include "cpu/aarch64/gemm/s8x8s32/jit_sve_512_gemm_s8x8s32.hpp"
+#include "cpu/aarch64/gemm/s8x8s32/jit_sve_512_gemm_s8x8s32_kern.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+
+namespace {
+
+using f32_kern_t = jit_sve_512_gemm_f32_kern;
+using s8_kern_t = jit_sve_512_gemm_s8x8s32_kern;
+
+bool is_trans(char trans) {
+    return trans == 'T' || trans == 't';
+}
+
+bool is_packed(char trans) {
+    return trans == 'P' || trans == 'p';
+}
+
+dnnl_status_t get_matrix_id(const char *identifier, matrix_id &which) {
+    if (one_of(*identifier, 'a', 'A'))
+        which = matrix_id::a;
+    else if (one_of(*identifier, 'b', 'B'))
+        which = matrix_id::b;
+    else
+        return dnnl_invalid_arguments;
+    return dnnl_success;
+}
+
+// Sets up the header describing the packed op(A) or op(B) of an m x n x k
+// problem for the given microkernel.
+template <typename kern_t, typename blocking_t>
+dnnl_status_t init_pack_header(gemm_pack_storage_t::header_t &h,
+        const char *identifier, const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, dim_t k_group,
+        size_t typesize, bool has_sums, const blocking_t &blk) {
+    if (!mayiuse(sve)) return dnnl_unimplemented;
+
+    matrix_id which;
+    dnnl_status_t st = get_matrix_id(identifier, which);
+    if (st != dnnl_success) return st;
+
+    if (!one_of(*transa, 'n', 'N', 't', 'T')
+            || !one_of(*transb, 'n', 'N', 't', 'T'))
+        return dnnl_invalid_arguments;
+    if (*M < 0 || *N < 0 || *K < 0) return dnnl_invalid_arguments;
+
+    if (which == matrix_id::a)
+        gemm_pack_storage_t::init_header(h, which, *M, *K, kern_t::unroll_m,
+                blk.kc, k_group, typesize, has_sums);
+    else
+        gemm_pack_storage_t::init_header(h, which, *N, *K, kern_t::unroll_n,
+                blk.kc, k_group, typesize, has_sums);
+    return dnnl_success;
+}
+
+dnnl_status_t init_sgemm_header(gemm_pack_storage_t::header_t &h,
+        const char *identifier, const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K) {
+    return init_pack_header<f32_kern_t>(h, identifier, transa, transb, M, N, K,
+            1, sizeof(float), false, sve_512_gemm_f32::get_blocking());
+}
+
+dnnl_status_t init_gemm_s8u8s32_header(gemm_pack_storage_t::header_t &h,
+        const char *identifier, const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K) {
+    return init_pack_header<s8_kern_t>(h, identifier, transa, transb, M, N, K,
+            s8_kern_t::k_group, sizeof(int8_t), true,
+            sve_512_gemm_s8x8s32::get_blocking());
+}
+
+// Packs all (k block, panel) pairs of the matrix in parallel with
+// pack_panel(k0, i0, size_k, size_i).
+template <typename F>
+void pack_panels(const gemm_pack_storage_t::header_t &h, dim_t unroll,
+        F pack_panel) {
+    const dim_t nblk_k = div_up(h.k, h.kc);
+    const dim_t nblk_i = div_up(h.outer, unroll);
+
+    parallel_nd(nblk_k, nblk_i, [&](dim_t kb, dim_t ib) {
+        const dim_t k0 = kb * h.kc;
+        const dim_t i0 = ib * unroll;
+        pack_panel(k0, i0, nstl::min(h.kc, h.k - k0),
+                nstl::min(unroll, h.outer - i0));
+    });
+}
+
+// Validates a packed operand of compute against the problem sizes.
+bool packed_matches(const gemm_pack_storage_t &packed, matrix_id which,
+        dim_t outer, dim_t k) {
+    return packed.which() == which && packed.outer() == outer
+            && packed.k() == k;
+}
+
+// Runs f(m_from, m_to, n_from, n_to, ithr) over a 2D split of the output.
+// Ranges always start on a panel boundary of the packed operands.
+template <typename F>
+void parallel_mn(int max_nthr, dim_t m, dim_t n, dim_t unroll_m,
+        dim_t unroll_n, F f) {
+    int nthr_m = 1, nthr_n = 1;
+    partition_2d(m, n, unroll_m, unroll_n, max_nthr, nthr_m, nthr_n);
+    const int nthr_to_use = nthr_m * nthr_n;
+
+    const dim_t MB = rnd_up(div_up(m, nthr_m), unroll_m);
+    const dim_t NB = rnd_up(div_up(n, nthr_n), unroll_n);
+
+    parallel(nthr_to_use, [&](int ithr, int nthr) {
+        assert(nthr_to_use == nthr);
+        MAYBE_UNUSED(nthr);
+
+        const int ithr_m = ithr % nthr_m;
+        const int ithr_n = ithr / nthr_m;
+
+        const dim_t m_from = MB * ithr_m;
+        const dim_t m_to = nstl::min(m, m_from + MB);
+        const dim_t n_from = NB * ithr_n;
+        const dim_t n_to = nstl::min(n, n_from + NB);
+        if (m_from >= m_to || n_from >= n_to) return;
+
+        f(m_from, m_to, n_from, n_to, ithr);
+    });
+}
+
+// Operand of compute: either a packed buffer or a plain column-major matrix
+// that is copied block by block like in the non-packed drivers.
+template <typename data_t>
+struct operand_t {
+    bool packed;
+    bool trans;
+    const data_t *ptr;
+    dim_t ld;
+    gemm_pack_storage_t storage;
+
+    operand_t(const char *trans_c, const data_t *p, const dim_t *ld_p)
+        : packed(is_packed(*trans_c))
+        , trans(is_trans(*trans_c))
+        , ptr(p)
+        , ld(*ld_p)
+        , storage(p) {}
+};
+
+// Pointers to element (i, k) of op(A) and (k, j) of op(B) of a non-packed
+// operand.
+template <typename data_t>
+const data_t *plain_a(const operand_t<data_t> &a, dim_t i, dim_t k) {
+    return a.trans ? a.ptr + k + i * a.ld : a.ptr + i + k * a.ld;
+}
+
+template <typename data_t>
+const data_t *plain_b(const operand_t<data_t> &b, dim_t k, dim_t j) {
+    return b.trans ? b.ptr + j + k * b.ld : b.ptr + k + j * b.ld;
+}
+
+template <typename a_dt, typename b_dt>
+dnnl_status_t check_compute_args(const operand_t<a_dt> &a,
+        const operand_t<b_dt> &b, const char *transa, const char *transb,
+        dim_t m, dim_t n, dim_t k) {
+    if (!mayiuse(sve)) return dnnl_unimplemented;
+    if (!a.packed && !b.packed) return dnnl_invalid_arguments;
+    if (!a.packed && !one_of(*transa, 'n', 'N', 't', 'T'))
+        return dnnl_invalid_arguments;
+    if (!b.packed && !one_of(*transb, 'n', 'N', 't', 'T'))
+        return dnnl_invalid_arguments;
+    if (a.packed && !packed_matches(a.storage, matrix_id::a, m, k))
+        return dnnl_invalid_arguments;
+    if (b.packed && !packed_matches(b.storage, matrix_id::b, n, k))
+        return dnnl_invalid_arguments;
+    return dnnl_success;
+}
+
+size_t sgemm_compute_ws_size() {
+    const auto blk = sve_512_gemm_f32::get_blocking();
+    return rnd_up((size_t)(blk.mc + blk.nc) * blk.kc * sizeof(float), PAGE_4K);
+}
+
+// Computes the block of C starting at (m0, n0). Packed operands are used in
+// place, the others are copied into ws as in the non-packed driver.
+void sgemm_compute_ithr(const operand_t<float> &a, const operand_t<float> &b,
+        dim_t m0, dim_t m, dim_t n0, dim_t n, dim_t k, float beta, float *c,
+        dim_t ldc, float *ws) {
+    using namespace sve_512_gemm_f32;
+
+    const auto blk = get_blocking();
+    float *a_ws = ws;
+    float *b_ws = ws + blk.mc * blk.kc;
+
+    for (dim_t Bk = 0; Bk < k; Bk += blk.kc) {
+        const dim_t size_k = nstl::min(blk.kc, k - Bk);
+        const float cur_beta = Bk == 0 ? beta : 1.f;
+
+        for (dim_t Bn = 0; Bn < n; Bn += blk.nc) {
+            const dim_t size_n = nstl::min(blk.nc, n - Bn);
+            const float *b_pack = b_ws;
+            if (b.packed)
+                b_pack = b.storage.matrix<float>(Bk, n0 + Bn);
+            else
+                copy_b(b.trans, size_n, size_k, plain_b(b, Bk, n0 + Bn), b.ld,
+                        b_ws);
+
+            for (dim_t Bm = 0; Bm < m; Bm += blk.mc) {
+                const dim_t size_m = nstl::min(blk.mc, m - Bm);
+                const float *a_pack = a_ws;
+                if (a.packed)
+                    a_pack = a.storage.matrix<float>(Bk, m0 + Bm);
+                else
+                    copy_a(a.trans, size_m, size_k, plain_a(a, m0 + Bm, Bk),
+                            a.ld, 1.0f, a_ws);
+
+                block_ker(size_m, size_n, size_k, a_pack, b_pack,
+                        c + Bm + Bn * ldc, ldc, cur_beta);
+            }
+        }
+    }
+}
+
+size_t s8u8s32_compute_ws_size() {
+    const auto blk = sve_512_gemm_s8x8s32::get_blocking();
+    const size_t pack_size = (size_t)(blk.mc + blk.nc) * blk.kc;
+    const size_t comp_size
+            = (size_t)2 * (blk.mc + blk.nc) * sizeof(int32_t);
+    return rnd_up(pack_size, PAGE_4K) + rnd_up(comp_size, PAGE_4K);
+}
+
+// Integer counterpart of sgemm_compute_ithr. Sums along k of the packed
+// operands come from their buffers, the others are summed while copying.
+void gemm_s8u8s32_compute_ithr(const operand_t<int8_t> &a,
+        const operand_t<uint8_t> &b, char offsetc, dim_t m0, dim_t m,
+        dim_t n0, dim_t n, dim_t k, bool beta_zero, int32_t *c, dim_t ldc,
+        const int32_t *co, char *ws) {
+    using namespace sve_512_gemm_s8x8s32;
+
+    const auto blk = get_blocking();
+    int8_t *a_ws = (int8_t *)ws;
+    int8_t *b_ws = a_ws + blk.mc * blk.kc;
+    int32_t *row_sum_ws = (int32_t *)(ws
+            + rnd_up((size_t)(blk.mc + blk.nc) * blk.kc, PAGE_4K));
+    int32_t *col_sum_ws = row_sum_ws + blk.mc;
+    int32_t *row_comp = col_sum_ws + blk.nc;
+    int32_t *col_comp = row_comp + blk.mc;
+
+    const bool OCisR = (offsetc == 'R' || offsetc == 'r');
+    const bool OCisC = (offsetc == 'C' || offsetc == 'c');
+
+    for (dim_t Bk = 0; Bk < k; Bk += blk.kc) {
+        const dim_t size_k = nstl::min(blk.kc, k - Bk);
+        const bool first_k = Bk == 0;
+
+        for (dim_t Bn = 0; Bn < n; Bn += blk.nc) {
+            const dim_t size_n = nstl::min(blk.nc, n - Bn);
+            const int8_t *b_pack = b_ws;
+            if (b.packed)
+                b_pack = b.storage.matrix<int8_t>(Bk, n0 + Bn);
+            else
+                copy_b_sum<uint8_t>(b.trans, size_n, size_k,
+                        plain_b(b, Bk, n0 + Bn), b.ld, b_ws, col_sum_ws);
+
+            // There are no A and B offsets in compute, so only the C offset
+            // goes to the column compensation.
+            for (dim_t j = 0; j < rnd_up(size_n, s8_kern_t::unroll_n); j++)
+                col_comp[j] = (first_k && OCisR && j < size_n) ? co[Bn + j] : 0;
+
+            for (dim_t Bm = 0; Bm < m; Bm += blk.mc) {
+                const dim_t size_m = nstl::min(blk.mc, m - Bm);
+                const int8_t *a_pack = a_ws;
+                const int32_t *row_sum = row_sum_ws;
+                if (a.packed) {
+                    a_pack = a.storage.matrix<int8_t>(Bk, m0 + Bm);
+                    row_sum = a.storage.sums(Bk, m0 + Bm);
+                } else {
+                    copy_a_sum(a.trans, size_m, size_k, plain_a(a, m0 + Bm, Bk),
+                            a.ld, a_ws, row_sum_ws);
+                }
+
+                // B was shifted into the signed range while packing, restore
+                // the 128 * sum(A) this removed.
+                for (dim_t i = 0; i < rnd_up(size_m, s8_kern_t::unroll_m);
+                        i++) {
+                    int32_t comp = 128 * row_sum[i];
+                    if (first_k && i < size_m) {
+                        if (OCisC)
+                            comp += co[Bm + i];
+                        else if (!OCisR)
+                            comp += co[0];
+                    }
+                    row_comp[i] = comp;
+                }
+
+                block_ker(size_m, size_n, size_k, a_pack, b_pack, row_comp,
+                        col_comp, c + Bm + Bn * ldc, ldc, first_k && beta_zero);
+            }
+        }
+    }
+}
+
+} // namespace
+
+bool pack_sgemm_supported() {
+    return mayiuse(sve);
+}
+
+dnnl_status_t sgemm_pack_get_size(const char *identifier, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const dim_t *lda, const dim_t *ldb, size_t *size, bool *pack) {
+    gemm_pack_storage_t::header_t h;
+    dnnl_status_t st
+            = init_sgemm_header(h, identifier, transa, transb, M, N, K);
+    if (st != dnnl_success) return st;
+
+    *size = h.size;
+    if (pack) *pack = true;
+
+    return dnnl_success;
+}
+
+dnnl_status_t gemm_s8u8s32_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const dim_t *M, const dim_t *N,
+        const dim_t *K, const dim_t *lda, const dim_t *ldb, size_t *size,
+        bool *pack) {
+    gemm_pack_storage_t::header_t h;
+    dnnl_status_t st
+            = init_gemm_s8u8s32_header(h, identifier, transa, transb, M, N, K);
+    if (st != dnnl_success) return st;
+
+    *size = h.size;
+    if (pack) *pack = true;
+
+    return dnnl_success;
+}
+
+dnnl_status_t sgemm_pack(const char *identifier, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const dim_t *lda, const dim_t *ldb, const float *src, float *dst) {
+    gemm_pack_storage_t::header_t h;
+    dnnl_status_t st
+            = init_sgemm_header(h, identifier, transa, transb, M, N, K);
+    if (st != dnnl_success) return st;
+
+    gemm_pack_storage_t packed(dst);
+    packed.setup(h);
+
+    if (h.which == matrix_id::a) {
+        const operand_t<float> a(transa, src, lda);
+        pack_panels(h, f32_kern_t::unroll_m,
+                [&](dim_t k0, dim_t i0, dim_t size_k, dim_t size_i) {
+                    sve_512_gemm_f32::copy_a(a.trans, size_i, size_k,
+                            plain_a(a, i0, k0), a.ld, 1.0f,
+                            packed.matrix<float>(k0, i0));
+                });
+    } else {
+        const operand_t<float> b(transb, src, ldb);
+        pack_panels(h, f32_kern_t::unroll_n,
+                [&](dim_t k0, dim_t j0, dim_t size_k, dim_t size_j) {
+                    sve_512_gemm_f32::copy_b(b.trans, size_j, size_k,
+                            plain_b(b, k0, j0), b.ld,
+                            packed.matrix<float>(k0, j0));
+                });
+    }
+
+    return dnnl_success;
+}
+
+dnnl_status_t gemm_s8u8s32_pack(const char *identifier, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const dim_t *lda, const dim_t *ldb, const void *src, void *dst) {
+    gemm_pack_storage_t::header_t h;
+    dnnl_status_t st
+            = init_gemm_s8u8s32_header(h, identifier, transa, transb, M, N, K);
+    if (st != dnnl_success) return st;
+
+    gemm_pack_storage_t packed(dst);
+    packed.setup(h);
+
+    if (h.which == matrix_id::a) {
+        const operand_t<int8_t> a(
+                transa, static_cast<const int8_t *>(src), lda);
+        pack_panels(h, s8_kern_t::unroll_m,
+                [&](dim_t k0, dim_t i0, dim_t size_k, dim_t size_i) {
+                    sve_512_gemm_s8x8s32::copy_a_sum(a.trans, size_i, size_k,
+                            plain_a(a, i0, k0), a.ld,
+                            packed.matrix<int8_t>(k0, i0),
+                            packed.sums(k0, i0));
+                });
+    } else {
+        const operand_t<uint8_t> b(
+                transb, static_cast<const uint8_t *>(src), ldb);
+        pack_panels(h, s8_kern_t::unroll_n,
+                [&](dim_t k0, dim_t j0, dim_t size_k, dim_t size_j) {
+                    sve_512_gemm_s8x8s32::copy_b_sum<uint8_t>(b.trans, size_j,
+                            size_k, plain_b(b, k0, j0), b.ld,
+                            packed.matrix<int8_t>(k0, j0),
+                            packed.sums(k0, j0));
+                });
+    }
+
+    return dnnl_success;
+}
+
+dnnl_status_t sgemm_compute(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *A,
+        const dim_t *lda, const float *B, const dim_t *ldb, const float *beta,
+        float *C, const dim_t *ldc) {
+    const operand_t<float> a(transa, A, lda);
+    const operand_t<float> b(transb, B, ldb);
+    const dim_t m = *M, n = *N, k = *K, ld_c = *ldc;
+    const float beta_val = *beta;
+
+    dnnl_status_t st = check_compute_args(a, b, transa, transb, m, n, k);
+    if (st != dnnl_success) return st;
+
+    if (m <= 0 || n <= 0) return dnnl_success;
+
+    if (k <= 0) {
+        parallel_nd(n, m, [&](dim_t j, dim_t i) {
+            float &c = C[i + j * ld_c];
+            c = beta_val == 0.f ? 0.f : beta_val * c;
+        });
+        return dnnl_success;
+    }
+
+    const size_t ws_size = sgemm_compute_ws_size();
+    const int max_nthr = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+    char *ws_buffers = (char *)malloc(max_nthr * ws_size, PAGE_4K);
+    if (!ws_buffers) return dnnl_out_of_memory;
+
+    parallel_mn(max_nthr, m, n, f32_kern_t::unroll_m, f32_kern_t::unroll_n,
+            [&](dim_t m_from, dim_t m_to, dim_t n_from, dim_t n_to, int ithr) {
+                sgemm_compute_ithr(a, b, m_from, m_to - m_from, n_from,
+                        n_to - n_from, k, beta_val, C + m_from + n_from * ld_c,
+                        ld_c, (float *)(ws_buffers + ithr * ws_size));
+            });
+
+    free(ws_buffers);
+
+    msan_unpoison_matrix(C, m, n, ld_c, sizeof(*C));
+
+    return dnnl_success;
+}
+
+dnnl_status_t gemm_s8u8s32_compute(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const int8_t *A, const dim_t *lda, const uint8_t *B, const dim_t *ldb,
+        const float *beta, int32_t *C, const dim_t *ldc, const int32_t *co) {
+    const operand_t<int8_t> a(transa, A, lda);
+    const operand_t<uint8_t> b(transb, B, ldb);
+    const dim_t m = *M, n = *N, k = *K, ld_c = *ldc;
+
+    dnnl_status_t st = check_compute_args(a, b, transa, transb, m, n, k);
+    if (st != dnnl_success) return st;
+
+    const bool OCisR = (*offsetc == 'R' || *offsetc == 'r');
+    const bool OCisC = (*offsetc == 'C' || *offsetc == 'c');
+    const float beta_val = *beta;
+    const bool beta_zero = beta_val == 0.0f;
+
+    if (m <= 0 || n <= 0) return dnnl_success;
+
+    // The microkernel only accumulates, so a general beta is applied to C
+    // up front.
+    if (!one_of(beta_val, 0.0f, 1.0f)) {
+        parallel_nd(n, m, [&](dim_t j, dim_t i) {
+            int32_t &c = C[i + j * ld_c];
+            c = saturate_and_round<int32_t>(beta_val * c);
+        });
+    }
+
+    if (k <= 0) {
+        parallel_nd(n, m, [&](dim_t j, dim_t i) {
+            const int32_t c_off = OCisR ? co[j] : OCisC ? co[i] : co[0];
+            int32_t &c = C[i + j * ld_c];
+            c = (beta_zero ? 0 : c) + c_off;
+        });
+        return dnnl_success;
+    }
+
+    const size_t ws_size = s8u8s32_compute_ws_size();
+    const int max_nthr = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+    char *ws_buffers = (char *)malloc(max_nthr * ws_size, PAGE_4K);
+    if (!ws_buffers) return dnnl_out_of_memory;
+
+    parallel_mn(max_nthr, m, n, s8_kern_t::unroll_m, s8_kern_t::unroll_n,
+            [&](dim_t m_from, dim_t m_to, dim_t n_from, dim_t n_to, int ithr) {
+                const int32_t *my_co
+                        = OCisR ? co + n_from : (OCisC ? co + m_from : co);
+                gemm_s8u8s32_compute_ithr(a, b, *offsetc, m_from,
+                        m_to - m_from, n_from, n_to - n_from, k, beta_zero,
+                        C + m_from + n_from * ld_c, ld_c, my_co,
+                        ws_buffers + ithr * ws_size);
+            });
+
+    free(ws_buffers);
+
+    msan_unpoison_matrix(C, m, n, ld_c, sizeof(*C));
+
+    return dnnl_success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
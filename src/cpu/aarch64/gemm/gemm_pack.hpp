@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_GEMM_PACK_HPP
+#define CPU_AARCH64_GEMM_GEMM_PACK_HPP
+
+#include "dnnl_config.h"
+#include "dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Only the A matrix can be packed. Compute expects transa == 'P' and takes
+// B and C in the usual column-major layout.
+bool pack_sgemm_supported();
+
+dnnl_status_t sgemm_pack_get_size(const char *identifier, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const dim_t *lda, const dim_t *ldb, size_t *size, bool *pack);
+
+dnnl_status_t gemm_s8u8s32_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const dim_t *M, const dim_t *N,
+        const dim_t *K, const dim_t *lda, const dim_t *ldb, size_t *size,
+        bool *pack);
+
+dnnl_status_t sgemm_pack(const char *identifier, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const dim_t *lda, const dim_t *ldb, const float *src, float *dst);
+
+dnnl_status_t gemm_s8u8s32_pack(const char *identifier, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const dim_t *lda, const dim_t *ldb, const void *src, void *dst);
+
+dnnl_status_t sgemm_compute(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *A,
+        const dim_t *lda, const float *B, const dim_t *ldb, const float *beta,
+        float *C, const dim_t *ldc);
+
+dnnl_status_t gemm_s8u8s32_compute(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const int8_t *A, const dim_t *lda, const uint8_t *B, const dim_t *ldb,
+        const float *beta, int32_t *C, const dim_t *ldc, const int32_t *co);
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_GEMM_GEMM_PACK_HPP
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_GEMM_PACK_STORAGE_HPP
+#define CPU_AARCH64_GEMM_GEMM_PACK_STORAGE_HPP
+
+#include <cstdint>
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+enum struct matrix_id { a, b };
+
+// Layout of a buffer filled by the packed gemm API. A header is followed by
+// op(A) or op(B) split into k blocks of kc (k_group aligned) elements. Every
+// k block holds the whole outer dimension (m for A, n for B) as zero-padded
+// microkernel panels, exactly as the gemm drivers would copy them. For
+// integer gemm the per-block sums along k (row sums of A, column sums of B)
+// are stored after the matrix so compute never has to read the data twice.
+struct gemm_pack_storage_t {
+    struct header_t {
+        matrix_id which;
+        bool has_sums;
+        dim_t outer, k; // m x k for A, n x k for B
+        dim_t outer_padded; // outer rounded up to the microkernel unroll
+        dim_t kc; // k blocking used for packing
+        dim_t k_group; // k granularity of the microkernel
+        size_t typesize;
+        size_t matrix_offset, sums_offset, size;
+    };
+
+    // Fills the header without touching the storage, so that the size can
+    // be queried before the destination buffer is allocated.
+    static void init_header(header_t &h, matrix_id which, dim_t outer, dim_t k,
+            dim_t unroll, dim_t kc, dim_t k_group, size_t typesize,
+            bool has_sums) {
+        using namespace dnnl::impl::utils;
+        assert(kc % k_group == 0);
+
+        h.which = which;
+        h.has_sums = has_sums;
+        h.outer = outer;
+        h.k = k;
+        h.outer_padded = rnd_up(outer, unroll);
+        h.kc = kc;
+        h.k_group = k_group;
+        h.typesize = typesize;
+
+        const size_t matrix_size
+                = (size_t)h.outer_padded * rnd_up(k, k_group) * typesize;
+        const size_t sums_size = has_sums
+                ? (size_t)div_up(k, kc) * h.outer_padded * sizeof(int32_t)
+                : 0;
+
+        h.matrix_offset = rnd_up(sizeof(header_t), alignment);
+        h.sums_offset = h.matrix_offset + rnd_up(matrix_size, alignment);
+        h.size = h.sums_offset + sums_size;
+    }
+
+    gemm_pack_storage_t(const void *data)
+        : base(static_cast<char *>(const_cast<void *>(data)))
+        , header(reinterpret_cast<header_t *>(base)) {}
+
+    void setup(const header_t &h) { *header = h; }
+
+    matrix_id which() const { return header->which; }
+    bool has_sums() const { return header->has_sums; }
+    dim_t outer() const { return header->outer; }
+    dim_t k() const { return header->k; }
+    dim_t kc() const { return header->kc; }
+    size_t size() const { return header->size; }
+
+    // Number of k values in the block starting at k0.
+    dim_t block_k(dim_t k0) const { return nstl::min(header->kc, k() - k0); }
+
+    // Packed panels of the k block starting at k0, beginning at outer index
+    // i0. k0 must be a multiple of kc and i0 a multiple of the unroll.
+    template <typename data_type>
+    data_type *matrix(dim_t k0, dim_t i0) const {
+        assert(k0 % header->kc == 0);
+        assert(sizeof(data_type) == header->typesize);
+        const dim_t kp = utils::rnd_up(block_k(k0), header->k_group);
+        auto *m_base
+                = reinterpret_cast<data_type *>(base + header->matrix_offset);
+        return m_base + k0 * header->outer_padded + i0 * kp;
+    }
+
+    int32_t *sums(dim_t k0, dim_t i0) const {
+        if (!has_sums()) return nullptr;
+        auto *s_base = reinterpret_cast<int32_t *>(base + header->sums_offset);
+        return s_base + (k0 / header->kc) * header->outer_padded + i0;
+    }
+
+private:
+    static constexpr size_t alignment = 64;
+
+    char *base;
+    header_t *header;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_GEMM_GEMM_PACK_STORAGE_HPP
@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_GEMM_PARTITION_HPP
+#define CPU_AARCH64_GEMM_GEMM_PARTITION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Splits an m x n output between nthr threads so that the per-thread work,
+// padded to the microkernel unrolling, is minimal.
+static inline void partition_2d(dim_t m, dim_t n, dim_t unroll_m,
+        dim_t unroll_n, int nthr, int &nthr_m, int &nthr_n) {
+    using namespace dnnl::impl::utils;
+
+    nthr_m = 1;
+    nthr_n = 1;
+    dim_t best_cost = -1;
+    for (int tm = 1; tm <= nthr; tm++) {
+        if (nthr % tm != 0) continue;
+        const int tn = nthr / tm;
+        if (tm > div_up(m, unroll_m) || tn > div_up(n, unroll_n)) continue;
+        const dim_t cost = rnd_up(div_up(m, tm), unroll_m)
+                * rnd_up(div_up(n, tn), unroll_n);
+        if (best_cost < 0 || cost < best_cost) {
+            best_cost = cost;
+            nthr_m = tm;
+            nthr_n = tn;
+        }
+    }
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_GEMM_GEMM_PARTITION_HPP
@@ -0,0 +1,375 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+#include "dnnl_types.h"
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/gemm/gemm_msan_unpoison.hpp"
+
+#include "cpu/aarch64/gemm/gemm_partition.hpp"
+#include "cpu/aarch64/gemm/s8x8s32/jit_sve_512_gemm_s8x8s32.hpp"
+#include "cpu/aarch64/gemm/s8x8s32/jit_sve_512_gemm_s8x8s32_kern.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+
+namespace sve_512_gemm_s8x8s32 {
+
+using kern_t = jit_sve_512_gemm_s8x8s32_kern;
+
+constexpr dim_t unroll_m = kern_t::unroll_m;
+constexpr dim_t unroll_n = kern_t::unroll_n;
+constexpr dim_t k_group = kern_t::k_group;
+
+// Same cache blocking scheme as the f32 driver, with kc counted in bytes.
+blocking_t get_blocking() {
+    static blocking_t blk = [] {
+        blocking_t b;
+        const dim_t k_step = k_group * kern_t::unroll_k;
+        const dim_t l1_size = platform::get_A64FX_cache_size(1, true, 1);
+        const dim_t l2_size = platform::get_A64FX_cache_size(2, true, 1);
+
+        b.kc = nstl::max(k_step, rnd_dn(l1_size / 4 / unroll_n, k_step));
+        b.kc = nstl::min(b.kc, dim_t(1536));
+        b.mc = rnd_dn(l2_size / 2 / b.kc, unroll_m);
+        b.mc = nstl::max(unroll_m, nstl::min(b.mc, 10 * unroll_m));
+        b.nc = rnd_up(4 * b.mc, unroll_n);
+        return b;
+    }();
+    return blk;
+}
+
+const kern_t *get_kern(bool beta_zero) {
+    static std::unique_ptr<kern_t> kernel_table[2];
+    static std::once_flag initialized;
+    std::call_once(initialized, [] {
+        for (bool b0 : {false, true})
+            kernel_table[b0].reset(new kern_t(b0));
+    });
+    return kernel_table[beta_zero].get();
+}
+
+// SDOT multiplies signed bytes only, so unsigned B is shifted into the signed
+// range while packing; the 128 * sum(A) this removes is restored through the
+// row compensation. Signed A and B are copied as is.
+template <typename b_dt>
+struct b_traits {
+    static constexpr bool is_shifted = std::is_same<b_dt, uint8_t>::value;
+    static int8_t shift(b_dt v) {
+        return is_shifted ? static_cast<int8_t>(v ^ 0x80)
+                          : static_cast<int8_t>(v);
+    }
+};
+
+// Packs an mn x k block into u-wide panels laid out as [k / 4][u][4] and
+// computes the sums along k of the original values. If the source is k-major,
+// each of its mn rows is contiguous and is copied 4 bytes at a time into the
+// panel; otherwise each of its k rows holds mn contiguous values that are
+// spread over the panel with a stride of 4. Padding is zero-filled.
+template <dim_t u, typename src_t>
+void copy_sum(bool is_k_major, dim_t mn, dim_t k, const src_t *src, dim_t ld,
+        int8_t *ws, int32_t *sum) {
+    using traits = b_traits<src_t>;
+    const dim_t kp = rnd_up(k, k_group);
+    const dim_t group_stride = u * k_group;
+    for (dim_t i0 = 0; i0 < mn; i0 += u) {
+        const dim_t mu = nstl::min(u, mn - i0);
+        int8_t *panel = ws + i0 * kp;
+        int32_t *s = sum + i0;
+        if (mu < u || kp != k) std::memset(panel, 0, u * kp);
+        for (dim_t i = 0; i < u; i++)
+            s[i] = 0;
+
+        if (is_k_major) {
+            for (dim_t i = 0; i < mu; i++) {
+                const src_t *x = src + (i0 + i) * ld;
+                int32_t acc = 0;
+                PRAGMA_OMP_SIMD(reduction(+ : acc))
+                for (dim_t p = 0; p < k; p++)
+                    acc += x[p];
+                s[i] = acc;
+
+                int8_t *dst = panel + i * k_group;
+                dim_t p0 = 0;
+                for (; p0 + k_group <= k; p0 += k_group, dst += group_stride)
+                    for (dim_t pp = 0; pp < k_group; pp++)
+                        dst[pp] = traits::shift(x[p0 + pp]);
+                for (dim_t pp = 0; p0 + pp < k; pp++)
+                    dst[pp] = traits::shift(x[p0 + pp]);
+            }
+        } else {
+            int8_t *dst_g = panel;
+            for (dim_t p0 = 0; p0 < k; p0 += k_group, dst_g += group_stride) {
+                const dim_t pu = nstl::min(k_group, k - p0);
+                for (dim_t pp = 0; pp < pu; pp++) {
+                    const src_t *x = src + i0 + (p0 + pp) * ld;
+                    int8_t *dst = dst_g + pp;
+                    for (dim_t i = 0; i < mu; i++) {
+                        dst[i * k_group] = traits::shift(x[i]);
+                        s[i] += x[i];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Packs an m x k block of op(A) into unroll_m-row panels laid out as
+// [k / 4][unroll_m][4] and computes the row sums of the block on the fly.
+void copy_a_sum(bool isTransA, dim_t m, dim_t k, const int8_t *a, dim_t lda,
+        int8_t *ws, int32_t *row_sum) {
+    copy_sum<unroll_m>(isTransA, m, k, a, lda, ws, row_sum);
+}
+
+// Packs a k x n block of op(B) into unroll_n-column panels laid out as
+// [k / 4][unroll_n][4] and computes the column sums of the original values.
+template <typename b_dt>
+void copy_b_sum(bool isTransB, dim_t n, dim_t k, const b_dt *b, dim_t ldb,
+        int8_t *ws, int32_t *col_sum) {
+    copy_sum<unroll_n>(!isTransB, n, k, b, ldb, ws, col_sum);
+}
+
+void block_ker(dim_t m, dim_t n, dim_t k, const int8_t *a_pack,
+        const int8_t *b_pack, const int32_t *row_comp, const int32_t *col_comp,
+        int32_t *c, dim_t ldc, bool beta_zero) {
+    const kern_t *ker_b0 = get_kern(true);
+    const kern_t *ker_b1 = get_kern(false);
+
+    const dim_t kp = rnd_up(k, k_group);
+    int32_t c_tail[unroll_m * unroll_n];
+
+    for (dim_t j = 0; j < n; j += unroll_n) {
+        const dim_t nu = nstl::min(unroll_n, n - j);
+        for (dim_t i = 0; i < m; i += unroll_m) {
+            const dim_t mu = nstl::min(unroll_m, m - i);
+            int32_t *c_ij = c + i + j * ldc;
+
+            jit_sve_512_gemm_s8x8s32_call_s p;
+            p.a = a_pack + i * kp;
+            p.b = b_pack + j * kp;
+            p.k4 = kp / k_group;
+            p.row_comp = row_comp + i;
+            p.col_comp = col_comp + j;
+
+            if (mu == unroll_m && nu == unroll_n) {
+                p.c = c_ij;
+                p.ldc = ldc * sizeof(int32_t);
+                (beta_zero ? *ker_b0 : *ker_b1)(&p);
+            } else {
+                p.c = c_tail;
+                p.ldc = unroll_m * sizeof(int32_t);
+                (*ker_b0)(&p);
+                for (dim_t jj = 0; jj < nu; jj++) {
+                    int32_t *c_j = c_ij + jj * ldc;
+                    const int32_t *t_j = c_tail + jj * unroll_m;
+                    for (dim_t ii = 0; ii < mu; ii++)
+                        c_j[ii] = (beta_zero ? 0 : c_j[ii]) + t_j[ii];
+                }
+            }
+        }
+    }
+}
+
+size_t ws_size_per_thr() {
+    const blocking_t blk = get_blocking();
+    const size_t pack_size = (size_t)(blk.mc + blk.nc) * blk.kc;
+    const size_t comp_size = (size_t)(blk.mc + blk.nc) * sizeof(int32_t);
+    return rnd_up(pack_size, PAGE_4K) + 2 * rnd_up(comp_size, PAGE_4K);
+}
+
+template <typename b_dt>
+void gemm_ithr(bool isTransA, bool isTransB, char offsetc, dim_t m, dim_t n,
+        dim_t k, const int8_t *a, dim_t lda, int32_t ao, const b_dt *b,
+        dim_t ldb, int32_t bo, bool beta_zero, int32_t *c, dim_t ldc,
+        const int32_t *co, void *ws) {
+    const blocking_t blk = get_blocking();
+
+    int8_t *a_pack = (int8_t *)ws;
+    int8_t *b_pack = a_pack + blk.mc * blk.kc;
+    int32_t *sums = (int32_t *)((char *)ws
+            + rnd_up((size_t)(blk.mc + blk.nc) * blk.kc, PAGE_4K));
+    int32_t *row_sum = sums;
+    int32_t *col_sum = row_sum + blk.mc;
+    int32_t *comps = (int32_t *)((char *)sums
+            + rnd_up((size_t)(blk.mc + blk.nc) * sizeof(int32_t), PAGE_4K));
+    int32_t *row_comp = comps;
+    int32_t *col_comp = row_comp + blk.mc;
+
+    const bool OCisR = (offsetc == 'R' || offsetc == 'r');
+    const bool OCisC = (offsetc == 'C' || offsetc == 'c');
+    const int32_t b_shift = b_traits<b_dt>::is_shifted ? 128 : 0;
+
+    dim_t size_k;
+    for (dim_t Bk = 0; Bk < k; Bk += size_k) {
+        size_k = nstl::min(blk.kc, k - Bk);
+        const bool first_k = Bk == 0;
+        const bool cur_beta_zero = first_k && beta_zero;
+
+        for (dim_t Bn = 0; Bn < n; Bn += blk.nc) {
+            const dim_t size_n = nstl::min(blk.nc, n - Bn);
+            const b_dt *cur_b
+                    = isTransB ? b + Bn + Bk * ldb : b + Bk + Bn * ldb;
+            copy_b_sum<b_dt>(
+                    isTransB, size_n, size_k, cur_b, ldb, b_pack, col_sum);
+
+            for (dim_t j = 0; j < rnd_up(size_n, unroll_n); j++) {
+                int32_t comp = j < size_n ? -ao * col_sum[j] : 0;
+                if (first_k && OCisR && j < size_n) comp += co[Bn + j];
+                col_comp[j] = comp;
+            }
+
+            for (dim_t Bm = 0; Bm < m; Bm += blk.mc) {
+                const dim_t size_m = nstl::min(blk.mc, m - Bm);
+                const int8_t *cur_a
+                        = isTransA ? a + Bk + Bm * lda : a + Bm + Bk * lda;
+                copy_a_sum(isTransA, size_m, size_k, cur_a, lda, a_pack,
+                        row_sum);
+
+                for (dim_t i = 0; i < rnd_up(size_m, unroll_m); i++) {
+                    int32_t comp = (b_shift - bo) * row_sum[i]
+                            + (int32_t)size_k * ao * bo;
+                    if (first_k && i < size_m) {
+                        if (OCisC)
+                            comp += co[Bm + i];
+                        else if (!OCisR)
+                            comp += co[0];
+                    }
+                    row_comp[i] = comp;
+                }
+
+                block_ker(size_m, size_n, size_k, a_pack, b_pack, row_comp,
+                        col_comp, c + Bm + Bn * ldc, ldc, cur_beta_zero);
+            }
+        }
+    }
+}
+
+template void copy_b_sum<uint8_t>(bool isTransB, dim_t n, dim_t k,
+        const uint8_t *b, dim_t ldb, int8_t *ws, int32_t *col_sum);
+template void copy_b_sum<int8_t>(bool isTransB, dim_t n, dim_t k,
+        const int8_t *b, dim_t ldb, int8_t *ws, int32_t *col_sum);
+
+} // namespace sve_512_gemm_s8x8s32
+
+template <typename b_dt>
+dnnl_status_t jit_sve_512_gemm_s8x8s32(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *p_m, const dim_t *p_n,
+        const dim_t *p_k, const float *alpha, const int8_t *A,
+        const dim_t *p_lda, const int8_t *ao, const b_dt *B, const dim_t *p_ldb,
+        const b_dt *bo, const float *beta, int32_t *C, const dim_t *p_ldc,
+        const int32_t *co) {
+    using namespace sve_512_gemm_s8x8s32;
+
+    if (!(utils::one_of(*transa, 'n', 'N', 't', 'T')
+                && utils::one_of(*transb, 'n', 'N', 't', 'T')))
+        return dnnl_unimplemented;
+    if (*alpha != 1.0f || !utils::one_of(*beta, 0.0f, 1.0f))
+        return dnnl_unimplemented;
+
+    const bool isTransA = (*transa == 'T' || *transa == 't');
+    const bool isTransB = (*transb == 'T' || *transb == 't');
+    const dim_t m = *p_m, n = *p_n, k = *p_k;
+    const dim_t lda = *p_lda, ldb = *p_ldb, ldc = *p_ldc;
+    const bool beta_zero = *beta == 0.0f;
+
+    if (m <= 0 || n <= 0) return dnnl_success;
+
+    const bool OCisR = (*offsetc == 'R' || *offsetc == 'r');
+    const bool OCisC = (*offsetc == 'C' || *offsetc == 'c');
+
+    if (k <= 0) {
+        parallel_nd(n, m, [&](dim_t j, dim_t i) {
+            const int32_t c_off = OCisR ? co[j] : OCisC ? co[i] : co[0];
+            int32_t &c = C[i + j * ldc];
+            c = (beta_zero ? 0 : c) + c_off;
+        });
+        return dnnl_success;
+    }
+
+    const int max_nthr = dnnl_in_parallel() ? 1 : dnnl_get_max_threads();
+    int nthr_m = 1, nthr_n = 1;
+    partition_2d(m, n, unroll_m, unroll_n, max_nthr, nthr_m, nthr_n);
+    const int nthr_to_use = nthr_m * nthr_n;
+
+    const dim_t MB = rnd_up(div_up(m, nthr_m), unroll_m);
+    const dim_t NB = rnd_up(div_up(n, nthr_n), unroll_n);
+
+    const size_t ws_size = ws_size_per_thr();
+    char *ws_buffers = (char *)malloc(nthr_to_use * ws_size, PAGE_4K);
+    if (!ws_buffers) return dnnl_out_of_memory;
+
+    parallel(nthr_to_use, [&](int ithr, int nthr) {
+        assert(nthr_to_use == nthr);
+        MAYBE_UNUSED(nthr);
+
+        const int ithr_m = ithr % nthr_m;
+        const int ithr_n = ithr / nthr_m;
+
+        const dim_t m_from = MB * ithr_m;
+        const dim_t m_to = nstl::min(m, m_from + MB);
+        const dim_t n_from = NB * ithr_n;
+        const dim_t n_to = nstl::min(n, n_from + NB);
+        if (m_from >= m_to || n_from >= n_to) return;
+
+        const int32_t *my_co
+                = OCisR ? co + n_from : (OCisC ? co + m_from : co);
+
+        const int8_t *myA = isTransA ? A + m_from * lda : A + m_from;
+        const b_dt *myB = isTransB ? B + n_from : B + n_from * ldb;
+
+        gemm_ithr<b_dt>(isTransA, isTransB, *offsetc, m_to - m_from,
+                n_to - n_from, k, myA, lda, *ao, myB, ldb, *bo, beta_zero,
+                C + m_from + n_from * ldc, ldc, my_co,
+                ws_buffers + ithr * ws_size);
+    });
+
+    free(ws_buffers);
+
+    msan_unpoison_matrix(C, m, n, ldc, sizeof(*C));
+
+    return dnnl_success;
+}
+
+template dnnl_status_t jit_sve_512_gemm_s8x8s32<uint8_t>(const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M, const dim_t *N,
+        const dim_t *K, const float *alpha, const int8_t *A, const dim_t *lda,
+        const int8_t *ao, const uint8_t *B, const dim_t *ldb, const uint8_t *bo,
+        const float *beta, int32_t *C, const dim_t *ldc, const int32_t *co);
+
+template dnnl_status_t jit_sve_512_gemm_s8x8s32<int8_t>(const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M, const dim_t *N,
+        const dim_t *K, const float *alpha, const int8_t *A, const dim_t *lda,
+        const int8_t *ao, const int8_t *B, const dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *C, const dim_t *ldc, const int32_t *co);
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_S8X8S32_JIT_SVE_512_GEMM_S8X8S32_HPP
+#define CPU_AARCH64_GEMM_S8X8S32_JIT_SVE_512_GEMM_S8X8S32_HPP
+
+#include <cstdint>
+
+#include "dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace sve_512_gemm_s8x8s32 {
+
+struct blocking_t {
+    dim_t mc, nc, kc;
+};
+
+blocking_t get_blocking();
+
+// Packing and block-level compute routines, shared with the packed gemm API.
+// Unsigned B values are shifted into the signed range by copy_b_sum, which
+// the caller must compensate with 128 * row_sum in row_comp.
+void copy_a_sum(bool isTransA, dim_t m, dim_t k, const int8_t *a, dim_t lda,
+        int8_t *ws, int32_t *row_sum);
+template <typename b_dt>
+void copy_b_sum(bool isTransB, dim_t n, dim_t k, const b_dt *b, dim_t ldb,
+        int8_t *ws, int32_t *col_sum);
+void block_ker(dim_t m, dim_t n, dim_t k, const int8_t *a_pack,
+        const int8_t *b_pack, const int32_t *row_comp, const int32_t *col_comp,
+        int32_t *c, dim_t ldc, bool beta_zero);
+
+} // namespace sve_512_gemm_s8x8s32
+
+// Column-major int8 gemm with SDOT microkernels. A and B offsets as well as
+// the C offset are folded into row/column compensation computed while
+// packing. Only alpha == 1 and beta in {0, 1} are supported, other cases
+// return dnnl_unimplemented so the caller can fall back to the reference.
+template <typename b_dt>
+dnnl_status_t jit_sve_512_gemm_s8x8s32(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const int8_t *A, const dim_t *lda, const int8_t *ao,
+        const b_dt *B, const dim_t *ldb, const b_dt *bo, const float *beta,
+        int32_t *C, const dim_t *ldc, const int32_t *co);
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_GEMM_S8X8S32_JIT_SVE_512_GEMM_S8X8S32_HPP
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/aarch64/gemm/s8x8s32/jit_sve_512_gemm_s8x8s32_kern.hpp"
+
+#define GET_OFF(field) \
+    static_cast<int32_t>(offsetof(jit_sve_512_gemm_s8x8s32_call_s, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace {
+// Prefetch distances (in bytes) for the packed A and B panels.
+constexpr int a_prefetch_dist = 2048;
+constexpr int b_prefetch_dist = 512;
+} // namespace
+
+jit_sve_512_gemm_s8x8s32_kern::jit_sve_512_gemm_s8x8s32_kern(bool beta_zero)
+    : jit_generator(nullptr, 16 * 1024), ker_(nullptr), beta_zero_(beta_zero) {
+    // The kernel uses no absolute addresses, so its code may be reused
+    // from the persistent JIT cache.
+    const std::string key = beta_zero ? "beta0" : "beta1";
+    if (!load_cached_code(key)) generate();
+    const uint32_t *code = getCode32();
+    ker_ = (void (*)(jit_sve_512_gemm_s8x8s32_call_s *))code;
+    store_cached_code(key, code);
+}
+
+void jit_sve_512_gemm_s8x8s32_kern::init_accumulators() {
+    for (int m = 0; m < n_m_regs; m++)
+        CGA64::ldr(xa::ZReg(a_base_idx + m),
+                xa::ptr(reg_row_comp, static_cast<int32_t>(m)));
+
+    for (int n = 0; n < unroll_n; n++) {
+        CGA64::ld1rw(zreg_b_s(n), reg_p_all_ones,
+                xa::ptr(reg_col_comp,
+                        static_cast<int32_t>(n * sizeof(int32_t))));
+        for (int m = 0; m < n_m_regs; m++)
+            CGA64::add(zreg_acc_s(n, m), xa::ZRegS(a_base_idx + m),
+                    zreg_b_s(n));
+    }
+}
+
+void jit_sve_512_gemm_s8x8s32_kern::dot_step(int uk) {
+    for (int m = 0; m < n_m_regs; m++)
+        CGA64::ldr(xa::ZReg(a_base_idx + m),
+                xa::ptr(reg_a, static_cast<int32_t>(uk * n_m_regs + m)));
+
+    CGA64::prfm(xa::PLDL1KEEP,
+            xa::ptr(reg_a,
+                    static_cast<int32_t>(
+                            a_prefetch_dist + uk * unroll_m * k_group)));
+
+    for (int n = 0; n < unroll_n; n++) {
+        CGA64::ld1rw(zreg_b_s(n), reg_p_all_ones,
+                xa::ptr(reg_b,
+                        static_cast<int32_t>(
+                                (uk * unroll_n + n) * k_group)));
+        for (int m = 0; m < n_m_regs; m++)
+            CGA64::sdot(zreg_acc_s(n, m), zreg_a_b(m), zreg_b_b(n));
+    }
+}
+
+void jit_sve_512_gemm_s8x8s32_kern::store_tile() {
+    const int n_tmp_regs = 32 - a_base_idx;
+
+    CGA64::mov(reg_c_col, reg_c);
+    for (int n = 0; n < unroll_n; n++) {
+        for (int m = 0; m < n_m_regs; m++) {
+            if (!beta_zero_) {
+                const int tmp_idx
+                        = a_base_idx + (n * n_m_regs + m) % n_tmp_regs;
+                CGA64::ldr(xa::ZReg(tmp_idx),
+                        xa::ptr(reg_c_col, static_cast<int32_t>(m)));
+                CGA64::add(zreg_acc_s(n, m), zreg_acc_s(n, m),
+                        xa::ZRegS(tmp_idx));
+            }
+            CGA64::str(zreg_acc(n, m),
+                    xa::ptr(reg_c_col, static_cast<int32_t>(m)));
+        }
+        if (n < unroll_n - 1) CGA64::add(reg_c_col, reg_c_col, reg_ldc);
+    }
+}
+
+void jit_sve_512_gemm_s8x8s32_kern::generate() {
+    preamble();
+
+    CGA64::ptrue(reg_p_all_ones.b);
+
+    CGA64::ldr(reg_a, xa::ptr(param, GET_OFF(a)));
+    CGA64::ldr(reg_b, xa::ptr(param, GET_OFF(b)));
+    CGA64::ldr(reg_c, xa::ptr(param, GET_OFF(c)));
+    CGA64::ldr(reg_ldc, xa::ptr(param, GET_OFF(ldc)));
+    CGA64::ldr(reg_k, xa::ptr(param, GET_OFF(k4)));
+    CGA64::ldr(reg_row_comp, xa::ptr(param, GET_OFF(row_comp)));
+    CGA64::ldr(reg_col_comp, xa::ptr(param, GET_OFF(col_comp)));
+
+    init_accumulators();
+
+    xa::LabelAArch64 k_loop, k_loop_tail, k_loop_end;
+
+    CGA64::cmp_imm(reg_k, unroll_k, reg_tmp_imm);
+    CGA64::b(xa::LT, k_loop_tail);
+
+    CGA64::L_aarch64(k_loop);
+    {
+        for (int uk = 0; uk < unroll_k; uk++)
+            dot_step(uk);
+        CGA64::prfm(xa::PLDL1KEEP,
+                xa::ptr(reg_b, static_cast<int32_t>(b_prefetch_dist)));
+
+        CGA64::add_imm(reg_a, reg_a, unroll_k * unroll_m * k_group,
+                reg_tmp_imm);
+        CGA64::add_imm(reg_b, reg_b, unroll_k * unroll_n * k_group,
+                reg_tmp_imm);
+        CGA64::sub_imm(reg_k, reg_k, unroll_k, reg_tmp_imm);
+        CGA64::cmp_imm(reg_k, unroll_k, reg_tmp_imm);
+        CGA64::b(xa::GE, k_loop);
+    }
+
+    CGA64::L_aarch64(k_loop_tail);
+    {
+        CGA64::cmp(reg_k, 0);
+        CGA64::b(xa::LE, k_loop_end);
+
+        dot_step(0);
+
+        CGA64::add_imm(reg_a, reg_a, unroll_m * k_group, reg_tmp_imm);
+        CGA64::add_imm(reg_b, reg_b, unroll_n * k_group, reg_tmp_imm);
+        CGA64::sub_imm(reg_k, reg_k, 1, reg_tmp_imm);
+        CGA64::b(k_loop_tail);
+    }
+
+    CGA64::L_aarch64(k_loop_end);
+    store_tile();
+
+    postamble();
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
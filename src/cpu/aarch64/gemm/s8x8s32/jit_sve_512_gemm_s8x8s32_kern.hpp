@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_S8X8S32_JIT_SVE_512_GEMM_S8X8S32_KERN_HPP
+#define CPU_AARCH64_GEMM_S8X8S32_JIT_SVE_512_GEMM_S8X8S32_KERN_HPP
+
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_sve_512_gemm_s8x8s32_call_s {
+    const int8_t *a; // packed A panel: k4 x unroll_m x 4
+    const int8_t *b; // packed B panel: k4 x unroll_n x 4
+    int32_t *c;
+    dim_t ldc; // in bytes
+    dim_t k4; // number of 4-element k groups
+    const int32_t *row_comp; // unroll_m values added to every column
+    const int32_t *col_comp; // unroll_n values added to every row
+};
+
+// Register-blocked int8 microkernel computing a full unroll_m x unroll_n tile
+// of C with SDOT. Each 32-bit lane of an A register holds 4 consecutive k
+// values of one row; B values are broadcast 4 bytes at a time. Accumulators
+// are initialized with row_comp[i] + col_comp[j] so offset compensation costs
+// nothing in the k-loop. When beta_zero is false the tile is added to C.
+struct jit_sve_512_gemm_s8x8s32_kern : public jit_generator {
+    enum {
+        simd_w = 16,
+        n_m_regs = 3,
+        unroll_m = n_m_regs * simd_w,
+        unroll_n = 8,
+        k_group = 4,
+        unroll_k = 4,
+    };
+
+    jit_sve_512_gemm_s8x8s32_kern(bool beta_zero);
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_512_gemm_s8x8s32_kern)
+
+    void operator()(jit_sve_512_gemm_s8x8s32_call_s *p) const { ker_(p); }
+
+private:
+    using reg64_t = const xa::XReg;
+
+    void (*ker_)(jit_sve_512_gemm_s8x8s32_call_s *);
+    const bool beta_zero_;
+
+    reg64_t param = abi_param1_aarch64;
+    reg64_t reg_a = x1;
+    reg64_t reg_b = x2;
+    reg64_t reg_c = x3;
+    reg64_t reg_ldc = x5;
+    reg64_t reg_k = x6;
+    reg64_t reg_c_col = x7;
+    reg64_t reg_row_comp = x8;
+    reg64_t reg_col_comp = x10;
+    reg64_t reg_tmp_imm = x17;
+
+    const xa::PReg reg_p_all_ones = p2;
+
+    enum {
+        acc_base_idx = 0,
+        a_base_idx = n_m_regs * unroll_n,
+        b_base_idx = a_base_idx + n_m_regs,
+        n_b_regs = 32 - b_base_idx,
+    };
+
+    xa::ZReg zreg_acc(int n, int m) const {
+        return xa::ZReg(acc_base_idx + n * n_m_regs + m);
+    }
+    xa::ZRegS zreg_acc_s(int n, int m) const {
+        return xa::ZRegS(acc_base_idx + n * n_m_regs + m);
+    }
+    xa::ZRegB zreg_a_b(int m) const { return xa::ZRegB(a_base_idx + m); }
+    xa::ZRegS zreg_b_s(int n) const {
+        return xa::ZRegS(b_base_idx + n % n_b_regs);
+    }
+    xa::ZRegB zreg_b_b(int n) const {
+        return xa::ZRegB(b_base_idx + n % n_b_regs);
+    }
+
+    void init_accumulators();
+    void dot_step(int uk);
+    void store_tile();
+    void generate();
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_GEMM_S8X8S32_JIT_SVE_512_GEMM_S8X8S32_KERN_HPP
@@ -0,0 +1,639 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/gemm_winograd_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace gemm_winograd;
+
+namespace {
+// The channels are transformed in vectors of simd_w.
+constexpr int simd_w = 16;
+
+// Transform matrices of F(4x4, 3x3), see A. Lavin and S. Gray, "Fast
+// Algorithms for Convolutional Neural Networks".
+const float BT[alpha][alpha] = {
+        {4.f, 0.f, -5.f, 0.f, 1.f, 0.f},
+        {0.f, -4.f, -4.f, 1.f, 1.f, 0.f},
+        {0.f, 4.f, -4.f, -1.f, 1.f, 0.f},
+        {0.f, -2.f, -1.f, 2.f, 1.f, 0.f},
+        {0.f, 2.f, -1.f, -2.f, 1.f, 0.f},
+        {0.f, 4.f, 0.f, -5.f, 0.f, 1.f},
+};
+
+const float G[alpha][3] = {
+        {1.f / 4, 0.f, 0.f},
+        {-1.f / 6, -1.f / 6, -1.f / 6},
+        {-1.f / 6, 1.f / 6, -1.f / 6},
+        {1.f / 24, 1.f / 12, 1.f / 6},
+        {1.f / 24, -1.f / 12, 1.f / 6},
+        {0.f, 0.f, 1.f},
+};
+
+const float AT[tile_size][alpha] = {
+        {1.f, 1.f, 1.f, 1.f, 1.f, 0.f},
+        {0.f, 1.f, -1.f, 2.f, -2.f, 0.f},
+        {0.f, 1.f, 1.f, 4.f, 4.f, 0.f},
+        {0.f, 1.f, -1.f, 8.f, -8.f, 1.f},
+};
+
+// Offset of the vector of channels starting at c0 from the first channel of
+// a point, the channels of a vector are contiguous in nhwc and nChw16c.
+dim_t vec_off(const memory_desc_wrapper &md, int c0) {
+    const auto &blk = md.blocking_desc();
+    return blk.strides[1] * (blk.inner_nblks ? c0 / simd_w : c0);
+}
+
+// Returns the image and the position of a tile.
+void tile_pos(const conf_t &conf, int tile, int &n, int &ty, int &tx) {
+    tx = tile % conf.tiles_w;
+    tile /= conf.tiles_w;
+    ty = tile % conf.tiles_h;
+    n = tile / conf.tiles_h;
+}
+
+// U[i][j][ic][oc] = (G * w[oc][ic] * G^T)[i][j]
+void transform_weights(const conf_t &conf,
+        const memory_desc_wrapper &weights_d, const float *wei,
+        float *__restrict U) {
+    const bool flip = conf.prop_kind == prop_kind::backward_data;
+    const dim_t U_k_stride = (dim_t)conf.ic * conf.oc;
+
+    parallel_nd(conf.oc, conf.ic, [&](int oc, int ic) {
+        float g[3][3], tmp[alpha][3];
+        for (int kh = 0; kh < 3; kh++)
+            for (int kw = 0; kw < 3; kw++)
+                g[kh][kw] = flip ? wei[weights_d.off(ic, oc, 2 - kh, 2 - kw)]
+                                 : wei[weights_d.off(oc, ic, kh, kw)];
+
+        for (int i = 0; i < alpha; i++)
+            for (int j = 0; j < 3; j++)
+                tmp[i][j] = G[i][0] * g[0][j] + G[i][1] * g[1][j]
+                        + G[i][2] * g[2][j];
+
+        for (int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++)
+                U[(i * alpha + j) * U_k_stride + (dim_t)ic * conf.oc + oc]
+                        = tmp[i][0] * G[j][0] + tmp[i][1] * G[j][1]
+                        + tmp[i][2] * G[j][2];
+    });
+}
+
+// diff_w[oc][ic] = G^T * dU[ic][oc] * G
+void transform_diff_weights(const conf_t &conf,
+        const memory_desc_wrapper &diff_weights_d, const float *__restrict dU,
+        float *diff_wei) {
+    const dim_t U_k_stride = (dim_t)conf.ic * conf.oc;
+
+    parallel_nd(conf.oc, conf.ic, [&](int oc, int ic) {
+        float tmp[3][alpha];
+        for (int kh = 0; kh < 3; kh++)
+            for (int j = 0; j < alpha; j++) {
+                float s = 0.f;
+                for (int i = 0; i < alpha; i++)
+                    s += G[i][kh]
+                            * dU[(i * alpha + j) * U_k_stride
+                                    + (dim_t)ic * conf.oc + oc];
+                tmp[kh][j] = s;
+            }
+
+        for (int kh = 0; kh < 3; kh++)
+            for (int kw = 0; kw < 3; kw++) {
+                float s = 0.f;
+                for (int j = 0; j < alpha; j++)
+                    s += tmp[kh][j] * G[j][kw];
+                diff_wei[diff_weights_d.off(oc, ic, kh, kw)] = s;
+            }
+    });
+}
+
+// V[i][j][tile][ic] = (B^T * src_tile[ic] * B)[i][j], the matrices of the
+// points are V_k_stride apart.
+void transform_src(const conf_t &conf, const memory_desc_wrapper &src_d,
+        const float *src, float *__restrict V, dim_t V_k_stride,
+        int tile_start, int ntiles) {
+    for (int t = 0; t < ntiles; t++) {
+        int n, ty, tx;
+        tile_pos(conf, tile_start + t, n, ty, tx);
+        const int ih0 = ty * tile_size - conf.t_pad;
+        const int iw0 = tx * tile_size - conf.l_pad;
+
+        // Points of the tile in the padding area are read as zeroes.
+        const float *pts[alpha][alpha];
+        for (int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++) {
+                const int ih = ih0 + i, iw = iw0 + j;
+                const bool inside = ih >= 0 && ih < conf.ih && iw >= 0
+                        && iw < conf.iw;
+                pts[i][j] = inside ? &src[src_d.off(n, 0, ih, iw)] : nullptr;
+            }
+
+        for (int c0 = 0; c0 < conf.ic; c0 += simd_w) {
+            const int len = nstl::min(simd_w, conf.ic - c0);
+            const dim_t c_off = vec_off(src_d, c0);
+            float d[alpha][alpha][simd_w], tmp[alpha][alpha][simd_w];
+
+            for (int i = 0; i < alpha; i++)
+                for (int j = 0; j < alpha; j++) {
+                    if (pts[i][j]) {
+                        for (int c = 0; c < len; c++)
+                            d[i][j][c] = pts[i][j][c_off + c];
+                    } else {
+                        for (int c = 0; c < len; c++)
+                            d[i][j][c] = 0.f;
+                    }
+                }
+
+            for (int i = 0; i < alpha; i++)
+                for (int j = 0; j < alpha; j++) {
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; c++) {
+                        float s = 0.f;
+                        for (int k = 0; k < alpha; k++)
+                            s += BT[i][k] * d[k][j][c];
+                        tmp[i][j][c] = s;
+                    }
+                }
+
+            for (int i = 0; i < alpha; i++)
+                for (int j = 0; j < alpha; j++) {
+                    float *v = &V[(i * alpha + j) * V_k_stride
+                            + (dim_t)t * conf.ic + c0];
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; c++) {
+                        float s = 0.f;
+                        for (int k = 0; k < alpha; k++)
+                            s += tmp[i][k][c] * BT[j][k];
+                        v[c] = s;
+                    }
+                }
+        }
+    }
+}
+
+// M[i][j][tile][oc] = (A * diff_dst_tile[oc] * A^T)[i][j], the matrices of
+// the points are M_k_stride apart. Points of the tile beyond the output are
+// read as zeroes.
+void transform_diff_dst(const conf_t &conf,
+        const memory_desc_wrapper &diff_dst_d, const float *diff_dst,
+        float *__restrict M, dim_t M_k_stride, int tile_start, int ntiles) {
+    for (int t = 0; t < ntiles; t++) {
+        int n, ty, tx;
+        tile_pos(conf, tile_start + t, n, ty, tx);
+        const int oh0 = ty * tile_size;
+        const int ow0 = tx * tile_size;
+
+        const float *pts[tile_size][tile_size];
+        for (int i = 0; i < tile_size; i++)
+            for (int j = 0; j < tile_size; j++) {
+                const int oh = oh0 + i, ow = ow0 + j;
+                const bool inside = oh < conf.oh && ow < conf.ow;
+                pts[i][j] = inside ? &diff_dst[diff_dst_d.off(n, 0, oh, ow)]
+                                   : nullptr;
+            }
+
+        for (int c0 = 0; c0 < conf.oc; c0 += simd_w) {
+            const int len = nstl::min(simd_w, conf.oc - c0);
+            const dim_t c_off = vec_off(diff_dst_d, c0);
+            float d[tile_size][tile_size][simd_w];
+            float tmp[alpha][tile_size][simd_w];
+
+            for (int i = 0; i < tile_size; i++)
+                for (int j = 0; j < tile_size; j++) {
+                    if (pts[i][j]) {
+                        for (int c = 0; c < len; c++)
+                            d[i][j][c] = pts[i][j][c_off + c];
+                    } else {
+                        for (int c = 0; c < len; c++)
+                            d[i][j][c] = 0.f;
+                    }
+                }
+
+            for (int i = 0; i < alpha; i++)
+                for (int j = 0; j < tile_size; j++) {
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; c++) {
+                        float s = 0.f;
+                        for (int k = 0; k < tile_size; k++)
+                            s += AT[k][i] * d[k][j][c];
+                        tmp[i][j][c] = s;
+                    }
+                }
+
+            for (int i = 0; i < alpha; i++)
+                for (int j = 0; j < alpha; j++) {
+                    float *m = &M[(i * alpha + j) * M_k_stride
+                            + (dim_t)t * conf.oc + c0];
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; c++) {
+                        float s = 0.f;
+                        for (int k = 0; k < tile_size; k++)
+                            s += tmp[i][k][c] * AT[k][j];
+                        m[c] = s;
+                    }
+                }
+        }
+    }
+}
+
+// dst_tile[oc] = A^T * M[tile][oc] * A, followed by the bias and the post-ops
+void transform_dst(const conf_t &conf, const memory_desc_wrapper &dst_d,
+        const float *__restrict M, const float *bias,
+        ref_eltwise_scalar_fwd_t *eltwise, float *dst, int tile_start,
+        int ntiles) {
+    const dim_t M_k_stride = (dim_t)conf.tile_block * conf.oc;
+
+    for (int t = 0; t < ntiles; t++) {
+        int n, ty, tx;
+        tile_pos(conf, tile_start + t, n, ty, tx);
+        const int oh0 = ty * tile_size;
+        const int ow0 = tx * tile_size;
+
+        for (int c0 = 0; c0 < conf.oc; c0 += simd_w) {
+            const int len = nstl::min(simd_w, conf.oc - c0);
+            float tmp[tile_size][alpha][simd_w];
+            float y[simd_w];
+
+            for (int i = 0; i < tile_size; i++)
+                for (int j = 0; j < alpha; j++) {
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; c++) {
+                        float s = 0.f;
+                        for (int k = 0; k < alpha; k++)
+                            s += AT[i][k]
+                                    * M[(k * alpha + j) * M_k_stride
+                                            + (dim_t)t * conf.oc + c0 + c];
+                        tmp[i][j][c] = s;
+                    }
+                }
+
+            for (int i = 0; i < tile_size; i++) {
+                const int oh = oh0 + i;
+                if (oh >= conf.oh) break;
+                for (int j = 0; j < tile_size; j++) {
+                    const int ow = ow0 + j;
+                    if (ow >= conf.ow) break;
+                    float *d = &dst[dst_d.off(n, 0, oh, ow)
+                            + vec_off(dst_d, c0)];
+
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; c++) {
+                        float s = 0.f;
+                        for (int k = 0; k < alpha; k++)
+                            s += tmp[i][k][c] * AT[j][k];
+                        y[c] = s;
+                    }
+                    if (conf.with_bias) {
+                        PRAGMA_OMP_SIMD()
+                        for (int c = 0; c < len; c++)
+                            y[c] += bias[c0 + c];
+                    }
+                    if (conf.with_sum) {
+                        PRAGMA_OMP_SIMD()
+                        for (int c = 0; c < len; c++)
+                            y[c] += conf.sum_scale * d[c];
+                    }
+                    if (eltwise) {
+                        for (int c = 0; c < len; c++)
+                            y[c] = eltwise->compute_scalar(y[c]);
+                    }
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; c++)
+                        d[c] = y[c];
+                }
+            }
+        }
+    }
+}
+
+// Computes dst from src and the transformed weights U, tile block by tile
+// block. The forward and the backward data propagations differ only in the
+// arguments.
+status_t execute_tiles(const conf_t &conf, const float *U,
+        const memory_desc_wrapper &src_d, const float *src,
+        const memory_desc_wrapper &dst_d, float *dst, const float *bias,
+        ref_eltwise_scalar_fwd_t *eltwise, float *V, float *M) {
+    const int ntiles = conf.mb * conf.tiles_h * conf.tiles_w;
+    const dim_t V_thr_size = (dim_t)alpha * alpha * conf.tile_block * conf.ic;
+    const dim_t M_thr_size = (dim_t)alpha * alpha * conf.tile_block * conf.oc;
+    std::atomic<status_t> st(status::success);
+
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        float *V_thr = V + ithr * V_thr_size;
+        float *M_thr = M + ithr * M_thr_size;
+
+        int start = 0, end = 0;
+        balance211(conf.nb_tile_blocks, nthr, ithr, start, end);
+        for (int tb = start; tb < end; tb++) {
+            const int tile_start = tb * conf.tile_block;
+            const int nt = nstl::min(conf.tile_block, ntiles - tile_start);
+            transform_src(conf, src_d, src, V_thr,
+                    (dim_t)conf.tile_block * conf.ic, tile_start, nt);
+
+            // M[k] = V[k] * U[k] for every point k of the tiles, the
+            // matrices are in the row-major order.
+            const dim_t m = conf.oc, n = nt, k = conf.ic;
+            const dim_t lda = conf.oc, ldb = conf.ic, ldc = conf.oc;
+            const float one = 1.f, zero = 0.f;
+            for (int p = 0; p < alpha * alpha; p++) {
+                status_t st_thr = extended_sgemm("N", "N", &m, &n, &k, &one,
+                        U + p * k * m, &lda, V_thr + p * conf.tile_block * k,
+                        &ldb, &zero, M_thr + p * conf.tile_block * m, &ldc);
+                if (st_thr != status::success) {
+                    st = st_thr;
+                    return;
+                }
+            }
+
+            transform_dst(conf, dst_d, M_thr, bias, eltwise, dst, tile_start,
+                    nt);
+        }
+    });
+
+    return st;
+}
+// Computes the gradient dU of the transformed weights from src and diff_dst.
+// The tiles are processed in steps of a tile block per thread. The threads
+// transform their part of a step, then the gradients of the points are
+// accumulated by GEMMs over all the tiles of the step, split between the
+// threads by the points and the blocks of oc.
+status_t execute_tiles_bwd_weights(const conf_t &conf,
+        const memory_desc_wrapper &src_d, const float *src,
+        const memory_desc_wrapper &diff_dst_d, const float *diff_dst,
+        float *V, float *M, float *dU) {
+    const int ntiles = conf.mb * conf.tiles_h * conf.tiles_w;
+    const int step = conf.nthr * conf.tile_block;
+    const int nb_oc = nstl::min(
+            div_up(conf.nthr, alpha * alpha), div_up(conf.oc, simd_w));
+    const int oc_block = rnd_up(div_up(conf.oc, nb_oc), simd_w);
+    std::atomic<status_t> st(status::success);
+
+    for (int step_start = 0; step_start < ntiles; step_start += step) {
+        const int nt = nstl::min(step, ntiles - step_start);
+
+        parallel(conf.nthr, [&](const int ithr, const int nthr) {
+            int start = 0, end = 0;
+            balance211(nt, nthr, ithr, start, end);
+            transform_src(conf, src_d, src, V + (dim_t)start * conf.ic,
+                    (dim_t)step * conf.ic, step_start + start, end - start);
+            transform_diff_dst(conf, diff_dst_d, diff_dst,
+                    M + (dim_t)start * conf.oc, (dim_t)step * conf.oc,
+                    step_start + start, end - start);
+        });
+
+        // dU[k] += V[k]^T * M[k] for every point k of the tiles, the
+        // matrices are in the row-major order.
+        const float beta = step_start == 0 ? 0.f : 1.f;
+        parallel(conf.nthr, [&](const int ithr, const int nthr) {
+            int start = 0, end = 0;
+            balance211(alpha * alpha * nb_oc, nthr, ithr, start, end);
+            for (int w = start; w < end; w++) {
+                const int p = w / nb_oc;
+                const int oc_start = (w % nb_oc) * oc_block;
+                if (oc_start >= conf.oc) continue;
+
+                const dim_t m = nstl::min(oc_block, conf.oc - oc_start);
+                const dim_t n = conf.ic, k = nt;
+                const dim_t lda = conf.oc, ldb = conf.ic, ldc = conf.oc;
+                const float one = 1.f;
+                status_t st_thr = extended_sgemm("N", "T", &m, &n, &k, &one,
+                        M + p * step * lda + oc_start, &lda,
+                        V + p * step * ldb, &ldb, &beta,
+                        dU + p * n * ldc + oc_start, &ldc);
+                if (st_thr != status::success) st = st_thr;
+            }
+        });
+        if (st != status::success) return st;
+    }
+
+    return st;
+}
+
+} // namespace
+
+namespace gemm_winograd {
+
+format_tag_t pick_dat_tag(
+        const memory_desc_t &src_md, const memory_desc_t &dst_md) {
+    using namespace format_tag;
+    const bool is_nhwc = memory_desc_matches_tag(src_md, nhwc)
+            || memory_desc_matches_tag(dst_md, nhwc);
+    return is_nhwc ? nhwc : nChw16c;
+}
+
+status_t init_conf(conf_t &conf, memory_tracking::registrar_t &scratchpad,
+        const convolution_desc_t &cd, const memory_desc_t &src_md,
+        const memory_desc_t &weights_md, const memory_desc_t &dst_md,
+        const primitive_attr_t &attr, int max_threads) {
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper weights_d(&weights_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    if (with_groups || src_d.ndims() != 4) return unimplemented;
+
+    const int ih = src_d.dims()[2], iw = src_d.dims()[3];
+    const int oh = dst_d.dims()[2], ow = dst_d.dims()[3];
+    const int t_pad = cd.padding[0][0], l_pad = cd.padding[0][1];
+    const int b_pad = oh + 2 - ih - t_pad, r_pad = ow + 2 - iw - l_pad;
+
+    // Larger paddings would leave most of the border tiles empty.
+    const bool shape_ok = true && weights_d.dims()[2] == 3
+            && weights_d.dims()[3] == 3 && cd.strides[0] == 1
+            && cd.strides[1] == 1 && cd.dilates[0] == 0 && cd.dilates[1] == 0
+            && t_pad <= 1 && l_pad <= 1 && b_pad <= 1 && r_pad <= 1;
+    if (!shape_ok) return unimplemented;
+
+    conf.prop_kind = cd.prop_kind;
+    conf.mb = src_d.dims()[0];
+    if (conf.prop_kind == prop_kind::backward_data) {
+        // diff_src[ih] = sum_kh diff_dst[ih + t_pad - kh] * w[kh], which is
+        // a forward convolution of diff_dst with the flipped weights and the
+        // padding of 2 - t_pad.
+        conf.ic = dst_d.dims()[1];
+        conf.oc = src_d.dims()[1];
+        conf.ih = oh;
+        conf.iw = ow;
+        conf.oh = ih;
+        conf.ow = iw;
+        conf.t_pad = 2 - t_pad;
+        conf.l_pad = 2 - l_pad;
+    } else {
+        conf.ic = src_d.dims()[1];
+        conf.oc = dst_d.dims()[1];
+        conf.ih = ih;
+        conf.iw = iw;
+        conf.oh = oh;
+        conf.ow = ow;
+        conf.t_pad = t_pad;
+        conf.l_pad = l_pad;
+    }
+
+    conf.tiles_h = div_up(conf.oh, tile_size);
+    conf.tiles_w = div_up(conf.ow, tile_size);
+    const int ntiles = conf.mb * conf.tiles_h * conf.tiles_w;
+
+    // The transformed tiles of a block are kept in the L2 cache for the
+    // GEMMs, the block is still big enough for the GEMMs to be efficient.
+    const size_t L2 = platform::get_per_core_cache_size(2);
+    const size_t tile_bytes
+            = sizeof(float) * alpha * alpha * (conf.ic + conf.oc);
+    conf.tile_block = nstl::max(32, (int)(L2 / tile_bytes));
+    conf.tile_block = nstl::min(conf.tile_block, 256);
+    conf.tile_block = nstl::max(
+            1, nstl::min(conf.tile_block, div_up(ntiles, max_threads)));
+    conf.nb_tile_blocks = div_up(ntiles, conf.tile_block);
+    conf.nthr = nstl::min(max_threads, conf.nb_tile_blocks);
+
+    const auto &post_ops = attr.post_ops_;
+    const int sum_idx = post_ops.find(primitive_kind::sum);
+    conf.with_sum = sum_idx != -1;
+    conf.sum_scale = conf.with_sum ? post_ops.entry_[sum_idx].sum.scale : 0.f;
+    conf.with_eltwise = post_ops.find(primitive_kind::eltwise) != -1;
+    // For backward data the bias is the deconvolution one over diff_src.
+    conf.with_bias = pick_by_prop_kind(conf.prop_kind, cd.bias_desc.format_kind,
+                             cd.bias_desc.format_kind,
+                             cd.diff_bias_desc.format_kind)
+            != format_kind::undef;
+
+    scratchpad.book<float>(
+            key_wino_U, (size_t)alpha * alpha * conf.ic * conf.oc);
+    scratchpad.book<float>(key_wino_V,
+            (size_t)conf.nthr * alpha * alpha * conf.tile_block * conf.ic);
+    scratchpad.book<float>(key_wino_M,
+            (size_t)conf.nthr * alpha * alpha * conf.tile_block * conf.oc);
+
+    return success;
+}
+
+bool is_profitable(const conf_t &conf) {
+    // The transforms are amortized by the GEMMs only for wide enough layers,
+    // and small images waste too much of the tiles on the padding.
+    return conf.ic >= 64 && conf.oc >= 64 && conf.oh >= 8 && conf.ow >= 8;
+}
+
+} // namespace gemm_winograd
+
+status_t gemm_winograd_convolution_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto wei = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const conf_t &conf = pd()->conf_;
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    data_t *U = scratchpad.get<data_t>(key_wino_U);
+    data_t *V = scratchpad.get<data_t>(key_wino_V);
+    data_t *M = scratchpad.get<data_t>(key_wino_M);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    transform_weights(conf, weights_d, wei, U);
+    return execute_tiles(
+            conf, U, src_d, src, dst_d, dst, bias, eltwise_, V, M);
+}
+
+status_t gemm_winograd_convolution_bwd_data_t::execute_backward_data(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
+    auto wei = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
+    auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+
+    const conf_t &conf = pd()->conf_;
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    data_t *U = scratchpad.get<data_t>(key_wino_U);
+    data_t *V = scratchpad.get<data_t>(key_wino_V);
+    data_t *M = scratchpad.get<data_t>(key_wino_M);
+
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    transform_weights(conf, weights_d, wei, U);
+    return execute_tiles(conf, U, diff_dst_d, diff_dst, diff_src_d, diff_src,
+            bias, nullptr, V, M);
+}
+
+status_t gemm_winograd_convolution_bwd_weights_t::execute_backward_weights(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto diff_wei = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_WEIGHTS);
+    auto diff_bias = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_BIAS);
+
+    const conf_t &conf = pd()->conf_;
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    data_t *dU = scratchpad.get<data_t>(key_wino_U);
+    data_t *V = scratchpad.get<data_t>(key_wino_V);
+    data_t *M = scratchpad.get<data_t>(key_wino_M);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_weights_d(pd()->diff_weights_md(0));
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    status_t st = execute_tiles_bwd_weights(
+            conf, src_d, src, diff_dst_d, diff_dst, V, M, dU);
+    if (st != status::success) return st;
+
+    transform_diff_weights(conf, diff_weights_d, dU, diff_wei);
+
+    if (conf.with_bias) {
+        parallel_nd(div_up(conf.oc, simd_w), [&](int ocb) {
+            const int c0 = ocb * simd_w;
+            const int len = nstl::min(simd_w, conf.oc - c0);
+            const dim_t c_off = vec_off(diff_dst_d, c0);
+            float s[simd_w] = {0.f};
+            for_(int n = 0; n < conf.mb; n++)
+            for_(int oh = 0; oh < conf.oh; oh++)
+            for (int ow = 0; ow < conf.ow; ow++) {
+                const data_t *d
+                        = &diff_dst[diff_dst_d.off(n, 0, oh, ow) + c_off];
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < len; c++)
+                    s[c] += d[c];
+            }
+            for (int c = 0; c < len; c++)
+                diff_bias[c0 + c] = s[c];
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,287 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_GEMM_WINOGRAD_CONVOLUTION_HPP
+#define CPU_AARCH64_GEMM_WINOGRAD_CONVOLUTION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/ref_eltwise.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace gemm_winograd {
+
+// Winograd F(4x4, 3x3): every 4x4 output tile is computed from a 6x6 input
+// tile. The input tiles and the weights are transformed to alpha x alpha
+// matrices, their products for the same alpha x alpha point are computed by
+// a GEMM over the channels and the result is transformed back. The backward
+// weights propagation computes the gradient of the transformed weights by a
+// GEMM over the tiles for every point and transforms it back.
+constexpr int alpha = 6;
+constexpr int tile_size = 4;
+
+// The problem is described as a forward convolution. For the backward data
+// propagation diff_dst is the input of the tiles, diff_src is their output,
+// the channels are swapped and the weights are flipped.
+struct conf_t {
+    prop_kind_t prop_kind;
+    int mb, ic, oc;
+    int ih, iw, oh, ow;
+    int t_pad, l_pad;
+    int tiles_h, tiles_w;
+    // number of tiles processed by a thread at once
+    int tile_block;
+    int nb_tile_blocks;
+    int nthr;
+    bool with_bias, with_sum, with_eltwise;
+    float sum_scale;
+};
+
+status_t init_conf(conf_t &conf, memory_tracking::registrar_t &scratchpad,
+        const convolution_desc_t &cd, const memory_desc_t &src_md,
+        const memory_desc_t &weights_md, const memory_desc_t &dst_md,
+        const primitive_attr_t &attr, int max_threads);
+
+// The channels of a point are read in vectors of 16, which are contiguous in
+// both nhwc and nChw16c. The blocked layout is used unless the user tensors
+// are nhwc, as it is the one of the direct convolutions.
+format_tag_t pick_dat_tag(
+        const memory_desc_t &src_md, const memory_desc_t &dst_md);
+
+// Returns true if the Winograd algorithm is expected to be faster than the
+// direct one for the problem, used to resolve alg_kind::convolution_auto.
+bool is_profitable(const conf_t &conf);
+
+} // namespace gemm_winograd
+
+struct gemm_winograd_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), conf_() {}
+
+        DECLARE_COMMON_PD_T("gemm_wino_4x3:any",
+                gemm_winograd_convolution_fwd_t, USE_GLOBAL_SCRATCHPAD);
+
+        status_t init(engine_t *engine) {
+            using namespace format_tag;
+            const format_tag_t dat_tag
+                    = gemm_winograd::pick_dat_tag(src_md_, dst_md_);
+            bool ok = true && is_fwd()
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32)
+                    && !has_zero_dim_memory()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops,
+                            data_type::f32)
+                    && post_ops_ok()
+                    && set_default_formats_common(dat_tag, oihw, dat_tag)
+                    && memory_desc_matches_tag(src_md_, dat_tag)
+                    && memory_desc_matches_tag(dst_md_, dat_tag);
+            if (!ok) return status::unimplemented;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            status_t status = gemm_winograd::init_conf(conf_, scratchpad,
+                    *desc(), src_md_, weights_md_, dst_md_, *attr(),
+                    dnnl_get_max_threads());
+            if (status != status::success) return status;
+
+            if (desc()->alg_kind == alg_kind::convolution_auto
+                    && !gemm_winograd::is_profitable(conf_))
+                return status::unimplemented;
+            set_default_alg_kind(alg_kind::convolution_winograd);
+            return status::success;
+        }
+
+        gemm_winograd::conf_t conf_;
+
+    protected:
+        bool post_ops_ok() const {
+            auto const &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+            auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(); };
+
+            switch (po.len()) {
+                case 0: return true; // no post_ops
+                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+                default: return false;
+            }
+            return false;
+        }
+    };
+
+    gemm_winograd_convolution_fwd_t(const pd_t *apd)
+        : primitive_t(apd), eltwise_(nullptr) {
+        const auto &post_ops = pd()->attr()->post_ops_;
+        const int entry_idx = post_ops.find(primitive_kind::eltwise);
+        if (entry_idx != -1)
+            eltwise_ = new ref_eltwise_scalar_fwd_t(
+                    post_ops.entry_[entry_idx].eltwise);
+    }
+
+    ~gemm_winograd_convolution_fwd_t() { delete eltwise_; }
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    ref_eltwise_scalar_fwd_t *eltwise_;
+};
+
+struct gemm_winograd_convolution_bwd_data_t : public primitive_t {
+    struct pd_t : public cpu_convolution_bwd_data_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_data_pd_t(adesc, attr, hint_fwd_pd)
+            , conf_() {}
+
+        DECLARE_COMMON_PD_T("gemm_wino_4x3:any",
+                gemm_winograd_convolution_bwd_data_t, USE_GLOBAL_SCRATCHPAD);
+
+        status_t init(engine_t *engine) {
+            using namespace format_tag;
+            const format_tag_t dat_tag
+                    = gemm_winograd::pick_dat_tag(diff_src_md_, diff_dst_md_);
+            bool ok = true && desc()->prop_kind == prop_kind::backward_data
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(data_type::f32, data_type::f32,
+                            data_type::undef, data_type::f32, data_type::f32)
+                    && IMPLICATION(with_bias(),
+                            desc()->bias_desc.data_type == data_type::f32)
+                    && !has_zero_dim_memory() && attr()->has_default_values()
+                    && set_default_formats_common(dat_tag, oihw, dat_tag)
+                    && memory_desc_matches_tag(diff_src_md_, dat_tag)
+                    && memory_desc_matches_tag(diff_dst_md_, dat_tag);
+            if (!ok) return status::unimplemented;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            status_t status = gemm_winograd::init_conf(conf_, scratchpad,
+                    *desc(), diff_src_md_, weights_md_, diff_dst_md_, *attr(),
+                    dnnl_get_max_threads());
+            if (status != status::success) return status;
+
+            if (desc()->alg_kind == alg_kind::convolution_auto
+                    && !gemm_winograd::is_profitable(conf_))
+                return status::unimplemented;
+            set_default_alg_kind(alg_kind::convolution_winograd);
+            return status::success;
+        }
+
+        bool support_bias() const override { return true; }
+
+        gemm_winograd::conf_t conf_;
+    };
+
+    gemm_winograd_convolution_bwd_data_t(const pd_t *apd) : primitive_t(apd) {}
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward_data(ctx);
+    }
+
+private:
+    status_t execute_backward_data(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+struct gemm_winograd_convolution_bwd_weights_t : public primitive_t {
+    struct pd_t : public cpu_convolution_bwd_weights_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_weights_pd_t(adesc, attr, hint_fwd_pd)
+            , conf_() {}
+
+        DECLARE_COMMON_PD_T("gemm_wino_4x3:any",
+                gemm_winograd_convolution_bwd_weights_t,
+                USE_GLOBAL_SCRATCHPAD);
+
+        status_t init(engine_t *engine) {
+            using namespace format_tag;
+            const format_tag_t dat_tag
+                    = gemm_winograd::pick_dat_tag(src_md_, diff_dst_md_);
+            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32)
+                    && !has_zero_dim_memory() && attr()->has_default_values()
+                    && set_default_formats_common(dat_tag, oihw, dat_tag)
+                    && memory_desc_matches_tag(src_md_, dat_tag)
+                    && memory_desc_matches_tag(diff_dst_md_, dat_tag)
+                    // the padded area of blocked weights is not zeroed
+                    && memory_desc_wrapper(diff_weights_md_).is_plain();
+            if (!ok) return status::unimplemented;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            status_t status = gemm_winograd::init_conf(conf_, scratchpad,
+                    *desc(), src_md_, diff_weights_md_, diff_dst_md_, *attr(),
+                    dnnl_get_max_threads());
+            if (status != status::success) return status;
+
+            if (desc()->alg_kind == alg_kind::convolution_auto
+                    && !gemm_winograd::is_profitable(conf_))
+                return status::unimplemented;
+            set_default_alg_kind(alg_kind::convolution_winograd);
+            return status::success;
+        }
+
+        gemm_winograd::conf_t conf_;
+    };
+
+    gemm_winograd_convolution_bwd_weights_t(const pd_t *apd)
+        : primitive_t(apd) {}
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward_weights(ctx);
+    }
+
+private:
+    status_t execute_backward_weights(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
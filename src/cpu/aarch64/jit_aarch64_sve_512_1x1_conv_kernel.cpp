@@ -354,7 +354,8 @@ void jit_aarch64_sve_512_1x1_conv_kernel::reduce_loop(
         }
 
         if (jcp.with_bias
-                && one_of(jcp.prop_kind, forward_training, forward_inference)) {
+                && one_of(jcp.prop_kind, forward_training, forward_inference,
+                        backward_data)) {
 
             CGA64::tst(reg_reduce_pos_flag, FLAG_REDUCE_FIRST);
             CGA64::b(xa::EQ, init_zero);
@@ -602,6 +603,9 @@ void jit_aarch64_sve_512_1x1_conv_kernel::generate() {
                         reg_tmp_imm);
                 break;
             case backward_data:
+                CGA64::add_imm(reg_bias_data, reg_bias_data,
+                        load_loop_blk * jcp.load_block * jcp.typesize_out,
+                        reg_tmp_imm);
                 CGA64::add_imm(reg_output_data, reg_output_data,
                         load_loop_blk * jcp.load_block * jcp.typesize_out
                                 * (is_out_layout_nxc(jcp) ? 1 : jcp.bcast_dim),
@@ -747,9 +751,10 @@ status_t jit_aarch64_sve_512_1x1_conv_kernel::init_conf(
     jcp.stride_d = (ndims == 5) ? cd.strides[0] : 1;
     jcp.stride_h = (ndims == 3) ? 1 : cd.strides[ndims - 4];
     jcp.stride_w = cd.strides[ndims - 3];
-    /* bias info */
+    /* bias info: for backward data it is the deconvolution bias over ic */
     jcp.with_bias = pick_by_prop_kind(jcp.prop_kind, cd.bias_desc.format_kind,
-                            format_kind::undef, cd.diff_bias_desc.format_kind)
+                            cd.bias_desc.format_kind,
+                            cd.diff_bias_desc.format_kind)
             != format_kind::undef;
 
     /* Spatials */
@@ -1255,6 +1260,10 @@ void jit_aarch64_sve_512_1x1_conv_kernel::init_scratchpad(
                 key_conv_padded_bias, nelems_padded_bias, jcp.typesize_out);
     }
 
+    if (jcp.with_bias && jcp.prop_kind == backward_data
+            && jcp.ic != jcp.ic_without_padding)
+        scratchpad.book(key_conv_padded_bias, jcp.ic, jcp.typesize_out);
+
     if (jcp.prop_kind == backward_weights) {
         const size_t wei_size = (size_t)jcp.ngroups
                 * rnd_up(jcp.oc, jcp.oc_block) * rnd_up(jcp.ic, jcp.ic_block);
@@ -416,6 +416,7 @@ void jit_aarch64_sve_512_1x1_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
@@ -423,6 +424,16 @@ void jit_aarch64_sve_512_1x1_convolution_bwd_data_t<diff_dst_type, wei_type,
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
 
     const auto &jcp = kernel_->jcp;
+
+    if (bias && jcp.ic != jcp.ic_without_padding) {
+        auto padded_bias = ctx.get_scratchpad_grantor()
+                                   .template get<diff_src_data_t>(
+                                           key_conv_padded_bias);
+        utils::array_copy(padded_bias, bias, jcp.ic_without_padding);
+        utils::array_set(padded_bias + jcp.ic_without_padding,
+                (diff_src_data_t)0, jcp.ic - jcp.ic_without_padding);
+        bias = padded_bias;
+    }
     auto rtus_space = pd()->rtus_.reduce_src_
             ? ctx.get_scratchpad_grantor().template get<diff_src_data_t>(
                     key_conv_rtus_space)
@@ -544,6 +555,9 @@ void jit_aarch64_sve_512_1x1_convolution_bwd_data_t<diff_dst_type, wei_type,
                                         : weights_d.blk_off(ocb, icb)];
 
                         p.first_last_flag = ocb == 0 ? FLAG_REDUCE_FIRST : 0;
+                        p.bias_data = bias
+                                ? &bias[g * jcp.ic + icb * jcp.ic_block]
+                                : nullptr;
 
                         p.reduce_dim = this_block_size(ocb * jcp.oc_block,
                                 jcp.oc, nb_oc_blocking_step * jcp.oc_block);
@@ -300,6 +300,8 @@ struct jit_aarch64_sve_512_1x1_convolution_bwd_data_t : public primitive_t {
                     && set_default_alg_kind(alg_kind::convolution_direct)
                     && expect_data_types(diff_src_type, wei_type,
                             data_type::undef, diff_dst_type, data_type::undef)
+                    && IMPLICATION(with_bias(),
+                            desc()->bias_desc.data_type == diff_src_type)
                     && attr()->has_default_values() && !has_zero_dim_memory()
                     && set_default_formats();
             if (!ok) return status::unimplemented;
@@ -307,6 +309,10 @@ struct jit_aarch64_sve_512_1x1_convolution_bwd_data_t : public primitive_t {
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *diff_src_d = diff_src_md();
             rtus_prepare(this, conv_d, diff_src_d, diff_dst_md());
+            // The strided case scatters through rtus and leaves the skipped
+            // diff_src points untouched by the kernel, so the fused bias
+            // would miss them.
+            if (with_bias() && rtus_.reduce_src_) return status::unimplemented;
 
             status_t status = jit_aarch64_sve_512_1x1_conv_kernel::init_conf(
                     jcp_, *conv_d, *diff_src_d, *weights_md(), *diff_dst_md(),
@@ -322,6 +328,8 @@ struct jit_aarch64_sve_512_1x1_convolution_bwd_data_t : public primitive_t {
             return status::success;
         }
 
+        bool support_bias() const override { return true; }
+
         // TODO (Roma): structs conf header cleanup
         jit_1x1_conv_conf_t jcp_;
         reduce_to_unit_stride_t rtus_;
@@ -1418,10 +1418,11 @@ void _jit_aarch64_sve_512_conv_bwd_data_kernel_f32<Vmm>::store_output(
     };
 
     xa::LabelAArch64 no_update_label;
+    xa::LabelAArch64 bias_label;
 
     CGA64::ldr(reg_channel, xa::ptr(param, GET_OFF(channel)));
     CGA64::cmp(reg_channel, 0);
-    CGA64::b(xa::EQ, no_update_label);
+    CGA64::b(xa::EQ, jcp.with_bias ? bias_label : no_update_label);
     int prev_ofs = 0;
     for (int k = 0; k < jcp.nb_ic_blocking; k++) {
         for (int j = 0; j < ur_w; j++) {
@@ -1444,6 +1445,21 @@ void _jit_aarch64_sve_512_conv_bwd_data_kernel_f32<Vmm>::store_output(
         }
     }
 
+    if (jcp.with_bias) {
+        // The deconvolution bias is added once, with the first oc chunk.
+        CGA64::b(no_update_label);
+        CGA64::L_aarch64(bias_label);
+        CGA64::ldr(reg_tmp_addr, xa::ptr(param, GET_OFF(bias)));
+        for (int k = 0; k < jcp.nb_ic_blocking; k++) {
+            int bias_ofs = typesize * k * jcp.ic_block;
+            CGA64::ldr(zreg_tmp(0),
+                    xa::ptr(reg_tmp_addr,
+                            static_cast<int32_t>(VL_OFS(bias_ofs))));
+            for (int j = 0; j < ur_w; j++)
+                CGA64::fadd(zreg_out_s(j, k), zreg_out_s(j, k), zreg_tmp_s(0));
+        }
+    }
+
     CGA64::L_aarch64(no_update_label);
     prev_ofs = 0;
     for (int k = 0; k < jcp.nb_ic_blocking; k++) {
@@ -2332,6 +2348,9 @@ status_t jit_aarch64_sve_512_conv_bwd_data_kernel_f32::init_conf(
     if (!IMPLICATION(!is_data_layout_nxc,
                 jcp.oc % jcp.oc_block == 0 && jcp.ic % jcp.ic_block == 0))
         return status::unimplemented;
+    // A deconvolution runs as a backward data convolution with the bias
+    // over the channels of diff_src.
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
     jcp.ic_tail = is_data_layout_nxc ? jcp.ic % jcp.simd_w : 0;
     jcp.oc_tail = is_data_layout_nxc ? jcp.oc % jcp.simd_w : 0;
 
@@ -2636,8 +2655,8 @@ status_t jit_aarch64_sve_512_conv_bwd_data_kernel_f32::init_conf(
 
 void jit_aarch64_sve_512_conv_bwd_data_kernel_f32::init_scratchpad(
         memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
-    UNUSED(scratchpad);
-    UNUSED(jcp);
+    if (jcp.with_bias && jcp.ic != jcp.ic_without_padding)
+        scratchpad.book(key_conv_padded_bias, jcp.ic, jcp.typesize_out);
 }
 
 // Initialize static data members
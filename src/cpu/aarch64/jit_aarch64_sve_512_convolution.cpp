@@ -639,14 +639,33 @@ void jit_aarch64_sve_512_convolution_fwd_t<src_type, wei_type,
 
 template struct jit_aarch64_sve_512_convolution_fwd_t<data_type::f32>;
 
+template <data_type_t diff_dst_type, data_type_t wei_type,
+        data_type_t diff_src_type>
+void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
+        diff_src_type>::prepare_padded_bias(const diff_src_data_t *&bias,
+        const memory_tracking::grantor_t &scratchpad) const {
+    const auto &jcp = pd()->jcp_;
+    if (bias == nullptr || jcp.ic == jcp.ic_without_padding) return;
+
+    auto padded_bias
+            = scratchpad.template get<diff_src_data_t>(key_conv_padded_bias);
+    utils::array_copy(padded_bias, bias, jcp.ic_without_padding);
+    utils::array_set(padded_bias + jcp.ic_without_padding,
+            (diff_src_data_t)0, jcp.ic - jcp.ic_without_padding);
+    bias = padded_bias;
+}
+
 template <data_type_t diff_dst_type, data_type_t wei_type,
         data_type_t diff_src_type>
 void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_1d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -707,6 +726,8 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
                 auto diff_dst_w
                         = diff_dst + diff_dst_d.blk_off(n, oc_off_idx, ow_s);
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb);
+                auto bias_w = bias ? bias + g * jcp.ic + icb * jcp.ic_block
+                                   : nullptr;
 
                 int ocb_step = is_ddst_layout_nxc ? jcp.nb_oc_L2 : 1;
                 int ocb_end = min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2);
@@ -721,7 +742,7 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
                     }
 
                     jit_conv_ker_pipeline_iw_thr(kernel_->jit_ker, par_conv,
-                            diff_src_w, diff_dst_w, wht_w, 0, ocb, 1, iwb,
+                            diff_src_w, diff_dst_w, wht_w, bias_w, ocb, 1, iwb,
                             reduce_work, load_work);
                     diff_dst_w += diff_dst_c_stride;
                     wht_w += wht_oc_stride;
@@ -760,8 +781,11 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_2d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -829,6 +853,8 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
                 auto diff_dst_w
                         = diff_dst + diff_dst_d.blk_off(n, oc_off_idx, 0, ow_s);
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb);
+                auto bias_w = bias ? bias + g * jcp.ic + icb * jcp.ic_block
+                                   : nullptr;
 
                 int ocb_step = is_ddst_layout_nxc ? jcp.nb_oc_L2 : 1;
                 int ocb_end = min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2);
@@ -890,8 +916,8 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
                         jit_conv_ker_pipeline_iw_thr(kernel_->jit_ker, par_conv,
                                 diff_src_w + ij * diff_src_h_stride,
                                 diff_dst_w + oj * diff_dst_h_stride,
-                                wht_w + k_lo * wht_h_stride, 0, ocb, k_len, iwb,
-                                reduce_work, load_work);
+                                wht_w + k_lo * wht_h_stride, bias_w, ocb, k_len,
+                                iwb, reduce_work, load_work);
                     }
                     diff_dst_w += diff_dst_c_stride;
                     wht_w += wht_oc_stride;
@@ -927,8 +953,11 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_3d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -1041,6 +1070,8 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
                         + d_oj * diff_dst_d_stride;
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb)
                         + d_lo * wht_d_stride;
+                auto bias_w = bias ? bias + g * jcp.ic + icb * jcp.ic_block
+                                   : nullptr;
 
                 int ocb_step = is_ddst_layout_nxc ? jcp.nb_oc_L2 : 1;
                 int ocb_end = min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2);
@@ -1104,7 +1135,7 @@ void jit_aarch64_sve_512_convolution_bwd_data_t<diff_dst_type, wei_type,
                                 kernel_->jit_ker, par_conv,
                                 diff_src_w + ij * diff_src_h_stride,
                                 diff_dst_w + oj * diff_dst_h_stride,
-                                wht_w + k_lo * wht_h_stride, 0, ocb, k_len,
+                                wht_w + k_lo * wht_h_stride, bias_w, ocb, k_len,
                                 d_len, reduce_work, load_work);
                     }
                     diff_dst_w += diff_dst_c_stride;
@@ -141,6 +141,8 @@ struct jit_aarch64_sve_512_convolution_bwd_data_t : public primitive_t {
                     && set_default_alg_kind(alg_kind::convolution_direct)
                     && expect_data_types(diff_src_type, wei_type,
                             data_type::undef, diff_dst_type, data_type::undef)
+                    && IMPLICATION(with_bias(),
+                            desc()->bias_desc.data_type == diff_src_type)
                     && attr()->has_default_values() && !has_zero_dim_memory();
             if (!ok) return status::unimplemented;
 
@@ -157,6 +159,8 @@ struct jit_aarch64_sve_512_convolution_bwd_data_t : public primitive_t {
             return status::success;
         }
 
+        bool support_bias() const override { return true; }
+
         jit_conv_conf_t jcp_;
     };
 
@@ -186,6 +190,8 @@ private:
     void execute_backward_data_1d(const exec_ctx_t &ctx) const;
     void execute_backward_data_2d(const exec_ctx_t &ctx) const;
     void execute_backward_data_3d(const exec_ctx_t &ctx) const;
+    void prepare_padded_bias(const diff_src_data_t *&bias,
+            const memory_tracking::grantor_t &scratchpad) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     jit_aarch64_sve_512_conv_bwd_data_kernel_f32 *kernel_;
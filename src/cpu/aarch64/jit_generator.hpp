@@ -19,13 +19,16 @@
 
 #define XBYAK_CODE_PTR uint32
 
+#include <cstring>
 #include <limits.h>
+#include <string>
 
 #include "common/bit_cast.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/jit_persistent_cache.hpp"
 
 #if defined(_WIN32) && !defined(__GNUC__)
 #define STRUCT_ALIGN(al, ...) __declspec(align(al)) __VA_ARGS__
@@ -1150,6 +1153,15 @@ public:
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(jit_generator);
 
+    // The code is final once it is requested. Callers may request it more
+    // than once, so its size is accounted only the first time.
+    bool code_size_accounted_ = false;
+    void account_code_size() {
+        if (code_size_accounted_) return;
+        add_jit_code_size(getSize() * sizeof(uint32_t));
+        code_size_accounted_ = true;
+    }
+
 public:
     jit_generator(void *code_ptr = nullptr, size_t code_size = MAX_CODE_SIZE,
             bool use_autogrow = true)
@@ -1166,6 +1178,7 @@ public:
     const uint32_t *getCode32() {
         this->ready();
         const uint32_t *code = CGA64::getCode32();
+        account_code_size();
 
         if (get_jit_dump()) dump_code32(code);
 
@@ -1175,6 +1188,7 @@ public:
     // XXX: use normal_case name and update all callees (?)
     const Xbyak::uint8 *getCode() {
         const Xbyak::uint8 *code = CodeGenerator::getCode();
+        account_code_size();
 
         if (get_jit_dump()) dump_code(code);
 
@@ -1185,6 +1199,44 @@ public:
     const F getCode() {
         return (const F)getCode32();
     }
+
+    // Persistent JIT cache support. A kernel whose code does not depend on
+    // absolute addresses calls load_cached_code() instead of generating the
+    // code and store_cached_code() once the code is ready. The key must
+    // describe all the parameters the generated code depends on, the kernel
+    // name, the ISA mask and the SVE vector length are taken into account by
+    // the cache.
+    bool load_cached_code(const std::string &key) {
+        if (!jit_persistent_cache::enabled()) return false;
+
+        size_t size = 0;
+        const uint8_t *code = jit_persistent_cache::find(
+                cached_code_key(key), get_max_cpu_isa_mask(), &size);
+        if (code == nullptr || size % sizeof(uint32_t) != 0) return false;
+
+        for (size_t i = 0; i < size; i += sizeof(uint32_t)) {
+            uint32_t insn;
+            std::memcpy(&insn, code + i, sizeof(insn));
+            CGA64::dw(insn);
+        }
+        code_is_cached_ = true;
+        return true;
+    }
+
+    void store_cached_code(const std::string &key, const uint32_t *code) {
+        if (!jit_persistent_cache::enabled() || code_is_cached_) return;
+        jit_persistent_cache::store(cached_code_key(key),
+                get_max_cpu_isa_mask(), reinterpret_cast<const uint8_t *>(code),
+                getSize() * sizeof(uint32_t));
+    }
+
+private:
+    bool code_is_cached_ = false;
+
+    std::string cached_code_key(const std::string &key) const {
+        return name() + std::string(":vl") + std::to_string(get_sve_length())
+                + ":" + key;
+    }
 };
 
 } // namespace aarch64
@@ -176,6 +176,9 @@ struct jit_conv_conf_t {
     bool signed_input;
     bool need_saturation;
     float wei_adj_scale;
+    // common zero points, the values are passed at execution time
+    bool src_zero_point;
+    bool dst_zero_point;
 
     bool uses_permw_transposition;
     bool transpose_src;
@@ -377,6 +380,8 @@ struct jit_conv_call_s {
     const void *scales;
     const void *acc_s32;
     const void *compensation;
+    const int32_t *src_zero_point;
+    const int32_t *dst_zero_point;
     const void *tile_cfg;
     const void *tile_cfg_tail;
     size_t kd_offset;
@@ -518,6 +523,11 @@ struct jit_1x1_conv_conf_t {
     data_type_t dst_dt;
     bool signed_input;
     float wei_adj_scale;
+    // common zero points, the values are passed at execution time
+    bool src_zero_point;
+    bool dst_zero_point;
+    int ic_tail, oc_tail;
+    bool is_nspc; // activations in nwc, nhwc, or ndhwc layout
 
     cpu_isa_t isa;
     bool uses_permw_transposition;
@@ -531,6 +541,8 @@ struct jit_1x1_conv_call_s {
     const void *acc_s32;
     const void *scales;
     const void *compensation;
+    const int32_t *src_zero_point;
+    const int32_t *dst_zero_point;
     const void *store_buffer;
 
     size_t load_dim;
@@ -598,6 +610,53 @@ struct jit_pool_call_s {
     size_t b_c; // contains number of channel blocks already processed
 };
 
+/* inner product */
+struct jit_ip_conf_t {
+    prop_kind_t prop_kind;
+
+    int ndims;
+    int mb, oc, ic, ic_total; // ic_total = ic (padded) * kd * kh * kw
+    int simd_w;
+    format_tag_t src_tag, wei_tag;
+    // weights are [OC / simd_w][ic_total][simd_w] (e.g. OIhw16i16o, Ohwi16o),
+    // otherwise they are [ic_total][OC] (io, hwio)
+    bool wei_panel;
+
+    bool with_bias;
+    bool with_sum;
+    bool with_eltwise;
+    float sum_scale;
+    post_ops_t::entry_t::eltwise_t eltwise;
+
+    /* Kernel: C[M][N] (+)= A[M][K] * B[K][N], N is split into simd_w-wide
+     * blocks. Strides are in elements. Rows of A are contiguous in K. B is
+     * either a set of panels (b_k_stride == simd_w) or a row-major matrix
+     * (b_nb_stride == simd_w). */
+    int lda;
+    int b_k_stride, b_nb_stride;
+    int c_m_stride, c_nb_stride;
+    int nb; // number of N blocks handled by a kernel call
+    int n_tail; // valid elements in the last N block, 0 when it is full
+    bool mask_b, mask_c; // the N tail is not padded in B / C
+    int ur_m;
+
+    /* Driver */
+    int M, N, K;
+    int nb_blocking; // N blocks per kernel call for the full kernel
+    int m_block, k_block;
+    int nthr;
+};
+
+struct jit_ip_call_s {
+    const float *a;
+    const float *b;
+    float *c;
+    const float *bias;
+    size_t m;
+    size_t k;
+    size_t flags;
+};
+
 } // namespace aarch64
 } // namespace cpu
 } // namespace impl
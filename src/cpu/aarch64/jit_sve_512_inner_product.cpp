@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_512_inner_product.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+jit_sve_512_ip_driver_t::jit_sve_512_ip_driver_t(const jit_ip_conf_t &jcp)
+    : jcp_(jcp), kernel_(nullptr), kernel_tail_(nullptr) {
+    const int nb_n = div_up(jcp_.N, jcp_.simd_w);
+    if (nb_n > jcp_.nb_blocking)
+        kernel_ = new jit_sve_512_inner_product_kernel(jcp_);
+    kernel_tail_ = new jit_sve_512_inner_product_kernel(
+            jit_sve_512_inner_product_kernel::tail_conf(jcp_));
+}
+
+jit_sve_512_ip_driver_t::~jit_sve_512_ip_driver_t() {
+    delete kernel_;
+    delete kernel_tail_;
+}
+
+void jit_sve_512_ip_driver_t::operator()(
+        const float *a, const float *b, float *c, const float *bias) const {
+    const auto &jcp = jcp_;
+    const int simd_w = jcp.simd_w;
+    const int n_groups = div_up(div_up(jcp.N, simd_w), jcp.nb_blocking);
+    const int m_chunks = div_up(jcp.M, jcp.m_block);
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        size_t start {0}, end {0};
+        balance211((size_t)n_groups * m_chunks, nthr, ithr, start, end);
+
+        // Row chunks are the inner dimension, so consecutive tiles of a
+        // thread reuse the same B columns.
+        int ng {0}, mc {0};
+        nd_iterator_init(start, ng, n_groups, mc, m_chunks);
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const auto *kernel = ng == n_groups - 1 ? kernel_tail_ : kernel_;
+            const dim_t m = (dim_t)mc * jcp.m_block;
+            const dim_t nb = (dim_t)ng * jcp.nb_blocking;
+
+            jit_ip_call_s p;
+            p.m = nstl::min((dim_t)jcp.m_block, jcp.M - m);
+            p.bias = bias ? bias + nb * simd_w : nullptr;
+            p.c = c + m * jcp.c_m_stride + nb * jcp.c_nb_stride;
+            for (int k = 0; k < jcp.K; k += jcp.k_block) {
+                p.a = a + m * jcp.lda + k;
+                p.b = b + nb * jcp.b_nb_stride + (dim_t)k * jcp.b_k_stride;
+                p.k = nstl::min(jcp.k_block, jcp.K - k);
+                p.flags = (k == 0 ? FLAG_REDUCE_FIRST : 0)
+                        | (k + jcp.k_block >= jcp.K ? FLAG_REDUCE_LAST : 0);
+                (*kernel)(&p);
+            }
+            nd_iterator_step(ng, n_groups, mc, m_chunks);
+        }
+    });
+}
+
+void jit_sve_512_inner_product_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    driver_(src, weights, dst, bias);
+}
+
+void jit_sve_512_inner_product_bwd_data_t::execute_backward_data(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto diff_src = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+
+    const auto &jcp = pd()->jcp_;
+    const int simd_w = jcp.simd_w;
+    const int OC = jcp.oc;
+    const int IC = jcp.ic_total;
+
+    // Transpose the weights to [IC / simd_w][OC][simd_w] panels, the IC tail
+    // is padded with zeros.
+    auto wei_tr = ctx.get_scratchpad_grantor().get<float>(key_iprod_wei_tr);
+    parallel_nd(div_up(IC, simd_w), OC, [&](int icb, int oc) {
+        float *w_tr = &wei_tr[((size_t)icb * OC + oc) * simd_w];
+        for (int i = 0; i < simd_w; i++) {
+            const int ic = icb * simd_w + i;
+            if (ic >= IC)
+                w_tr[i] = 0.f;
+            else if (jcp.wei_panel)
+                w_tr[i] = weights[((size_t)(oc / simd_w) * IC + ic) * simd_w
+                        + oc % simd_w];
+            else
+                w_tr[i] = weights[(size_t)ic * OC + oc];
+        }
+    });
+
+    driver_(diff_dst, wei_tr, diff_src, nullptr);
+}
+
+void jit_sve_512_inner_product_bwd_weights_t::execute_backward_weights(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto diff_weights = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+    auto diff_bias = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_BIAS);
+
+    const auto &jcp = pd()->jcp_;
+    const int simd_w = jcp.simd_w;
+    const int MB = jcp.mb;
+    const int OC = jcp.oc;
+    const int IC = jcp.ic_total;
+
+    // Transpose the source to [IC][MB], so that the rows of A are contiguous
+    // in the reduction dimension.
+    auto src_tr = ctx.get_scratchpad_grantor().get<float>(key_iprod_src_tr);
+    parallel_nd(div_up(IC, simd_w), [&](int icb) {
+        const int ic_s = icb * simd_w;
+        const int ic_e = nstl::min(ic_s + simd_w, IC);
+        for (int mb = 0; mb < MB; mb++)
+            for (int ic = ic_s; ic < ic_e; ic++)
+                src_tr[(size_t)ic * MB + mb] = src[(size_t)mb * IC + ic];
+    });
+
+    driver_(src_tr, diff_dst, diff_weights, nullptr);
+
+    if (jcp.with_bias) {
+        parallel_nd(div_up(OC, simd_w), [&](int ocb) {
+            const int oc_s = ocb * simd_w;
+            const int len = nstl::min(simd_w, OC - oc_s);
+            float *db = &diff_bias[oc_s];
+            for (int i = 0; i < len; i++)
+                db[i] = 0.f;
+            for (int mb = 0; mb < MB; mb++) {
+                const float *d = &diff_dst[(size_t)mb * OC + oc_s];
+                PRAGMA_OMP_SIMD()
+                for (int i = 0; i < len; i++)
+                    db[i] += d[i];
+            }
+        });
+    }
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
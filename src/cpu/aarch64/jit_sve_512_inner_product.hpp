@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_512_INNER_PRODUCT_HPP
+#define CPU_AARCH64_JIT_SVE_512_INNER_PRODUCT_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_inner_product_pd.hpp"
+
+#include "cpu/aarch64/jit_sve_512_inner_product_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Splits C into tiles of jcp.m_block rows and jcp.nb_blocking column blocks
+// and runs the kernels on them in parallel. The last column group is handled
+// by a separate kernel with the N tail.
+struct jit_sve_512_ip_driver_t {
+    jit_sve_512_ip_driver_t(const jit_ip_conf_t &jcp);
+    ~jit_sve_512_ip_driver_t();
+
+    void operator()(const float *a, const float *b, float *c,
+            const float *bias) const;
+
+private:
+    jit_ip_conf_t jcp_;
+    jit_sve_512_inner_product_kernel *kernel_;
+    jit_sve_512_inner_product_kernel *kernel_tail_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(jit_sve_512_ip_driver_t);
+};
+
+struct jit_sve_512_inner_product_fwd_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_fwd_pd_t {
+        using cpu_inner_product_fwd_pd_t::cpu_inner_product_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", sve, ""),
+                jit_sve_512_inner_product_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            bool ok = true && is_fwd() && !has_zero_dim_memory()
+                    && utils::everyone_is(f32, src_md()->data_type,
+                            weights_md()->data_type, dst_md()->data_type,
+                            with_bias() ? weights_md(1)->data_type : f32)
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops);
+            if (!ok) return status::unimplemented;
+
+            CHECK(jit_sve_512_inner_product_kernel::init_conf(jcp_, *desc(),
+                    src_md_, weights_md_, dst_md_,
+                    with_bias() ? &bias_md_ : nullptr, *attr(),
+                    dnnl_get_max_threads()));
+
+            auto scratchpad = scratchpad_registry().registrar();
+            jit_sve_512_inner_product_kernel::init_scratchpad(scratchpad, jcp_);
+
+            return status::success;
+        }
+
+        jit_ip_conf_t jcp_;
+    };
+
+    jit_sve_512_inner_product_fwd_t(const pd_t *apd)
+        : primitive_t(apd), driver_(pd()->jcp_) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    jit_sve_512_ip_driver_t driver_;
+};
+
+struct jit_sve_512_inner_product_bwd_data_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_bwd_data_pd_t {
+        using cpu_inner_product_bwd_data_pd_t::cpu_inner_product_bwd_data_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", sve, ""),
+                jit_sve_512_inner_product_bwd_data_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            bool ok = true && desc()->prop_kind == prop_kind::backward_data
+                    && !has_zero_dim_memory()
+                    && utils::everyone_is(f32, diff_src_md()->data_type,
+                            weights_md()->data_type, diff_dst_md()->data_type)
+                    && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            CHECK(jit_sve_512_inner_product_kernel::init_conf(jcp_, *desc(),
+                    diff_src_md_, weights_md_, diff_dst_md_, nullptr, *attr(),
+                    dnnl_get_max_threads()));
+
+            auto scratchpad = scratchpad_registry().registrar();
+            jit_sve_512_inner_product_kernel::init_scratchpad(scratchpad, jcp_);
+
+            return status::success;
+        }
+
+        jit_ip_conf_t jcp_;
+    };
+
+    jit_sve_512_inner_product_bwd_data_t(const pd_t *apd)
+        : primitive_t(apd), driver_(pd()->jcp_) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward_data(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_backward_data(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    jit_sve_512_ip_driver_t driver_;
+};
+
+struct jit_sve_512_inner_product_bwd_weights_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_bwd_weights_pd_t {
+        using cpu_inner_product_bwd_weights_pd_t::
+                cpu_inner_product_bwd_weights_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", sve, ""),
+                jit_sve_512_inner_product_bwd_weights_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            bool ok = true && desc()->prop_kind == prop_kind::backward_weights
+                    && !has_zero_dim_memory()
+                    && utils::everyone_is(f32, src_md()->data_type,
+                            diff_weights_md()->data_type,
+                            diff_dst_md()->data_type,
+                            with_bias() ? diff_weights_md(1)->data_type : f32)
+                    && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            CHECK(jit_sve_512_inner_product_kernel::init_conf(jcp_, *desc(),
+                    src_md_, diff_weights_md_, diff_dst_md_,
+                    with_bias() ? &diff_bias_md_ : nullptr, *attr(),
+                    dnnl_get_max_threads()));
+
+            auto scratchpad = scratchpad_registry().registrar();
+            jit_sve_512_inner_product_kernel::init_scratchpad(scratchpad, jcp_);
+
+            return status::success;
+        }
+
+        jit_ip_conf_t jcp_;
+    };
+
+    jit_sve_512_inner_product_bwd_weights_t(const pd_t *apd)
+        : primitive_t(apd), driver_(pd()->jcp_) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward_weights(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_backward_weights(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    jit_sve_512_ip_driver_t driver_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,467 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_512_inner_product_kernel.hpp"
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(jit_ip_call_s, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::prop_kind;
+using namespace dnnl::impl::utils;
+
+namespace {
+// Range of the signed immediate of the predicated SVE loads and stores, in
+// vector lengths.
+bool mul_vl_imm_check(dim_t ofs, int vlen) {
+    return ofs % vlen == 0 && ofs / vlen >= -8 && ofs / vlen <= 7;
+}
+} // namespace
+
+void jit_sve_512_inner_product_kernel::load_c(
+        const xa::ZRegS &z, int i, int j) {
+    const dim_t ofs = ((dim_t)i * jcp.c_m_stride + (dim_t)j * jcp.c_nb_stride)
+            * typesize;
+    const xa::PReg p = jcp.mask_c && is_tail_block(j) ? reg_p_tail
+                                                       : reg_p_all_ones;
+    const int vlen = jcp.simd_w * typesize;
+    if (mul_vl_imm_check(ofs, vlen)) {
+        CGA64::ld1w(z, p / xa::T_z,
+                xa::ptr(reg_c, static_cast<int32_t>(ofs / vlen), xa::MUL_VL));
+    } else {
+        CGA64::add_imm(reg_tmp, reg_c, ofs, reg_tmp_imm);
+        CGA64::ld1w(z, p / xa::T_z, xa::ptr(reg_tmp));
+    }
+}
+
+void jit_sve_512_inner_product_kernel::store_c(
+        const xa::ZRegS &z, int i, int j) {
+    const dim_t ofs = ((dim_t)i * jcp.c_m_stride + (dim_t)j * jcp.c_nb_stride)
+            * typesize;
+    const xa::PReg p = jcp.mask_c && is_tail_block(j) ? reg_p_tail
+                                                       : reg_p_all_ones;
+    const int vlen = jcp.simd_w * typesize;
+    if (mul_vl_imm_check(ofs, vlen)) {
+        CGA64::st1w(z, p,
+                xa::ptr(reg_c, static_cast<int32_t>(ofs / vlen), xa::MUL_VL));
+    } else {
+        CGA64::add_imm(reg_tmp, reg_c, ofs, reg_tmp_imm);
+        CGA64::st1w(z, p, xa::ptr(reg_tmp));
+    }
+}
+
+void jit_sve_512_inner_product_kernel::init_tile(int ur) {
+    xa::LabelAArch64 init_from_c, init_done;
+
+    CGA64::tst(reg_flags, FLAG_REDUCE_FIRST);
+    CGA64::b(xa::EQ, init_from_c);
+
+    if (jcp.with_bias
+            && one_of(jcp.prop_kind, forward_training, forward_inference)) {
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(bias)));
+        for (int j = 0; j < jcp.nb; j++) {
+            const xa::PReg p = is_tail_block(j) ? reg_p_tail : reg_p_all_ones;
+            CGA64::ld1w(zreg_acc_s(0, j), p / xa::T_z,
+                    xa::ptr(reg_tmp, static_cast<int32_t>(j), xa::MUL_VL));
+        }
+        for (int i = 1; i < ur; i++)
+            for (int j = 0; j < jcp.nb; j++)
+                CGA64::mov(xa::ZRegD(zreg_acc_s(i, j).getIdx()),
+                        xa::ZRegD(zreg_acc_s(0, j).getIdx()));
+    } else {
+        for (int i = 0; i < ur; i++)
+            for (int j = 0; j < jcp.nb; j++)
+                CGA64::fmov(zreg_acc_s(i, j));
+    }
+
+    if (jcp.with_sum) {
+        // The B registers are free before the k-loop and hold the values of
+        // C to accumulate.
+        CGA64::mov_imm(reg_tmp, float2int(jcp.sum_scale));
+        CGA64::dup(zreg_sum_scale_s(), xa::WReg(reg_tmp.getIdx()));
+        for (int i = 0; i < ur; i++)
+            for (int j = 0; j < jcp.nb; j++) {
+                load_c(zreg_b_s(j), i, j);
+                CGA64::fmla(zreg_acc_s(i, j), reg_p_all_ones, zreg_b_s(j),
+                        zreg_sum_scale_s());
+            }
+    }
+    CGA64::b(init_done);
+
+    CGA64::L_aarch64(init_from_c);
+    for (int i = 0; i < ur; i++)
+        for (int j = 0; j < jcp.nb; j++)
+            load_c(zreg_acc_s(i, j), i, j);
+
+    CGA64::L_aarch64(init_done);
+}
+
+void jit_sve_512_inner_product_kernel::fma_step(int ur, int uk) {
+    for (int j = 0; j < jcp.nb; j++) {
+        const xa::PReg p = jcp.mask_b && is_tail_block(j) ? reg_p_tail
+                                                           : reg_p_all_ones;
+        if (is_b_panel())
+            CGA64::ld1w(zreg_b_s(j), p / xa::T_z,
+                    xa::ptr(reg_b_col[j], static_cast<int32_t>(uk),
+                            xa::MUL_VL));
+        else
+            CGA64::ld1w(zreg_b_s(j), p / xa::T_z,
+                    xa::ptr(reg_b_col[0], static_cast<int32_t>(j),
+                            xa::MUL_VL));
+    }
+    if (!is_b_panel())
+        CGA64::add_imm(reg_b_col[0], reg_b_col[0], jcp.b_k_stride * typesize,
+                reg_tmp_imm);
+
+    for (int i = 0; i < ur; i++) {
+        CGA64::ld1rw(zreg_a_s(i), reg_p_all_ones,
+                xa::ptr(reg_a_row[i], static_cast<int32_t>(uk * typesize)));
+        for (int j = 0; j < jcp.nb; j++)
+            CGA64::fmla(zreg_acc_s(i, j), reg_p_all_ones, zreg_b_s(j),
+                    zreg_a_s(i));
+    }
+}
+
+void jit_sve_512_inner_product_kernel::k_loop(int ur) {
+    auto advance = [=](int nk) {
+        for (int i = 0; i < ur; i++)
+            CGA64::add_imm(reg_a_row[i], reg_a_row[i], nk * typesize,
+                    reg_tmp_imm);
+        if (is_b_panel())
+            for (int j = 0; j < jcp.nb; j++)
+                CGA64::add_imm(reg_b_col[j], reg_b_col[j],
+                        nk * jcp.b_k_stride * typesize, reg_tmp_imm);
+        CGA64::sub_imm(reg_kk, reg_kk, nk, reg_tmp_imm);
+    };
+
+    xa::LabelAArch64 k_loop_main, k_loop_tail, k_loop_end;
+
+    CGA64::ldr(reg_kk, xa::ptr(reg_param, GET_OFF(k)));
+    CGA64::cmp_imm(reg_kk, unroll_k, reg_tmp_imm);
+    CGA64::b(xa::LT, k_loop_tail);
+
+    CGA64::L_aarch64(k_loop_main);
+    {
+        for (int uk = 0; uk < unroll_k; uk++)
+            fma_step(ur, uk);
+        advance(unroll_k);
+        CGA64::cmp_imm(reg_kk, unroll_k, reg_tmp_imm);
+        CGA64::b(xa::GE, k_loop_main);
+    }
+
+    CGA64::L_aarch64(k_loop_tail);
+    {
+        CGA64::cmp(reg_kk, 0);
+        CGA64::b(xa::LE, k_loop_end);
+        fma_step(ur, 0);
+        advance(1);
+        CGA64::b(k_loop_tail);
+    }
+
+    CGA64::L_aarch64(k_loop_end);
+}
+
+void jit_sve_512_inner_product_kernel::store_tile(int ur) {
+    if (jcp.with_eltwise) {
+        xa::LabelAArch64 store_noeltwise;
+        CGA64::tst(reg_flags, FLAG_REDUCE_LAST);
+        CGA64::b(xa::EQ, store_noeltwise);
+        eltwise_injector_->compute_vector_range(0, ur * jcp.nb);
+        CGA64::L_aarch64(store_noeltwise);
+    }
+
+    for (int i = 0; i < ur; i++)
+        for (int j = 0; j < jcp.nb; j++)
+            store_c(zreg_acc_s(i, j), i, j);
+}
+
+void jit_sve_512_inner_product_kernel::compute_tile(int ur) {
+    CGA64::mov(reg_a_row[0], reg_a);
+    for (int i = 1; i < ur; i++)
+        CGA64::add_imm(reg_a_row[i], reg_a_row[i - 1], jcp.lda * typesize,
+                reg_tmp_imm);
+
+    CGA64::mov(reg_b_col[0], reg_b);
+    if (is_b_panel())
+        for (int j = 1; j < jcp.nb; j++)
+            CGA64::add_imm(reg_b_col[j], reg_b_col[j - 1],
+                    jcp.b_nb_stride * typesize, reg_tmp_imm);
+
+    init_tile(ur);
+    k_loop(ur);
+    store_tile(ur);
+}
+
+void jit_sve_512_inner_product_kernel::generate() {
+    assert(jcp.nb <= max_nb && jcp.ur_m <= max_ur_m
+            && jcp.ur_m * jcp.nb <= 24);
+    assert(IMPLICATION(is_b_panel(), jcp.b_k_stride == jcp.simd_w));
+
+    preamble();
+
+    CGA64::ptrue(reg_p_all_ones.b);
+    if (jcp.n_tail) {
+        CGA64::mov_imm(reg_tmp, jcp.n_tail);
+        CGA64::mov_imm(reg_tmp_imm, 0);
+        CGA64::whilelt(reg_p_tail.s, reg_tmp_imm, reg_tmp);
+    }
+
+    CGA64::mov(reg_param, abi_param1_aarch64);
+    CGA64::ldr(reg_a, xa::ptr(reg_param, GET_OFF(a)));
+    CGA64::ldr(reg_b, xa::ptr(reg_param, GET_OFF(b)));
+    CGA64::ldr(reg_c, xa::ptr(reg_param, GET_OFF(c)));
+    CGA64::ldr(reg_m, xa::ptr(reg_param, GET_OFF(m)));
+    CGA64::ldr(reg_flags, xa::ptr(reg_param, GET_OFF(flags)));
+
+    xa::LabelAArch64 m_loop, m_loop_tail, m_loop_end;
+
+    CGA64::cmp_imm(reg_m, jcp.ur_m, reg_tmp_imm);
+    CGA64::b(xa::LT, m_loop_tail);
+
+    CGA64::L_aarch64(m_loop);
+    {
+        compute_tile(jcp.ur_m);
+        CGA64::add_imm(reg_a, reg_a, jcp.ur_m * jcp.lda * typesize,
+                reg_tmp_imm);
+        CGA64::add_imm(reg_c, reg_c, jcp.ur_m * jcp.c_m_stride * typesize,
+                reg_tmp_imm);
+        CGA64::sub_imm(reg_m, reg_m, jcp.ur_m, reg_tmp_imm);
+        CGA64::cmp_imm(reg_m, jcp.ur_m, reg_tmp_imm);
+        CGA64::b(xa::GE, m_loop);
+    }
+
+    // At most ur_m - 1 rows are left, each remainder has its own tile.
+    CGA64::L_aarch64(m_loop_tail);
+    for (int ur = jcp.ur_m - 1; ur > 0; ur--) {
+        xa::LabelAArch64 next_ur;
+        CGA64::cmp_imm(reg_m, ur, reg_tmp_imm);
+        CGA64::b(xa::NE, next_ur);
+        compute_tile(ur);
+        CGA64::b(m_loop_end);
+        CGA64::L_aarch64(next_ur);
+    }
+
+    CGA64::L_aarch64(m_loop_end);
+    postamble();
+
+    if (jcp.with_eltwise) {
+        eltwise_injector_->prepare_table();
+        binCommit();
+    }
+}
+
+status_t jit_sve_512_inner_product_kernel::init_conf(jit_ip_conf_t &jcp,
+        const inner_product_desc_t &ipd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t *bias_md, const primitive_attr_t &attr, int nthreads) {
+    if (!mayiuse_sve_any_vl()) return status::unimplemented;
+
+    jcp = zero<decltype(jcp)>();
+    jcp.prop_kind = ipd.prop_kind;
+    jcp.ndims = src_md.ndims;
+    jcp.simd_w = get_sve_length() / sizeof(float);
+    jcp.nthr = nthreads;
+
+    const int ndims = jcp.ndims;
+    if (ndims < 2 || ndims > 5) return status::unimplemented;
+
+    /* Layouts: the weights either follow the source in K-order with OC
+     * blocked by 16, or are OC-contiguous (2D only). The blocked layouts
+     * require a 512-bit vector length. */
+    struct layout_t {
+        format_tag_t src, wei;
+    };
+    const layout_t layouts[] = {
+            {pick(ndims - 2, ab, abc, abcd, abcde),
+                    pick(ndims - 2, ba, Oiw16o, Oihw16o, Oidhw16o)},
+            {pick(ndims - 2, undef, nwc, nhwc, ndhwc),
+                    pick(ndims - 2, undef, Owi16o, Ohwi16o, Odhwi16o)},
+            {pick(ndims - 2, undef, nCw16c, nChw16c, nCdhw16c),
+                    pick(ndims - 2, undef, OIw16i16o, OIhw16i16o,
+                            OIdhw16i16o)},
+    };
+
+    const memory_desc_wrapper src_d(src_md), weights_d(weights_md);
+    const bool src_any = src_md.format_kind == format_kind::any;
+    const bool wei_any = weights_md.format_kind == format_kind::any;
+    jcp.src_tag = jcp.wei_tag = format_tag::undef;
+    for (const auto &l : layouts) {
+        if (l.src == format_tag::undef) continue;
+        if (l.wei != ba && jcp.simd_w != 16) continue;
+        if ((src_any || src_d.matches_tag(l.src))
+                && (wei_any || weights_d.matches_tag(l.wei))) {
+            jcp.src_tag = l.src;
+            jcp.wei_tag = l.wei;
+            break;
+        }
+    }
+    if (jcp.src_tag == format_tag::undef) return status::unimplemented;
+
+    if (src_any) CHECK(memory_desc_init_by_tag(src_md, jcp.src_tag));
+    if (wei_any) CHECK(memory_desc_init_by_tag(weights_md, jcp.wei_tag));
+    if (dst_md.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md, nc));
+    if (!memory_desc_wrapper(dst_md).matches_tag(nc))
+        return status::unimplemented;
+
+    const bool is_fwd = one_of(jcp.prop_kind, forward_training,
+            forward_inference);
+    jcp.with_bias = bias_md != nullptr && bias_md->ndims != 0;
+    if (jcp.with_bias) {
+        if (bias_md->format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(*bias_md, x));
+        if (!memory_desc_wrapper(*bias_md).matches_tag(x))
+            return status::unimplemented;
+    }
+
+    const memory_desc_wrapper src_init_d(src_md);
+    jcp.mb = src_md.dims[0];
+    jcp.oc = dst_md.dims[1];
+    jcp.ic = src_md.dims[1];
+    jcp.ic_total = (int)array_product(
+            src_init_d.padded_dims() + 1, ndims - 1);
+    jcp.wei_panel = jcp.wei_tag != ba;
+
+    /* Post-ops: sum, eltwise or sum -> eltwise, forward only */
+    const auto &p = attr.post_ops_;
+    const int sum_ind = p.find(primitive_kind::sum);
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    bool post_ops_ok = false;
+    switch (p.len()) {
+        case 0: post_ops_ok = true; break;
+        case 1: post_ops_ok = sum_ind == 0 || eltwise_ind == 0; break;
+        case 2: post_ops_ok = sum_ind == 0 && eltwise_ind == 1; break;
+        default: break;
+    }
+    if (!post_ops_ok || !IMPLICATION(p.len() != 0, is_fwd))
+        return status::unimplemented;
+    jcp.with_sum = sum_ind != -1;
+    jcp.sum_scale = jcp.with_sum ? p.entry_[sum_ind].sum.scale : 0.f;
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) {
+        jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+        if (jcp.eltwise.alg == alg_kind::eltwise_pow)
+            return status::unimplemented;
+        // The kernel follows the vector length, the eltwise injector only
+        // for its native algorithms.
+        if (get_sve_length() != cpu_isa_traits<sve>::vlen
+                && !jit_uni_eltwise_injector_f32<
+                        avx512_common>::is_vl_agnostic(jcp.eltwise.alg))
+            return status::unimplemented;
+    }
+
+    const int simd_w = jcp.simd_w;
+    switch (jcp.prop_kind) {
+        case forward_training:
+        case forward_inference:
+            // dst[mb][oc] = src[mb][k] * wei[k][oc]
+            jcp.M = jcp.mb;
+            jcp.N = jcp.oc;
+            jcp.K = jcp.ic_total;
+            jcp.lda = jcp.ic_total;
+            jcp.b_k_stride = jcp.wei_panel ? simd_w : jcp.oc;
+            jcp.b_nb_stride = jcp.wei_panel ? jcp.ic_total * simd_w : simd_w;
+            jcp.c_m_stride = jcp.oc;
+            jcp.c_nb_stride = simd_w;
+            jcp.mask_b = !jcp.wei_panel;
+            jcp.mask_c = true;
+            break;
+        case backward_data:
+            // diff_src[mb][k] = diff_dst[mb][oc] * wei[oc][k], the weights
+            // are transposed to [k / simd_w][oc][simd_w] panels
+            jcp.M = jcp.mb;
+            jcp.N = jcp.ic_total;
+            jcp.K = jcp.oc;
+            jcp.lda = jcp.oc;
+            jcp.b_k_stride = simd_w;
+            jcp.b_nb_stride = jcp.oc * simd_w;
+            jcp.c_m_stride = jcp.ic_total;
+            jcp.c_nb_stride = simd_w;
+            jcp.mask_b = false;
+            jcp.mask_c = true;
+            break;
+        case backward_weights:
+            // diff_wei[k][oc] = src[k][mb] * diff_dst[mb][oc], the source is
+            // transposed to [k][mb]. Panel weights are stored with the OC
+            // padding, which is zero as the diff_dst tail is masked.
+            jcp.M = jcp.ic_total;
+            jcp.N = jcp.oc;
+            jcp.K = jcp.mb;
+            jcp.lda = jcp.mb;
+            jcp.b_k_stride = jcp.oc;
+            jcp.b_nb_stride = simd_w;
+            jcp.c_m_stride = jcp.wei_panel ? simd_w : jcp.oc;
+            jcp.c_nb_stride = jcp.wei_panel ? jcp.ic_total * simd_w : simd_w;
+            jcp.mask_b = true;
+            jcp.mask_c = !jcp.wei_panel;
+            break;
+        default: return status::unimplemented;
+    }
+
+    /* Blocking */
+    const int nb_n = div_up(jcp.N, simd_w);
+    jcp.nb_blocking = nstl::min((int)max_nb, nb_n);
+    jcp.nb = jcp.nb_blocking;
+    jcp.n_tail = 0;
+    jcp.ur_m = max_ur_m;
+
+    // Keep the B block of a call in L2 and split the rows so that every
+    // thread gets work when N is small.
+    jcp.k_block = jcp.K <= 1024 ? jcp.K : 512;
+    const int n_groups = div_up(nb_n, jcp.nb_blocking);
+    const int m_chunks = nstl::max(1, div_up(jcp.nthr, n_groups));
+    jcp.m_block = nstl::min(
+            rnd_up(div_up(jcp.M, m_chunks), jcp.ur_m), rnd_up(96, jcp.ur_m));
+    jcp.m_block = nstl::max(jcp.m_block, jcp.ur_m);
+
+    return status::success;
+}
+
+jit_ip_conf_t jit_sve_512_inner_product_kernel::tail_conf(
+        const jit_ip_conf_t &jcp) {
+    const int nb_n = div_up(jcp.N, jcp.simd_w);
+    jit_ip_conf_t tail_jcp = jcp;
+    tail_jcp.nb = nb_n - (div_up(nb_n, jcp.nb_blocking) - 1) * jcp.nb_blocking;
+    tail_jcp.n_tail = jcp.N % jcp.simd_w;
+    return tail_jcp;
+}
+
+void jit_sve_512_inner_product_kernel::init_scratchpad(
+        memory_tracking::registrar_t &scratchpad, const jit_ip_conf_t &jcp) {
+    using namespace dnnl::impl::memory_tracking::names;
+
+    if (jcp.prop_kind == backward_data)
+        scratchpad.book(key_iprod_wei_tr,
+                (size_t)rnd_up(jcp.N, jcp.simd_w) * jcp.K, sizeof(float));
+    else if (jcp.prop_kind == backward_weights)
+        scratchpad.book(
+                key_iprod_src_tr, (size_t)jcp.M * jcp.K, sizeof(float));
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
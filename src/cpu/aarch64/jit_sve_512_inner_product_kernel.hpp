@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_512_INNER_PRODUCT_KERNEL_HPP
+#define CPU_AARCH64_JIT_SVE_512_INNER_PRODUCT_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+#include "cpu/aarch64/jit_uni_eltwise_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Computes a row block of C[M][N] (+)= A[M][K] * B[K][N] for jcp.nb column
+// blocks of simd_w elements. All three inner-product directions are mapped on
+// this kernel by the driver, see jit_ip_conf_t for the addressing.
+//
+// FLAG_REDUCE_FIRST initializes the accumulators with the bias (and the
+// scaled C for the sum post-op), otherwise they are initialized with C, so
+// the K dimension can be split between calls. FLAG_REDUCE_LAST applies the
+// eltwise post-op before the store.
+struct jit_sve_512_inner_product_kernel : public jit_generator {
+    jit_sve_512_inner_product_kernel(const jit_ip_conf_t &ajcp)
+        : jit_generator(nullptr, 256 * 1024)
+        , jcp(ajcp)
+        , eltwise_injector_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise);
+        generate();
+        jit_ker = (void (*)(jit_ip_call_s *))getCode32();
+    }
+
+    ~jit_sve_512_inner_product_kernel() { delete eltwise_injector_; }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_512_inner_product_kernel)
+
+    static status_t init_conf(jit_ip_conf_t &jcp,
+            const inner_product_desc_t &ipd, memory_desc_t &src_md,
+            memory_desc_t &weights_md, memory_desc_t &dst_md,
+            memory_desc_t *bias_md, const primitive_attr_t &attr,
+            int nthreads);
+
+    // Configuration of the kernel processing the last group of N blocks,
+    // which may be shorter and end with a partial block.
+    static jit_ip_conf_t tail_conf(const jit_ip_conf_t &jcp);
+
+    static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+            const jit_ip_conf_t &jcp);
+
+    void operator()(jit_ip_call_s *p) const { jit_ker(p); }
+
+    jit_ip_conf_t jcp;
+    void (*jit_ker)(jit_ip_call_s *);
+
+private:
+    using reg64_t = const xa::XReg;
+
+    enum {
+        typesize = sizeof(float),
+        max_ur_m = 6,
+        max_nb = 4,
+        unroll_k = 4,
+        n_a_regs = 4,
+    };
+
+    const xa::PReg reg_p_all_ones = p2;
+    const xa::PReg reg_p_tail = p3;
+
+    /* x0 (p_table of the eltwise injector) and x4 (stack of the translated
+     * code) are not used, the call parameters are kept in reg_param. */
+    reg64_t reg_a = x1;
+    reg64_t reg_b = x2;
+    reg64_t reg_c = x3;
+    reg64_t reg_m = x5;
+    reg64_t reg_param = x7;
+    reg64_t reg_flags = x6;
+    reg64_t reg_a_row[max_ur_m] = {x8, x9, x10, x11, x12, x13};
+    reg64_t reg_b_col[max_nb] = {x14, x15, x16, x17};
+    reg64_t reg_kk = x18;
+    reg64_t reg_tmp = x19;
+    reg64_t reg_tmp_imm = x20;
+
+    /* Accumulators z0..z23 are numbered row-major, so the eltwise injector
+     * can process a tile as a single range. */
+    xa::ZRegS zreg_acc_s(int i, int j) const {
+        return xa::ZRegS(i * jcp.nb + j);
+    }
+    xa::ZRegS zreg_b_s(int j) const { return xa::ZRegS(24 + j); }
+    xa::ZRegS zreg_a_s(int i) const { return xa::ZRegS(28 + i % n_a_regs); }
+    xa::ZRegS zreg_sum_scale_s() const { return xa::ZRegS(31); }
+
+    bool is_b_panel() const { return jcp.b_nb_stride != jcp.simd_w; }
+    bool is_tail_block(int j) const {
+        return jcp.n_tail != 0 && j == jcp.nb - 1;
+    }
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+
+    void load_c(const xa::ZRegS &z, int i, int j);
+    void store_c(const xa::ZRegS &z, int i, int j);
+    void init_tile(int ur);
+    void fma_step(int ur, int uk);
+    void k_loop(int ur);
+    void store_tile(int ur);
+    void compute_tile(int ur);
+    void generate();
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
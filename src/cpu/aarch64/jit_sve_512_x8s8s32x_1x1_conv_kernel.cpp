@@ -0,0 +1,552 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_1x1_conv_kernel.hpp"
+
+#define GET_OFF(field) \
+    static_cast<int32_t>(offsetof(jit_1x1_conv_call_s, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::utils;
+
+namespace {
+// byte distance between two consecutive points of the activations
+int pix_size(const jit_1x1_conv_conf_t &jcp, int c_without_padding) {
+    return jcp.is_nspc ? jcp.ngroups * c_without_padding : jcp.ic_block;
+}
+} // namespace
+
+void jit_sve_512_x8s8s32x_1x1_conv_kernel::load_src(int i4, int ic_tail) {
+    const xa::ZReg z = zreg_src(i4);
+    const int off = i4 * ic_sub_step;
+    const int n_bytes = ic_tail ? nstl::min(ic_tail - off, 4) : 4;
+
+    if (n_bytes == 4) {
+        CGA64::ld1rw(z.s, reg_p_all_ones, xa::ptr(reg_tmp_addr, off));
+    } else {
+        // The last input channels of a nxc point: a full word would read the
+        // next point or past the end of the tensor.
+        const xa::WReg w_tmp(reg_tmp.getIdx());
+        const xa::WReg w_tmp2(reg_tmp2.getIdx());
+        if (n_bytes == 1)
+            CGA64::ldrb(w_tmp, xa::ptr(reg_tmp_addr, off));
+        else
+            CGA64::ldrh(w_tmp, xa::ptr(reg_tmp_addr, off));
+        if (n_bytes == 3) {
+            CGA64::ldrb(w_tmp2, xa::ptr(reg_tmp_addr, off + 2));
+            CGA64::orr(w_tmp, w_tmp, w_tmp2, xa::LSL, 16);
+        }
+        CGA64::dup(z.s, w_tmp);
+    }
+
+    if (!jcp.signed_input) CGA64::eor(z.d, z.d, zreg_shift().d);
+}
+
+void jit_sve_512_x8s8s32x_1x1_conv_kernel::reduce_step(int ur, bool last_icb) {
+    const int ic_tail = last_icb ? jcp.ic_tail : 0;
+    const int n_i4 = ic_tail ? div_up(ic_tail, ic_sub_step) : ic_sub_step;
+    const int pix_in = pix_size(jcp, jcp.ic_without_padding);
+
+    if (nb_ > 1)
+        CGA64::add_imm(reg_load_ocb, aux_reg_load,
+                jcp.nb_reduce * wei_block_size, reg_tmp_imm);
+    for (int ocb = 0; ocb < nb_; ocb++)
+        for (int i4 = 0; i4 < n_i4; i4++)
+            CGA64::ldr(zreg_wei(ocb, i4),
+                    xa::ptr(ocb == 0 ? aux_reg_load : reg_load_ocb, i4,
+                            xa::MUL_VL));
+
+    for (int jj = 0; jj < ur; jj++) {
+        CGA64::add_imm(
+                reg_tmp_addr, aux_reg_bcast, jj * pix_in, reg_tmp_imm);
+        for (int i4 = 0; i4 < n_i4; i4++)
+            load_src(i4, ic_tail);
+        for (int i4 = 0; i4 < n_i4; i4++)
+            for (int ocb = 0; ocb < nb_; ocb++)
+                CGA64::sdot(zreg_acc(jj, ocb).s, zreg_wei(ocb, i4).b,
+                        zreg_src(i4).b);
+    }
+}
+
+void jit_sve_512_x8s8s32x_1x1_conv_kernel::reduce_loop(int ur) {
+    const int nb_ic_full = jcp.ic_tail ? jcp.nb_reduce - 1 : jcp.nb_reduce;
+    const int bcast_icb_step
+            = jcp.is_nspc ? jcp.ic_block : jcp.is * jcp.ic_block;
+
+    xa::LabelAArch64 reduce_loop_label;
+
+    CGA64::mov(aux_reg_bcast, reg_bcast);
+    CGA64::mov(aux_reg_load, reg_load);
+
+    if (nb_ic_full > 0) {
+        if (nb_ic_full > 1) {
+            CGA64::mov_imm(reg_reduce, nb_ic_full);
+            CGA64::L_aarch64(reduce_loop_label);
+        }
+        reduce_step(ur, false);
+        if (nb_ic_full > 1 || jcp.ic_tail) {
+            CGA64::add_imm(aux_reg_bcast, aux_reg_bcast, bcast_icb_step,
+                    reg_tmp_imm);
+            CGA64::add_imm(
+                    aux_reg_load, aux_reg_load, wei_block_size, reg_tmp_imm);
+        }
+        if (nb_ic_full > 1) {
+            CGA64::subs(reg_reduce, reg_reduce, 1);
+            CGA64::b(xa::NE, reduce_loop_label);
+        }
+    }
+
+    if (jcp.ic_tail) reduce_step(ur, true);
+}
+
+void jit_sve_512_x8s8s32x_1x1_conv_kernel::load_data(
+        const xa::ZReg &z, data_type_t dt, const xa::PReg &p) {
+    switch (dt) {
+        case data_type::f32:
+        case data_type::s32:
+            CGA64::ld1w(z.s, p / xa::T_z, xa::ptr(reg_tmp_addr));
+            break;
+        case data_type::s8:
+            CGA64::ld1sb(z.s, p / xa::T_z, xa::ptr(reg_tmp_addr));
+            break;
+        case data_type::u8:
+            CGA64::ld1b(z.s, p / xa::T_z, xa::ptr(reg_tmp_addr));
+            break;
+        default: assert(!"unsupported data type");
+    }
+    if (dt != data_type::f32)
+        CGA64::scvtf(z.s, reg_p_all_ones / xa::T_m, z.s);
+}
+
+void jit_sve_512_x8s8s32x_1x1_conv_kernel::store_output(int ur) {
+    const int pix_out = pix_size(jcp, jcp.oc_without_padding);
+    const int ocb_step_out = jcp.is_nspc ? jcp.oc_block : jcp.os * 16;
+    auto out_off = [=](int jj, int ocb) {
+        return (jj * pix_out + ocb * ocb_step_out) * jcp.typesize_out;
+    };
+    const xa::WReg w_tmp(reg_tmp2.getIdx());
+
+    if (needs_compensation()) {
+        // comp = -128 * sum(w): without a zero point only the shift of the
+        // source is removed, otherwise sum(w) is scaled by (zp - shift).
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(compensation)));
+        if (jcp.src_zero_point) {
+            CGA64::ldr(reg_tmp2, xa::ptr(reg_param, GET_OFF(src_zero_point)));
+            CGA64::ldr(w_tmp, xa::ptr(reg_tmp2));
+            if (!jcp.signed_input) CGA64::sub(w_tmp, w_tmp, 128);
+            CGA64::dup(zreg_tmp(1).s, w_tmp);
+        }
+        for (int ocb = 0; ocb < nb_; ocb++) {
+            CGA64::ld1w(zreg_tmp(0).s, reg_p_all_ones / xa::T_z,
+                    xa::ptr(reg_tmp, ocb, xa::MUL_VL));
+            if (jcp.src_zero_point) {
+                CGA64::asr(zreg_tmp(0).s, zreg_tmp(0).s, 7);
+                CGA64::mul(zreg_tmp(0).s, reg_p_all_ones / xa::T_m,
+                        zreg_tmp(1).s);
+            }
+            for (int jj = 0; jj < ur; jj++) {
+                if (jcp.src_zero_point)
+                    CGA64::add(zreg_acc(jj, ocb).s, zreg_acc(jj, ocb).s,
+                            zreg_tmp(0).s);
+                else
+                    CGA64::sub(zreg_acc(jj, ocb).s, zreg_acc(jj, ocb).s,
+                            zreg_tmp(0).s);
+            }
+        }
+    }
+
+    for (int jj = 0; jj < ur; jj++)
+        for (int ocb = 0; ocb < nb_; ocb++)
+            CGA64::scvtf(zreg_acc(jj, ocb).s, reg_p_all_ones / xa::T_m,
+                    zreg_acc(jj, ocb).s);
+
+    if (jcp.with_bias) {
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(bias_data)));
+        for (int ocb = 0; ocb < nb_; ocb++) {
+            CGA64::add_imm(reg_tmp_addr, reg_tmp,
+                    ocb * jcp.oc_block * jcp.typesize_bia, reg_tmp_imm);
+            load_data(zreg_tmp(0), jcp.bia_dt, p_oc(ocb));
+            for (int jj = 0; jj < ur; jj++)
+                CGA64::fadd(zreg_acc(jj, ocb).s, zreg_acc(jj, ocb).s,
+                        zreg_tmp(0).s);
+        }
+    }
+
+    CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(scales)));
+    if (!jcp.is_oc_scale)
+        CGA64::ld1rw(zreg_tmp(0).s, reg_p_all_ones, xa::ptr(reg_tmp));
+    for (int ocb = 0; ocb < nb_; ocb++) {
+        if (jcp.is_oc_scale)
+            CGA64::ld1w(zreg_tmp(0).s, p_oc(ocb) / xa::T_z,
+                    xa::ptr(reg_tmp, ocb, xa::MUL_VL));
+        for (int jj = 0; jj < ur; jj++)
+            CGA64::fmul(zreg_acc(jj, ocb).s, zreg_acc(jj, ocb).s,
+                    zreg_tmp(0).s);
+    }
+
+    const auto &p = attr_.post_ops_;
+    for (int i = 0; i < p.len(); i++) {
+        const auto &e = p.entry_[i];
+        if (e.is_eltwise()) {
+            eltwise_injector_->compute_vector_range(0, ur * nb_);
+        } else if (e.is_sum(false)) {
+            const bool scale_one = e.sum.scale == 1.f;
+            if (!scale_one) {
+                CGA64::mov_imm(reg_tmp2, float2int(e.sum.scale));
+                CGA64::dup(zreg_tmp(1).s, w_tmp);
+            }
+            for (int jj = 0; jj < ur; jj++)
+                for (int ocb = 0; ocb < nb_; ocb++) {
+                    CGA64::add_imm(reg_tmp_addr, reg_out, out_off(jj, ocb),
+                            reg_tmp_imm);
+                    load_data(zreg_tmp(0), jcp.dst_dt, p_oc(ocb));
+                    if (scale_one)
+                        CGA64::fadd(zreg_acc(jj, ocb).s, zreg_acc(jj, ocb).s,
+                                zreg_tmp(0).s);
+                    else
+                        CGA64::fmla(zreg_acc(jj, ocb).s, reg_p_all_ones,
+                                zreg_tmp(0).s, zreg_tmp(1).s);
+                }
+        }
+    }
+
+    if (jcp.dst_zero_point) {
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(dst_zero_point)));
+        CGA64::ld1rw(zreg_tmp(0).s, reg_p_all_ones, xa::ptr(reg_tmp));
+        CGA64::scvtf(zreg_tmp(0).s, reg_p_all_ones / xa::T_m, zreg_tmp(0).s);
+        for (int jj = 0; jj < ur; jj++)
+            for (int ocb = 0; ocb < nb_; ocb++)
+                CGA64::fadd(zreg_acc(jj, ocb).s, zreg_acc(jj, ocb).s,
+                        zreg_tmp(0).s);
+    }
+
+    for (int jj = 0; jj < ur; jj++)
+        for (int ocb = 0; ocb < nb_; ocb++) {
+            const xa::ZReg z = zreg_acc(jj, ocb);
+            if (jcp.dst_dt != data_type::f32) {
+                CGA64::frinti(z.s, reg_p_all_ones / xa::T_m, z.s);
+                CGA64::fcvtzs(z.s, reg_p_all_ones / xa::T_m, z.s);
+            }
+            if (jcp.dst_dt == data_type::s8) {
+                CGA64::smax(z.s, -128);
+                CGA64::smin(z.s, 127);
+            } else if (jcp.dst_dt == data_type::u8) {
+                CGA64::smax(z.s, 0);
+                CGA64::umin(z.s, 255);
+            }
+
+            CGA64::add_imm(
+                    reg_tmp_addr, reg_out, out_off(jj, ocb), reg_tmp_imm);
+            if (utils::one_of(jcp.dst_dt, data_type::f32, data_type::s32))
+                CGA64::st1w(z.s, p_oc(ocb), xa::ptr(reg_tmp_addr));
+            else
+                CGA64::st1b(z.s, p_oc(ocb), xa::ptr(reg_tmp_addr));
+        }
+}
+
+void jit_sve_512_x8s8s32x_1x1_conv_kernel::compute_tile(int ur) {
+    // the shift does not survive the eltwise injector of the previous tile
+    if (!jcp.signed_input) CGA64::dup(zreg_shift().b, -128);
+    for (int jj = 0; jj < ur; jj++)
+        for (int ocb = 0; ocb < nb_; ocb++)
+            CGA64::eor(zreg_acc(jj, ocb).d, zreg_acc(jj, ocb).d,
+                    zreg_acc(jj, ocb).d);
+
+    reduce_loop(ur);
+    store_output(ur);
+}
+
+void jit_sve_512_x8s8s32x_1x1_conv_kernel::generate() {
+    const int pix_in = pix_size(jcp, jcp.ic_without_padding);
+    const int pix_out = pix_size(jcp, jcp.oc_without_padding);
+
+    nb_ = jcp.nb_load_blocking;
+    assert(jcp.ur * nb_ <= src_base() - 1);
+
+    preamble();
+
+    CGA64::ptrue(reg_p_all_ones.b);
+
+    CGA64::mov(reg_param, abi_param1_aarch64);
+    CGA64::ldr(reg_bcast, xa::ptr(reg_param, GET_OFF(bcast_data)));
+    CGA64::ldr(reg_out, xa::ptr(reg_param, GET_OFF(output_data)));
+    CGA64::ldr(reg_load, xa::ptr(reg_param, GET_OFF(load_data)));
+    CGA64::ldr(reg_bcast_dim, xa::ptr(reg_param, GET_OFF(bcast_dim)));
+
+    if (jcp.oc_tail) {
+        xa::LabelAArch64 no_oc_tail;
+        CGA64::ptrue(reg_p_oc_tail.b);
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(first_last_flag)));
+        CGA64::tst(reg_tmp, FLAG_OC_LAST);
+        CGA64::b(xa::EQ, no_oc_tail);
+        CGA64::mov_imm(reg_tmp, jcp.oc_tail);
+        CGA64::mov_imm(reg_tmp2, 0);
+        CGA64::whilelt(reg_p_oc_tail.s, reg_tmp2, reg_tmp);
+        CGA64::L_aarch64(no_oc_tail);
+    }
+
+    xa::LabelAArch64 bcast_loop, bcast_loop_tail, done;
+
+    CGA64::cmp_imm(reg_bcast_dim, jcp.ur, reg_tmp_imm);
+    CGA64::b(xa::LT, bcast_loop_tail);
+
+    CGA64::L_aarch64(bcast_loop);
+    {
+        compute_tile(jcp.ur);
+        CGA64::add_imm(reg_bcast, reg_bcast, jcp.ur * pix_in, reg_tmp_imm);
+        CGA64::add_imm(reg_out, reg_out, jcp.ur * pix_out * jcp.typesize_out,
+                reg_tmp_imm);
+        CGA64::sub_imm(reg_bcast_dim, reg_bcast_dim, jcp.ur, reg_tmp_imm);
+        CGA64::cmp_imm(reg_bcast_dim, jcp.ur, reg_tmp_imm);
+        CGA64::b(xa::GE, bcast_loop);
+    }
+
+    // Only the last block of points has a tail, always of ur_tail points.
+    CGA64::L_aarch64(bcast_loop_tail);
+    if (jcp.ur_tail) {
+        CGA64::cmp(reg_bcast_dim, 0);
+        CGA64::b(xa::EQ, done);
+        compute_tile(jcp.ur_tail);
+    }
+
+    CGA64::L_aarch64(done);
+    postamble();
+
+    if (jcp.with_eltwise) {
+        eltwise_injector_->prepare_table();
+        binCommit();
+    }
+}
+
+bool jit_sve_512_x8s8s32x_1x1_conv_kernel::post_ops_ok(
+        jit_1x1_conv_conf_t &jcp, const primitive_attr_t &attr) {
+    using namespace primitive_kind;
+    const auto &p = attr.post_ops_;
+
+    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
+
+    switch (p.len()) {
+        case 0: return true;
+        case 1: return is_eltwise(0) || p.contain(sum, 0);
+        case 2:
+            return (p.contain(sum, 0) && is_eltwise(1))
+                    || (p.contain(sum, 1) && is_eltwise(0));
+        default: return false;
+    }
+
+    return false;
+}
+
+status_t jit_sve_512_x8s8s32x_1x1_conv_kernel::init_conf(
+        jit_1x1_conv_conf_t &jcp, const convolution_desc_t &cd,
+        memory_desc_t &src_md, memory_desc_t &weights_md,
+        memory_desc_t &dst_md, memory_desc_t &bias_md,
+        const primitive_attr_t &attr, int nthreads) {
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper weights_d(&weights_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+    const memory_desc_wrapper bias_d(&bias_md);
+
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    const int ndims = src_d.ndims();
+    const bool is_1d = ndims == 3;
+    const bool is_3d = ndims == 5;
+
+    if (!(mayiuse(sve)
+                && one_of(src_d.data_type(), data_type::u8, data_type::s8)
+                && weights_d.data_type() == data_type::s8
+                && one_of(dst_d.data_type(), data_type::f32, data_type::s32,
+                        data_type::s8, data_type::u8)))
+        return status::unimplemented;
+
+    jcp = zero<decltype(jcp)>();
+    jcp.nthr = nthreads;
+    jcp.prop_kind = cd.prop_kind;
+    jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
+    jcp.mb = src_d.dims()[0];
+    jcp.oc = dst_d.dims()[1] / jcp.ngroups;
+    jcp.oc_without_padding = jcp.oc;
+    jcp.ic = src_d.dims()[1] / jcp.ngroups;
+    jcp.ic_without_padding = jcp.ic;
+    jcp.id = is_3d ? src_d.dims()[2] : 1;
+    jcp.ih = is_1d ? 1 : src_d.dims()[ndims - 2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.od = is_3d ? dst_d.dims()[2] : 1;
+    jcp.oh = is_1d ? 1 : dst_d.dims()[ndims - 2];
+    jcp.ow = dst_d.dims()[ndims - 1];
+    jcp.kd = is_3d ? weights_d.dims()[with_groups + 2] : 1;
+    jcp.kh = is_1d ? 1 : weights_d.dims()[with_groups + ndims - 2];
+    jcp.kw = weights_d.dims()[with_groups + ndims - 1];
+    jcp.f_pad = is_3d ? cd.padding[0][0] : 0;
+    jcp.t_pad = is_1d ? 0 : cd.padding[0][ndims - 4];
+    jcp.l_pad = cd.padding[0][ndims - 3];
+    jcp.stride_d = is_3d ? cd.strides[0] : 1;
+    jcp.stride_h = is_1d ? 1 : cd.strides[ndims - 4];
+    jcp.stride_w = cd.strides[ndims - 3];
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+
+    const bool is_unit_1x1 = everyone_is(1, jcp.kd, jcp.kh, jcp.kw,
+                                     jcp.stride_d, jcp.stride_h, jcp.stride_w)
+            && everyone_is(0, jcp.f_pad, jcp.t_pad, jcp.l_pad)
+            && jcp.od == jcp.id && jcp.oh == jcp.ih && jcp.ow == jcp.iw;
+    if (!is_unit_1x1) return status::unimplemented;
+    jcp.os = jcp.od * jcp.oh * jcp.ow;
+    jcp.is = jcp.os;
+
+    jcp.signed_input = src_d.data_type() == data_type::s8;
+    // one group per 16 lanes would waste most of the dot products
+    if (with_groups && everyone_is(1, jcp.ic, jcp.oc))
+        return status::unimplemented;
+
+    const auto &zp = attr.zero_points_;
+    jcp.src_zero_point = !zp.has_default_values(DNNL_ARG_SRC);
+    jcp.dst_zero_point = !zp.has_default_values(DNNL_ARG_DST);
+    if (!(zp.has_default_values(DNNL_ARG_WEIGHTS) && zp.common(DNNL_ARG_SRC)
+                && zp.common(DNNL_ARG_DST)))
+        return status::unimplemented;
+    // the compensation is scaled by the shifted source zero point
+    const int src_shift = jcp.signed_input ? 0 : 128;
+    if (jcp.src_zero_point && zp.defined(DNNL_ARG_SRC)) {
+        const int zp_shifted = *zp.get(DNNL_ARG_SRC) - src_shift;
+        if (zp_shifted < -128 || zp_shifted > 127) return status::unimplemented;
+    }
+
+    const auto dat_tag_nxc = pick(ndims - 3, nwc, nhwc, ndhwc);
+    const auto dat_tag_blk = pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
+    format_tag_t dat_tag = dat_tag_nxc;
+    if (src_d.format_kind() != format_kind::any)
+        dat_tag = src_d.matches_one_of_tag(dat_tag_nxc, dat_tag_blk);
+    else if (dst_d.format_kind() != format_kind::any)
+        dat_tag = dst_d.matches_one_of_tag(dat_tag_nxc, dat_tag_blk);
+    if (dat_tag == format_tag::undef) return status::unimplemented;
+
+    if (src_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md, dat_tag));
+    if (dst_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md, dat_tag));
+    if (src_d.matches_one_of_tag(dat_tag) != dat_tag
+            || dst_d.matches_one_of_tag(dat_tag) != dat_tag)
+        return status::unimplemented;
+    jcp.src_tag = jcp.dst_tag = dat_tag;
+    jcp.is_nspc = dat_tag == dat_tag_nxc;
+
+    jcp.ic_block = 16;
+    jcp.oc_block = 16;
+    // the blocked layouts only pad the channels of the whole tensor
+    if (!jcp.is_nspc && jcp.ngroups > 1
+            && (jcp.ic % jcp.ic_block != 0 || jcp.oc % jcp.oc_block != 0))
+        return status::unimplemented;
+    jcp.ic = rnd_up(jcp.ic, jcp.ic_block);
+    jcp.oc = rnd_up(jcp.oc, jcp.oc_block);
+    jcp.ic_tail = jcp.is_nspc ? jcp.ic_without_padding % jcp.ic_block : 0;
+    jcp.oc_tail = jcp.oc_without_padding % jcp.oc_block;
+
+    if (!post_ops_ok(jcp, attr)) return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) {
+        jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+        if (jcp.eltwise.alg == alg_kind::eltwise_pow)
+            return status::unimplemented;
+    }
+
+    jcp.ver = ver_sve;
+    jcp.isa = sve;
+
+    const auto wei_tag = with_groups
+            ? pick(ndims - 3, gOIw4i16o4i, gOIhw4i16o4i, gOIdhw4i16o4i)
+            : pick(ndims - 3, OIw4i16o4i, OIhw4i16o4i, OIdhw4i16o4i);
+    memory_desc_t want_wei_md = weights_md;
+    CHECK(memory_desc_init_by_tag(want_wei_md, wei_tag));
+    if (x8s8s32x_conv_needs_compensation(
+                jcp.signed_input, jcp.src_zero_point)) {
+        want_wei_md.extra.flags = memory_extra_flags::compensation_conv_s8s8;
+        want_wei_md.extra.compensation_mask
+                = with_groups ? (1 << 0) + (1 << 1) : (1 << 0);
+    }
+    if (weights_md.format_kind == format_kind::any)
+        weights_md = want_wei_md;
+    else if (weights_md != want_wei_md)
+        return status::unimplemented;
+    jcp.wei_tag = wei_tag;
+
+    if (jcp.with_bias) {
+        if (bias_d.format_kind() == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md, format_tag::x));
+    }
+
+    jcp.bia_dt = jcp.with_bias ? cd.bias_desc.data_type : data_type::undef;
+    jcp.dst_dt = cd.dst_desc.data_type;
+
+    jcp.typesize_in = types::data_type_size(src_d.data_type());
+    jcp.typesize_out = types::data_type_size(dst_d.data_type());
+    jcp.typesize_bia
+            = jcp.with_bias ? types::data_type_size(bias_d.data_type()) : 0;
+
+    const auto &oscales = attr.output_scales_;
+    jcp.is_oc_scale = oscales.mask_ == 1 << 1;
+    if (!(oscales.mask_ == 0 || oscales.mask_ == 1 << 1))
+        return status::unimplemented;
+
+    jcp.reduce_dim = jcp.ic;
+    jcp.reduce_block = jcp.ic_block;
+    jcp.nb_reduce = jcp.ic / jcp.ic_block;
+    jcp.load_dim = jcp.oc;
+    jcp.load_block = jcp.oc_block;
+    jcp.nb_load = jcp.oc / jcp.oc_block;
+    jcp.bcast_dim = jcp.os;
+
+    // Registers: 4 weights and ur accumulators per oc block, 4 for the
+    // broadcast source and the sign shift.
+    jcp.nb_load_blocking = jcp.nb_load % 2 == 0 ? 2 : 1;
+    const int max_ur
+            = (32 - 4 * jcp.nb_load_blocking - 4 - 1) / jcp.nb_load_blocking;
+    jcp.ur = nstl::min(jcp.os, max_ur);
+    jcp.ur_tail = jcp.os % jcp.ur;
+
+    // Points of a work item: the source block is reused by all the oc
+    // blocks, a few tiles are kept as long as every thread gets work.
+    const int nb_ur = div_up(jcp.os, jcp.ur);
+    const int load_chunks = jcp.nb_load / jcp.nb_load_blocking;
+    int ur_per_block = nstl::min(nb_ur, 8);
+    while (ur_per_block > 1
+            && jcp.mb * jcp.ngroups * load_chunks
+                            * div_up(nb_ur, ur_per_block)
+                    < jcp.nthr)
+        ur_per_block--;
+    jcp.bcast_block = ur_per_block * jcp.ur;
+    jcp.nb_bcast = div_up(jcp.os, jcp.bcast_block);
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
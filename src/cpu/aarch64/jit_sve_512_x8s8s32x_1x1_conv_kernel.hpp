@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_512_X8S8S32X_1X1_CONV_KERNEL_HPP
+#define CPU_AARCH64_JIT_SVE_512_X8S8S32X_1X1_CONV_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_conv_kernel.hpp"
+#include "cpu/aarch64/jit_uni_eltwise_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Unit-stride 1x1 int8 forward convolution without padding. The spatial
+// dimensions are flattened: a call computes bcast_dim consecutive points for
+// nb_load_blocking blocks of 16 output channels, in tiles of ur points.
+// Strided or padded 1x1 convolutions are left to the direct kernel.
+struct jit_sve_512_x8s8s32x_1x1_conv_kernel : public jit_generator {
+    jit_sve_512_x8s8s32x_1x1_conv_kernel(
+            const jit_1x1_conv_conf_t &ajcp, const primitive_attr_t &attr)
+        : jit_generator(nullptr, 256 * 1024)
+        , jcp(ajcp)
+        , attr_(attr)
+        , eltwise_injector_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise);
+        generate();
+        jit_ker = (void (*)(jit_1x1_conv_call_s *))getCode32();
+    }
+
+    ~jit_sve_512_x8s8s32x_1x1_conv_kernel() { delete eltwise_injector_; }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_512_x8s8s32x_1x1_conv_kernel)
+
+    static bool post_ops_ok(
+            jit_1x1_conv_conf_t &jcp, const primitive_attr_t &attr);
+    static status_t init_conf(jit_1x1_conv_conf_t &jcp,
+            const convolution_desc_t &cd, memory_desc_t &src_md,
+            memory_desc_t &weights_md, memory_desc_t &dst_md,
+            memory_desc_t &bias_md, const primitive_attr_t &attr,
+            int nthreads);
+
+    jit_1x1_conv_conf_t jcp;
+    const primitive_attr_t &attr_;
+    void (*jit_ker)(jit_1x1_conv_call_s *);
+
+private:
+    using reg64_t = const xa::XReg;
+    enum {
+        ic_sub_step = 4, // input channels reduced by one SDOT lane
+        n_src_regs = ic_sub_step,
+        wei_block_size = 256, // 4i16o4i bytes of an (oc, ic) block pair
+    };
+
+    const xa::PReg reg_p_all_ones = p2;
+    const xa::PReg reg_p_oc_tail = p3;
+
+    /* x0 (p_table of the eltwise injector), x4 (stack of the translated
+     * code) and x22-x28 (temporaries of the injector) are not used. */
+    reg64_t reg_bcast = x1; // src of the current tile
+    reg64_t reg_out = x2; // dst of the current tile
+    reg64_t reg_load = x3; // weights of the first ic block
+    reg64_t reg_bcast_dim = x5; // points left
+    reg64_t aux_reg_bcast = x6; // src of the current ic block
+    reg64_t reg_param = x7;
+    reg64_t aux_reg_load = x8; // weights of the current ic block
+    reg64_t reg_load_ocb = x9; // weights of the second oc block
+    reg64_t reg_reduce = x10;
+    reg64_t reg_tmp_addr = x11;
+    reg64_t reg_tmp_imm = x12;
+    reg64_t reg_tmp = x13;
+    reg64_t reg_tmp2 = x14;
+
+    int nb_ = 0; // oc blocks of the code being generated
+
+    int wei_base() const { return 32 - ic_sub_step * nb_; }
+    int src_base() const { return wei_base() - n_src_regs; }
+    xa::ZReg zreg_acc(int jj, int ocb) const {
+        return xa::ZReg(jj * nb_ + ocb);
+    }
+    xa::ZReg zreg_wei(int ocb, int i4) const {
+        return xa::ZReg(wei_base() + ocb * ic_sub_step + i4);
+    }
+    xa::ZReg zreg_src(int i4) const { return xa::ZReg(src_base() + i4); }
+    xa::ZReg zreg_shift() const { return xa::ZReg(src_base() - 1); }
+    // the weights and the source registers are free while storing
+    xa::ZReg zreg_tmp(int i) const { return xa::ZReg(src_base() + i); }
+    xa::PReg p_oc(int ocb) const {
+        return jcp.oc_tail && ocb == nb_ - 1 ? reg_p_oc_tail : reg_p_all_ones;
+    }
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+
+    bool needs_compensation() const {
+        return x8s8s32x_conv_needs_compensation(
+                jcp.signed_input, jcp.src_zero_point);
+    }
+    void load_src(int i4, int ic_tail);
+    void reduce_step(int ur, bool last_icb);
+    void reduce_loop(int ur);
+    void load_data(const xa::ZReg &z, data_type_t dt, const xa::PReg &p);
+    void store_output(int ur);
+    void compute_tile(int ur);
+    void generate();
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_1x1_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+using namespace nstl;
+
+#define wht_blk_off(d, g, ...) \
+    (pd()->with_groups() ? (d).blk_off((g), __VA_ARGS__) \
+                         : (d).blk_off(__VA_ARGS__))
+
+template <data_type_t src_type, data_type_t dst_type>
+status_t jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<src_type,
+        dst_type>::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const size_t bia_dt_size = pd()->with_bias()
+            ? types::data_type_size(pd()->desc()->bias_desc.data_type)
+            : 0;
+
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.nb_load % jcp.nb_load_blocking == 0);
+
+    // the kernel scales the compensation by the shifted zero point
+    const int src_shift = jcp.signed_input ? 0 : 128;
+    if (jcp.src_zero_point
+            && (src_zero_point - src_shift < -128
+                    || src_zero_point - src_shift > 127))
+        return invalid_arguments;
+
+    const float *oscales = pd()->attr()->output_scales_.scales_;
+
+    const bool with_comp = x8s8s32x_conv_needs_compensation(
+            jcp.signed_input, jcp.src_zero_point);
+    const size_t offset = weights_d.size() - weights_d.additional_buffer_size();
+    auto w = const_cast<wei_data_t *>(weights);
+    const int32_t *compensation
+            = with_comp ? reinterpret_cast<int32_t *>(&w[offset]) : nullptr;
+
+    // points are contiguous in both the nxc and the blocked layouts
+    const int src_pix = jcp.is_nspc ? jcp.ngroups * jcp.ic_without_padding
+                                    : jcp.ic_block;
+    const int dst_pix = jcp.is_nspc ? jcp.ngroups * jcp.oc_without_padding
+                                    : jcp.oc_block;
+
+    const int load_chunks = jcp.nb_load / jcp.nb_load_blocking;
+    const size_t work_amount
+            = (size_t)jcp.mb * jcp.ngroups * jcp.nb_bcast * load_chunks;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        size_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        auto p = jit_1x1_conv_call_s();
+        p.src_zero_point = &src_zero_point;
+        p.dst_zero_point = &dst_zero_point;
+
+        // the oc chunks are innermost to reuse the source block
+        int n {0}, g {0}, bcb {0}, occ {0};
+        nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, bcb, jcp.nb_bcast,
+                occ, load_chunks);
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const int ocb = occ * jcp.nb_load_blocking;
+            const int g_oc = g * jcp.oc_without_padding + ocb * jcp.oc_block;
+            const int c_out = jcp.is_nspc ? g_oc : g * jcp.nb_load + ocb;
+            const int c_in = jcp.is_nspc ? g * jcp.ic_without_padding
+                                         : g * jcp.nb_reduce;
+            const int os_start = bcb * jcp.bcast_block;
+
+            p.bcast_data = src + src_d.blk_off(n, c_in) + os_start * src_pix;
+            p.output_data = dst + dst_d.blk_off(n, c_out) + os_start * dst_pix;
+            p.load_data = weights + wht_blk_off(weights_d, g, ocb, 0);
+            p.bias_data = bias ? bias + g_oc * bia_dt_size : nullptr;
+            p.scales = &oscales[jcp.is_oc_scale * g_oc];
+            p.compensation = with_comp
+                    ? compensation + (g * jcp.nb_load + ocb) * jcp.oc_block
+                    : nullptr;
+            p.bcast_dim = min(jcp.bcast_block, jcp.os - os_start);
+            p.first_last_flag = ocb + jcp.nb_load_blocking == jcp.nb_load
+                    ? FLAG_OC_LAST
+                    : 0;
+
+            kernel_->jit_ker(&p);
+
+            nd_iterator_step(n, jcp.mb, g, jcp.ngroups, bcb, jcp.nb_bcast, occ,
+                    load_chunks);
+        }
+    });
+
+    return success;
+}
+
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::s8,
+        data_type::u8>;
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::u8,
+        data_type::u8>;
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::s8,
+        data_type::s8>;
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::u8,
+        data_type::s8>;
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::s8,
+        data_type::s32>;
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::u8,
+        data_type::s32>;
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::s8,
+        data_type::f32>;
+template struct jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<data_type::u8,
+        data_type::f32>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_512_X8S8S32X_CONV_KERNEL_HPP
+#define CPU_AARCH64_JIT_SVE_512_X8S8S32X_CONV_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+#include "cpu/aarch64/jit_uni_eltwise_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// SDOT multiplies signed bytes only: a u8 source is shifted to s8 by flipping
+// its sign bit (x - 128) and the weights carry the s8s8 compensation
+// -128 * sum(w). The same compensation, scaled, removes a source zero point,
+// so both cases compute the padded taps with the shifted zero point instead of
+// skipping them.
+inline bool x8s8s32x_conv_needs_compensation(
+        bool signed_input, bool src_zero_point) {
+    return !signed_input || src_zero_point;
+}
+
+// Direct int8 forward convolution for [n][d][h]wc and nC[d][h]w16c
+// activations and [g]OI[d][h]w4i16o4i weights. A call computes a whole output
+// row for nb_oc_blocking blocks of 16 output channels; the row is split into
+// blocks of ur_w points at generation time, so the left and right paddings
+// are resolved statically.
+struct jit_sve_512_x8s8s32x_fwd_kernel : public jit_generator {
+
+    jit_sve_512_x8s8s32x_fwd_kernel(
+            const jit_conv_conf_t &ajcp, const primitive_attr_t &attr)
+        : jit_generator(nullptr, 1024 * 1024)
+        , jcp(ajcp)
+        , attr_(attr)
+        , eltwise_injector_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise);
+        generate();
+        jit_ker_ = (void (*)(jit_conv_call_s *))getCode32();
+    }
+
+    ~jit_sve_512_x8s8s32x_fwd_kernel() { delete eltwise_injector_; }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_512_x8s8s32x_fwd_kernel)
+
+    static bool post_ops_ok(jit_conv_conf_t &jcp, const primitive_attr_t &attr);
+    static status_t init_conf(jit_conv_conf_t &jcp,
+            const convolution_desc_t &cd, memory_desc_t &src_pd,
+            memory_desc_t &weights_pd, memory_desc_t &dst_pd,
+            memory_desc_t &bias_pd, const primitive_attr_t &attr,
+            int nthreads);
+
+    // Full blocks of ur_w points in [b_l, b_r) have no padded tap.
+    static void ow_interior_blocks(
+            const jit_conv_conf_t &jcp, int &b_l, int &b_r);
+
+    jit_conv_conf_t jcp;
+    const primitive_attr_t &attr_;
+    void (*jit_ker_)(jit_conv_call_s *);
+
+private:
+    using reg64_t = const xa::XReg;
+    enum {
+        ic_sub_step = 4, // input channels reduced by one SDOT lane
+        n_src_regs = ic_sub_step,
+        wei_tap_size = 256, // 4i16o4i bytes of a (kd, kh, kw) tap
+    };
+
+    const xa::PReg reg_p_all_ones = p2;
+    const xa::PReg reg_p_oc_tail = p3;
+
+    /* x0 (p_table of the eltwise injector), x4 (stack of the translated
+     * code) and x22-x28 (temporaries of the injector) are not used. */
+    reg64_t reg_inp = x1; // src of the current ow block
+    reg64_t reg_out = x2; // dst of the current ow block
+    reg64_t reg_ker = x3; // filter of the first input channel block
+    reg64_t reg_icb = x5;
+    reg64_t aux_reg_inp = x6; // src of the current ic block
+    reg64_t reg_param = x7;
+    reg64_t aux_reg_ker = x8; // filter of the current ic block
+    reg64_t aux_reg_inp_d = x9;
+    reg64_t aux_reg_ker_d = x10;
+    reg64_t aux_reg_inp_h = x11; // src of the current filter row
+    reg64_t aux_reg_ker_h = x12; // filter of the current filter row
+    reg64_t reg_kd = x13;
+    reg64_t reg_kh = x14;
+    reg64_t reg_tmp_addr = x15;
+    reg64_t reg_tmp_imm = x16;
+    reg64_t reg_tmp = x17;
+    reg64_t reg_tmp2 = x18;
+    reg64_t reg_ker_ocb = x19; // filter of the second oc block
+    reg64_t reg_owb = x20;
+
+    int nb_ = 0; // oc blocks of the code being generated
+
+    int wei_base() const { return 32 - ic_sub_step * nb_; }
+    int src_base() const { return wei_base() - n_src_regs; }
+    xa::ZReg zreg_acc(int jj, int ocb) const {
+        return xa::ZReg(jj * nb_ + ocb);
+    }
+    xa::ZReg zreg_wei(int ocb, int i4) const {
+        return xa::ZReg(wei_base() + ocb * ic_sub_step + i4);
+    }
+    xa::ZReg zreg_src(int i4) const { return xa::ZReg(src_base() + i4); }
+    xa::ZReg zreg_shift() const { return xa::ZReg(src_base() - 1); }
+    xa::ZReg zreg_pad() const { return xa::ZReg(src_base() - 2); }
+    // the weights and the source registers are free while storing
+    xa::ZReg zreg_tmp(int i) const { return xa::ZReg(src_base() + i); }
+    xa::PReg p_oc(int ocb) const {
+        return jcp.oc_tail && ocb == nb_ - 1 ? reg_p_oc_tail : reg_p_all_ones;
+    }
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+
+    bool needs_compensation() const {
+        return x8s8s32x_conv_needs_compensation(
+                jcp.signed_input, jcp.src_zero_point);
+    }
+    bool is_valid_tap(int ow, int ki) const;
+    void load_src(int i4, int off, int ic_tail);
+    void init_constants();
+    void compute_row(int ur, int ow_start, bool last_icb);
+    void compute_pad_rows(int ur, bool last_icb, reg64_t reg_cnt);
+    void kh_loop(int ur, int ow_start, bool last_icb);
+    void kd_loop(int ur, int ow_start, bool last_icb);
+    void icb_loop(int ur, int ow_start);
+    void load_data(const xa::ZReg &z, data_type_t dt, const xa::PReg &p);
+    void store_output(int ur);
+    void compute_ow_block(int ur, int ow_start);
+    void generate();
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
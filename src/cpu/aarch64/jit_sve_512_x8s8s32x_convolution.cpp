@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <utility>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+using namespace nstl;
+
+#define wht_blk_off(d, g, ...) \
+    (pd()->with_groups() ? (d).blk_off((g), __VA_ARGS__) \
+                         : (d).blk_off(__VA_ARGS__))
+
+template <data_type_t src_type, data_type_t dst_type>
+status_t jit_sve_512_x8s8s32x_convolution_fwd_t<src_type,
+        dst_type>::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const size_t bia_dt_size = pd()->with_bias()
+            ? types::data_type_size(pd()->desc()->bias_desc.data_type)
+            : 0;
+
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
+
+    // the kernel broadcasts the shifted zero point as an s8 value
+    const int src_shift = jcp.signed_input ? 0 : 128;
+    if (jcp.src_zero_point
+            && (src_zero_point - src_shift < -128
+                    || src_zero_point - src_shift > 127))
+        return invalid_arguments;
+
+    const float *oscales = pd()->attr()->output_scales_.scales_;
+
+    const bool with_comp = x8s8s32x_conv_needs_compensation(
+            jcp.signed_input, jcp.src_zero_point);
+    const size_t offset = weights_d.size() - weights_d.additional_buffer_size();
+    auto w = const_cast<wei_data_t *>(weights);
+    const int32_t *compensation
+            = with_comp ? reinterpret_cast<int32_t *>(&w[offset]) : nullptr;
+
+    const int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
+    const size_t work_amount = (size_t)jcp.mb * jcp.ngroups * oc_chunks
+            * jcp.od * jcp.oh;
+    const size_t wei_tap_size = jcp.ic_block * jcp.oc_block;
+
+    // number of filter taps (rows or planes) falling into the padding
+    auto overflow = [](int i_start, int i_size, int k, int dilate) {
+        const int dil = dilate + 1;
+        const int front = min(k, div_up(max(0, -i_start), dil));
+        const int back = min(k,
+                div_up(max(0, i_start - i_size + (k - 1) * dil + 1), dil));
+        return std::make_pair(front, back);
+    };
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        size_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        auto p = jit_conv_call_s();
+        p.src_zero_point = &src_zero_point;
+        p.dst_zero_point = &dst_zero_point;
+
+        int n {0}, g {0}, occ {0}, od_s {0}, oh_s {0};
+        nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, occ, oc_chunks,
+                od_s, jcp.od, oh_s, jcp.oh);
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const int ocb = occ * jcp.nb_oc_blocking;
+            const int g_oc = g * jcp.oc_without_padding + ocb * jcp.oc_block;
+            const int c_out = jcp.is_nspc ? g_oc : g * jcp.nb_oc + ocb;
+            const int c_in = jcp.is_nspc ? g * jcp.ic_without_padding
+                                         : g * jcp.nb_ic;
+
+            const int ij = oh_s * jcp.stride_h - jcp.t_pad;
+            const auto h_ovf = overflow(ij, jcp.ih, jcp.kh, jcp.dilate_h);
+            const int ih_s = ij + h_ovf.first * (jcp.dilate_h + 1);
+            const int dj = od_s * jcp.stride_d - jcp.f_pad;
+            const auto d_ovf = overflow(dj, jcp.id, jcp.kd, jcp.dilate_d);
+            const int id_s = dj + d_ovf.first * (jcp.dilate_d + 1);
+
+            size_t src_off, dst_off;
+            if (jcp.ndims == 3) {
+                src_off = src_d.blk_off(n, c_in, 0);
+                dst_off = dst_d.blk_off(n, c_out, 0);
+            } else if (jcp.ndims == 4) {
+                src_off = src_d.blk_off(n, c_in, ih_s, 0);
+                dst_off = dst_d.blk_off(n, c_out, oh_s, 0);
+            } else {
+                src_off = src_d.blk_off(n, c_in, id_s, ih_s, 0);
+                dst_off = dst_d.blk_off(n, c_out, od_s, oh_s, 0);
+            }
+
+            // Without compensation the padded taps are skipped, so the
+            // filter starts at the first row and plane inside the source.
+            size_t wht_off = wht_blk_off(weights_d, g, ocb, 0);
+            if (!with_comp)
+                wht_off += (d_ovf.first * jcp.kh + h_ovf.first) * jcp.kw
+                        * wei_tap_size;
+
+            p.src = src + src_off;
+            p.dst = dst + dst_off;
+            p.filt = weights + wht_off;
+            p.bias = bias ? bias + g_oc * bia_dt_size : nullptr;
+            p.scales = &oscales[jcp.is_oc_scale * g_oc];
+            p.compensation = with_comp
+                    ? compensation + (g * jcp.nb_oc + ocb) * jcp.oc_block
+                    : nullptr;
+            p.t_overflow = h_ovf.first;
+            p.b_overflow = h_ovf.second;
+            p.kh_padding = max(0, jcp.kh - h_ovf.first - h_ovf.second);
+            p.f_overflow = d_ovf.first;
+            p.back_overflow = d_ovf.second;
+            p.kd_padding = max(0, jcp.kd - d_ovf.first - d_ovf.second);
+            p.flags = ocb + jcp.nb_oc_blocking == jcp.nb_oc ? FLAG_OC_LAST : 0;
+
+            kernel_->jit_ker_(&p);
+
+            nd_iterator_step(n, jcp.mb, g, jcp.ngroups, occ, oc_chunks, od_s,
+                    jcp.od, oh_s, jcp.oh);
+        }
+    });
+
+    return success;
+}
+
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::s8,
+        data_type::u8>;
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::u8,
+        data_type::u8>;
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::s8,
+        data_type::s8>;
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::u8,
+        data_type::s8>;
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::s8,
+        data_type::s32>;
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::u8,
+        data_type::s32>;
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::s8,
+        data_type::f32>;
+template struct jit_sve_512_x8s8s32x_convolution_fwd_t<data_type::u8,
+        data_type::f32>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_deconvolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+
+template <data_type_t src_type, data_type_t dst_type>
+void jit_sve_512_x8s8s32x_deconvolution_fwd_t<src_type,
+        dst_type>::flip_weights(const int8_t *wei, int8_t *flipped) const {
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const int sp_ndims = pd()->ndims() - 2;
+    const int wei_sp_off = pd()->with_groups() + 2;
+
+    // The taps of an (OIhw4i16o4i) block of channels are contiguous, and
+    // flipping all the spatial dimensions reverses their order.
+    const auto &blk = wei_d.blocking_desc();
+    dim_t tap_size = 1;
+    for (int i = 0; i < blk.inner_nblks; i++)
+        tap_size *= blk.inner_blks[i];
+    dim_t ks = 1;
+    for (int d = 0; d < sp_ndims; d++)
+        ks *= wei_d.dims()[wei_sp_off + d];
+    assert(blk.strides[wei_sp_off + sp_ndims - 1] == tap_size);
+
+    const size_t wei_size = wei_d.size() - wei_d.additional_buffer_size();
+    const dim_t nb_blocks = wei_size / (ks * tap_size);
+    parallel_nd(nb_blocks, ks, [&](dim_t b, dim_t t) {
+        utils::array_copy(&flipped[(b * ks + ks - 1 - t) * tap_size],
+                &wei[(b * ks + t) * tap_size], tap_size);
+    });
+
+    // The compensation sums over all the taps, so it does not change.
+    utils::array_copy(&flipped[wei_size], &wei[wei_size],
+            wei_d.additional_buffer_size());
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+status_t jit_sve_512_x8s8s32x_deconvolution_fwd_t<src_type,
+        dst_type>::execute(const exec_ctx_t &ctx) const {
+    exec_args_t conv_args(ctx.args());
+
+    int8_t *flipped_wei = nullptr;
+    if (pd()->flip_weights_) {
+        flipped_wei = ctx.get_scratchpad_grantor().template get<int8_t>(
+                key_deconv_flipped_wei);
+        flip_weights(CTX_IN_MEM(const int8_t *, DNNL_ARG_WEIGHTS),
+                flipped_wei);
+    }
+    memory_t flipped(ctx.stream()->engine(), pd()->weights_md(),
+            memory_flags_t::use_runtime_ptr, flipped_wei);
+    if (pd()->flip_weights_) conv_args[DNNL_ARG_WEIGHTS] = {&flipped, true};
+
+    exec_ctx_t conv_ctx(ctx.stream(), std::move(conv_args));
+    nested_scratchpad_t ns(ctx, key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::s8,
+        data_type::u8>;
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::u8,
+        data_type::u8>;
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::s8,
+        data_type::s8>;
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::u8,
+        data_type::s8>;
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::s8,
+        data_type::s32>;
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::u8,
+        data_type::s32>;
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::s8,
+        data_type::f32>;
+template struct jit_sve_512_x8s8s32x_deconvolution_fwd_t<data_type::u8,
+        data_type::f32>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
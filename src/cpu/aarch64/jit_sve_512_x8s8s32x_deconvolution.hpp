@@ -0,0 +1,180 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_512_X8S8S32X_DECONVOLUTION_HPP
+#define CPU_AARCH64_JIT_SVE_512_X8S8S32X_DECONVOLUTION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/cpu_deconvolution_pd.hpp"
+
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_1x1_convolution.hpp"
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// A deconvolution with unit strides is the convolution of the source with
+// the spatially flipped weights and the paddings (K - 1) * (D + 1) - P,
+// where K is the kernel size and D the dilation. It is computed by the SDOT
+// convolutions, the weights are flipped to the scratchpad at execution.
+// Strided deconvolutions are left to the reference implementation.
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+struct jit_sve_512_x8s8s32x_deconvolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        pd_t(const deconvolution_desc_t *adesc, const primitive_attr_t *attr,
+                const deconvolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_deconvolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        pd_t(const pd_t &other)
+            : cpu_deconvolution_fwd_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone())
+            , flip_weights_(other.flip_weights_) {}
+
+        ~pd_t() = default;
+
+        DECLARE_COMMON_PD_T(
+                conv_pd_->name(), jit_sve_512_x8s8s32x_deconvolution_fwd_t);
+
+        status_t init_convolution(engine_t *engine) {
+            const auto dd = desc();
+            const int sp_ndims = ndims() - 2;
+            const int wei_sp_off = with_groups() + 2;
+
+            dims_t padding_l {}, padding_r {};
+            for (int d = 0; d < sp_ndims; d++) {
+                if (dd->strides[d] != 1) return status::unimplemented;
+                const dim_t ext_k = (dd->weights_desc.dims[wei_sp_off + d] - 1)
+                        * (dd->dilates[d] + 1);
+                padding_l[d] = ext_k - dd->padding[0][d];
+                padding_r[d] = ext_k - dd->padding[1][d];
+                if (padding_l[d] < 0 || padding_r[d] < 0)
+                    return status::unimplemented;
+            }
+
+            // The deconvolution weights are oc x ic like the convolution
+            // ones, only the taps are flipped.
+            convolution_desc_t cd;
+            CHECK(conv_desc_init(&cd, prop_kind::forward_training,
+                    alg_kind::convolution_direct, &dd->src_desc,
+                    &dd->weights_desc, &dd->bias_desc, &dd->dst_desc,
+                    dd->strides, dd->dilates, padding_l, padding_r));
+
+            primitive_attr_t conv_attr(*attr());
+            if (!conv_attr.is_initialized()) return status::out_of_memory;
+            conv_attr.set_scratchpad_mode(scratchpad_mode::user);
+
+            primitive_desc_t *_conv_pd = nullptr;
+            status_t status = primitive_desc_t::create<conv_1x1_pd_t>(
+                    &_conv_pd, (op_desc_t *)&cd, &conv_attr, engine, nullptr);
+            if (status != status::success)
+                status = primitive_desc_t::create<conv_pd_t>(&_conv_pd,
+                        (op_desc_t *)&cd, &conv_attr, engine, nullptr);
+            if (status != status::success) return status;
+            conv_pd_.reset(_conv_pd);
+
+            dim_t ks = 1;
+            for (int d = 0; d < sp_ndims; d++)
+                ks *= dd->weights_desc.dims[wei_sp_off + d];
+            flip_weights_ = ks > 1;
+
+            return set_default_params();
+        }
+
+        status_t init(engine_t *engine) {
+            bool ok = true && is_fwd()
+                    && desc()->alg_kind == alg_kind::deconvolution_direct
+                    && !has_zero_dim_memory()
+                    && desc()->src_desc.data_type == src_type
+                    && desc()->dst_desc.data_type == dst_type
+                    && desc()->weights_desc.data_type == data_type::s8
+                    && IMPLICATION(with_bias(),
+                            utils::one_of(desc()->bias_desc.data_type,
+                                    data_type::f32, data_type::s32,
+                                    data_type::s8, data_type::u8))
+                    && desc()->accum_data_type == data_type::s32
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::oscale
+                            | primitive_attr_t::skip_mask_t::post_ops);
+            if (!ok) return status::unimplemented;
+
+            CHECK(init_convolution(engine));
+            init_scratchpad();
+
+            return status::success;
+        }
+
+    protected:
+        status_t set_default_params() {
+            src_md_ = *conv_pd_->src_md();
+            dst_md_ = *conv_pd_->dst_md();
+            weights_md_ = *conv_pd_->weights_md();
+            if (with_bias()) bias_md_ = *conv_pd_->weights_md(1);
+            return status::success;
+        }
+
+        using conv_pd_t = typename jit_sve_512_x8s8s32x_convolution_fwd_t<
+                src_type, dst_type>::pd_t;
+        using conv_1x1_pd_t =
+                typename jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<src_type,
+                        dst_type>::pd_t;
+        friend jit_sve_512_x8s8s32x_deconvolution_fwd_t;
+
+        std::unique_ptr<primitive_desc_t> conv_pd_;
+        bool flip_weights_ = false;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            if (flip_weights_)
+                scratchpad.book<int8_t>(key_deconv_flipped_wei,
+                        memory_desc_wrapper(weights_md_).size());
+            scratchpad.book(key_nested, conv_pd_->scratchpad_registry());
+        }
+    };
+
+    jit_sve_512_x8s8s32x_deconvolution_fwd_t(const pd_t *apd)
+        : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return pd()->conv_pd_->create_primitive(conv_p_, engine);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    // Reverses the order of the taps of every block of the weights.
+    void flip_weights(const int8_t *wei, int8_t *flipped) const;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
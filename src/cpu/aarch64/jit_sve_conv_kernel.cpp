@@ -0,0 +1,409 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_conv_kernel.hpp"
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(jit_conv_call_s, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::utils;
+
+namespace {
+// Range of the signed immediate of the predicated SVE loads and stores, in
+// vector lengths.
+bool mul_vl_imm_check(dim_t ofs, int vlen) {
+    return ofs % vlen == 0 && ofs / vlen >= -8 && ofs / vlen <= 7;
+}
+} // namespace
+
+void jit_sve_conv_fwd_kernel::load_dst(const xa::ZRegS &z, int i, int j) {
+    const int vlen = jcp.simd_w * typesize;
+    const dim_t ofs
+            = ((dim_t)i * jcp.ngroups * jcp.oc) * typesize + (dim_t)j * vlen;
+    if (mul_vl_imm_check(ofs, vlen)) {
+        CGA64::ld1w(z, block_pred(j) / xa::T_z,
+                xa::ptr(reg_dst, static_cast<int32_t>(ofs / vlen), xa::MUL_VL));
+    } else {
+        CGA64::add_imm(reg_tmp, reg_dst, ofs, reg_tmp_imm);
+        CGA64::ld1w(z, block_pred(j) / xa::T_z, xa::ptr(reg_tmp));
+    }
+}
+
+void jit_sve_conv_fwd_kernel::store_dst(const xa::ZRegS &z, int i, int j) {
+    const int vlen = jcp.simd_w * typesize;
+    const dim_t ofs
+            = ((dim_t)i * jcp.ngroups * jcp.oc) * typesize + (dim_t)j * vlen;
+    if (mul_vl_imm_check(ofs, vlen)) {
+        CGA64::st1w(z, block_pred(j),
+                xa::ptr(reg_dst, static_cast<int32_t>(ofs / vlen), xa::MUL_VL));
+    } else {
+        CGA64::add_imm(reg_tmp, reg_dst, ofs, reg_tmp_imm);
+        CGA64::st1w(z, block_pred(j), xa::ptr(reg_tmp));
+    }
+}
+
+void jit_sve_conv_fwd_kernel::init_tile(int ur) {
+    const int nb = jcp.nb_oc_blocking;
+    if (jcp.with_bias) {
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(bias)));
+        for (int j = 0; j < nb; j++)
+            CGA64::ld1w(zreg_acc_s(0, j), block_pred(j) / xa::T_z,
+                    xa::ptr(reg_tmp, static_cast<int32_t>(j), xa::MUL_VL));
+        for (int i = 1; i < ur; i++)
+            for (int j = 0; j < nb; j++)
+                CGA64::mov(xa::ZRegD(zreg_acc_s(i, j).getIdx()),
+                        xa::ZRegD(zreg_acc_s(0, j).getIdx()));
+    } else {
+        for (int i = 0; i < ur; i++)
+            for (int j = 0; j < nb; j++)
+                CGA64::fmov(zreg_acc_s(i, j));
+    }
+}
+
+void jit_sve_conv_fwd_kernel::fma_step(int ur, int uk) {
+    const int nb = jcp.nb_oc_blocking;
+    // The weights are not padded, the output channel tail is masked.
+    for (int j = 0; j < nb; j++)
+        CGA64::ld1w(zreg_wei_s(j), block_pred(j) / xa::T_z,
+                xa::ptr(reg_filt_ic, static_cast<int32_t>(j), xa::MUL_VL));
+    CGA64::add_imm(reg_filt_ic, reg_filt_ic,
+            (dim_t)jcp.ngroups * jcp.oc * typesize, reg_tmp_imm);
+
+    for (int i = 0; i < ur; i++) {
+        CGA64::ld1rw(zreg_src_s(i), reg_p_all_ones,
+                xa::ptr(reg_src_pt[i], static_cast<int32_t>(uk * typesize)));
+        for (int j = 0; j < nb; j++)
+            CGA64::fmla(zreg_acc_s(i, j), reg_p_all_ones, zreg_wei_s(j),
+                    zreg_src_s(i));
+    }
+}
+
+void jit_sve_conv_fwd_kernel::ic_loop(int ur) {
+    auto advance = [=](int nk) {
+        for (int i = 0; i < ur; i++)
+            CGA64::add_imm(reg_src_pt[i], reg_src_pt[i], nk * typesize,
+                    reg_tmp_imm);
+        CGA64::sub_imm(reg_ic, reg_ic, nk, reg_tmp_imm);
+    };
+
+    xa::LabelAArch64 ic_loop_main, ic_loop_tail, ic_loop_end;
+
+    CGA64::mov_imm(reg_ic, jcp.ic);
+    CGA64::cmp_imm(reg_ic, unroll_ic, reg_tmp_imm);
+    CGA64::b(xa::LT, ic_loop_tail);
+
+    CGA64::L_aarch64(ic_loop_main);
+    {
+        for (int uk = 0; uk < unroll_ic; uk++)
+            fma_step(ur, uk);
+        advance(unroll_ic);
+        CGA64::cmp_imm(reg_ic, unroll_ic, reg_tmp_imm);
+        CGA64::b(xa::GE, ic_loop_main);
+    }
+
+    CGA64::L_aarch64(ic_loop_tail);
+    {
+        CGA64::cmp(reg_ic, 0);
+        CGA64::b(xa::LE, ic_loop_end);
+        fma_step(ur, 0);
+        advance(1);
+        CGA64::b(ic_loop_tail);
+    }
+
+    CGA64::L_aarch64(ic_loop_end);
+}
+
+void jit_sve_conv_fwd_kernel::kw_loop(int ur) {
+    const dim_t src_pt_stride
+            = (dim_t)jcp.stride_w * jcp.ngroups * jcp.ic * typesize;
+
+    xa::LabelAArch64 kw_loop_begin, kw_loop_end;
+
+    CGA64::mov(reg_src_w, reg_src_h);
+    CGA64::mov(reg_filt_w, reg_filt_h);
+    CGA64::ldr(reg_kw, xa::ptr(reg_param, GET_OFF(kw_padding)));
+
+    CGA64::L_aarch64(kw_loop_begin);
+    {
+        CGA64::cmp(reg_kw, 0);
+        CGA64::b(xa::LE, kw_loop_end);
+
+        CGA64::mov(reg_src_pt[0], reg_src_w);
+        for (int i = 1; i < ur; i++)
+            CGA64::add_imm(reg_src_pt[i], reg_src_pt[i - 1], src_pt_stride,
+                    reg_tmp_imm);
+        CGA64::mov(reg_filt_ic, reg_filt_w);
+
+        ic_loop(ur);
+
+        CGA64::add_imm(reg_src_w, reg_src_w,
+                (dim_t)(jcp.dilate_w + 1) * jcp.ngroups * jcp.ic * typesize,
+                reg_tmp_imm);
+        CGA64::add_imm(reg_filt_w, reg_filt_w,
+                (dim_t)jcp.ic * jcp.ngroups * jcp.oc * typesize, reg_tmp_imm);
+        CGA64::sub_imm(reg_kw, reg_kw, 1, reg_tmp_imm);
+        CGA64::b(kw_loop_begin);
+    }
+
+    CGA64::L_aarch64(kw_loop_end);
+}
+
+void jit_sve_conv_fwd_kernel::tap_loops(int ur) {
+    const dim_t src_row = (dim_t)jcp.iw * jcp.ngroups * jcp.ic * typesize;
+    const dim_t filt_kw = (dim_t)jcp.ic * jcp.ngroups * jcp.oc * typesize;
+
+    xa::LabelAArch64 kd_loop_begin, kd_loop_end, kh_loop_begin, kh_loop_end;
+
+    CGA64::mov(reg_src_d, reg_src);
+    CGA64::mov(reg_filt_d, reg_filt);
+    CGA64::ldr(reg_kd, xa::ptr(reg_param, GET_OFF(kd_padding)));
+
+    CGA64::L_aarch64(kd_loop_begin);
+    {
+        CGA64::cmp(reg_kd, 0);
+        CGA64::b(xa::LE, kd_loop_end);
+
+        CGA64::mov(reg_src_h, reg_src_d);
+        CGA64::mov(reg_filt_h, reg_filt_d);
+        CGA64::ldr(reg_kh, xa::ptr(reg_param, GET_OFF(kh_padding)));
+
+        CGA64::L_aarch64(kh_loop_begin);
+        {
+            CGA64::cmp(reg_kh, 0);
+            CGA64::b(xa::LE, kh_loop_end);
+
+            kw_loop(ur);
+
+            CGA64::add_imm(reg_src_h, reg_src_h,
+                    (dim_t)(jcp.dilate_h + 1) * src_row, reg_tmp_imm);
+            CGA64::add_imm(reg_filt_h, reg_filt_h, (dim_t)jcp.kw * filt_kw,
+                    reg_tmp_imm);
+            CGA64::sub_imm(reg_kh, reg_kh, 1, reg_tmp_imm);
+            CGA64::b(kh_loop_begin);
+        }
+        CGA64::L_aarch64(kh_loop_end);
+
+        CGA64::add_imm(reg_src_d, reg_src_d,
+                (dim_t)(jcp.dilate_d + 1) * jcp.ih * src_row, reg_tmp_imm);
+        CGA64::add_imm(reg_filt_d, reg_filt_d,
+                (dim_t)jcp.kh * jcp.kw * filt_kw, reg_tmp_imm);
+        CGA64::sub_imm(reg_kd, reg_kd, 1, reg_tmp_imm);
+        CGA64::b(kd_loop_begin);
+    }
+
+    CGA64::L_aarch64(kd_loop_end);
+}
+
+void jit_sve_conv_fwd_kernel::store_tile(int ur) {
+    const int nb = jcp.nb_oc_blocking;
+    const auto &p = attr_.post_ops_;
+    const int sum_idx = p.find(primitive_kind::sum);
+
+    if (jcp.with_sum) {
+        // The weight registers are free after the accumulation and hold
+        // the values of dst to accumulate.
+        CGA64::mov_imm(reg_tmp, float2int(p.entry_[sum_idx].sum.scale));
+        CGA64::dup(zreg_sum_scale_s(), xa::WReg(reg_tmp.getIdx()));
+        for (int i = 0; i < ur; i++)
+            for (int j = 0; j < nb; j++) {
+                load_dst(zreg_wei_s(j), i, j);
+                CGA64::fmla(zreg_acc_s(i, j), reg_p_all_ones, zreg_wei_s(j),
+                        zreg_sum_scale_s());
+            }
+    }
+
+    if (jcp.with_eltwise) eltwise_injector_->compute_vector_range(0, ur * nb);
+
+    for (int i = 0; i < ur; i++)
+        for (int j = 0; j < nb; j++)
+            store_dst(zreg_acc_s(i, j), i, j);
+}
+
+void jit_sve_conv_fwd_kernel::compute_tile(int ur) {
+    init_tile(ur);
+    tap_loops(ur);
+    store_tile(ur);
+}
+
+void jit_sve_conv_fwd_kernel::generate() {
+    assert(jcp.nb_oc_blocking <= max_nb_oc && jcp.ur_w <= max_ur_w
+            && jcp.ur_w * jcp.nb_oc_blocking <= 24);
+
+    const dim_t src_tile_stride = (dim_t)jcp.stride_w * jcp.ngroups * jcp.ic
+            * jcp.ur_w * typesize;
+    const dim_t dst_tile_stride
+            = (dim_t)jcp.ngroups * jcp.oc * jcp.ur_w * typesize;
+
+    preamble();
+
+    CGA64::ptrue(reg_p_all_ones.b);
+    if (jcp.oc_tail) {
+        CGA64::mov_imm(reg_tmp, jcp.oc_tail);
+        CGA64::mov_imm(reg_tmp_imm, 0);
+        CGA64::whilelt(reg_p_tail.s, reg_tmp_imm, reg_tmp);
+    }
+
+    CGA64::mov(reg_param, abi_param1_aarch64);
+    CGA64::ldr(reg_src, xa::ptr(reg_param, GET_OFF(src)));
+    CGA64::ldr(reg_filt, xa::ptr(reg_param, GET_OFF(filt)));
+    CGA64::ldr(reg_dst, xa::ptr(reg_param, GET_OFF(dst)));
+    CGA64::ldr(reg_owc, xa::ptr(reg_param, GET_OFF(ur_w)));
+
+    xa::LabelAArch64 ow_loop, ow_loop_tail, ow_loop_end;
+
+    CGA64::cmp_imm(reg_owc, jcp.ur_w, reg_tmp_imm);
+    CGA64::b(xa::LT, ow_loop_tail);
+
+    CGA64::L_aarch64(ow_loop);
+    {
+        compute_tile(jcp.ur_w);
+        CGA64::add_imm(reg_src, reg_src, src_tile_stride, reg_tmp_imm);
+        CGA64::add_imm(reg_dst, reg_dst, dst_tile_stride, reg_tmp_imm);
+        CGA64::sub_imm(reg_owc, reg_owc, jcp.ur_w, reg_tmp_imm);
+        CGA64::cmp_imm(reg_owc, jcp.ur_w, reg_tmp_imm);
+        CGA64::b(xa::GE, ow_loop);
+    }
+
+    // At most ur_w - 1 points are left, each remainder has its own tile.
+    CGA64::L_aarch64(ow_loop_tail);
+    for (int ur = jcp.ur_w - 1; ur > 0; ur--) {
+        xa::LabelAArch64 next_ur;
+        CGA64::cmp_imm(reg_owc, ur, reg_tmp_imm);
+        CGA64::b(xa::NE, next_ur);
+        compute_tile(ur);
+        CGA64::b(ow_loop_end);
+        CGA64::L_aarch64(next_ur);
+    }
+
+    CGA64::L_aarch64(ow_loop_end);
+    postamble();
+
+    if (jcp.with_eltwise) {
+        eltwise_injector_->prepare_table();
+        binCommit();
+    }
+}
+
+status_t jit_sve_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
+        const convolution_desc_t &cd, const memory_desc_t &src_md,
+        const memory_desc_t &weights_md, const memory_desc_t &dst_md,
+        const primitive_attr_t &attr, int nthreads) {
+    if (!mayiuse_sve_any_vl()) return status::unimplemented;
+
+    const memory_desc_wrapper src_d(src_md);
+    const memory_desc_wrapper weights_d(weights_md);
+    const memory_desc_wrapper dst_d(dst_md);
+
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    const int ndims = src_d.ndims();
+
+    jcp = zero<decltype(jcp)>();
+    jcp.prop_kind = cd.prop_kind;
+    jcp.ndims = ndims;
+    jcp.simd_w = get_sve_length() / sizeof(float);
+    jcp.nthr = nthreads;
+
+    jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
+    jcp.mb = src_d.dims()[0];
+    jcp.oc = dst_d.dims()[1] / jcp.ngroups;
+    jcp.ic = src_d.dims()[1] / jcp.ngroups;
+
+    // The missing spatial dimensions are of size 1, with no padding.
+    jcp.id = ndims == 5 ? src_d.dims()[2] : 1;
+    jcp.ih = ndims >= 4 ? src_d.dims()[ndims - 2] : 1;
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.od = ndims == 5 ? dst_d.dims()[2] : 1;
+    jcp.oh = ndims >= 4 ? dst_d.dims()[ndims - 2] : 1;
+    jcp.ow = dst_d.dims()[ndims - 1];
+    jcp.kd = ndims == 5 ? weights_d.dims()[with_groups + 2] : 1;
+    jcp.kh = ndims >= 4 ? weights_d.dims()[with_groups + ndims - 2] : 1;
+    jcp.kw = weights_d.dims()[with_groups + ndims - 1];
+
+    jcp.f_pad = ndims == 5 ? cd.padding[0][0] : 0;
+    jcp.t_pad = ndims >= 4 ? cd.padding[0][ndims - 4] : 0;
+    jcp.l_pad = cd.padding[0][ndims - 3];
+    jcp.stride_d = ndims == 5 ? cd.strides[0] : 1;
+    jcp.stride_h = ndims >= 4 ? cd.strides[ndims - 4] : 1;
+    jcp.stride_w = cd.strides[ndims - 3];
+    jcp.dilate_d = ndims == 5 ? cd.dilates[0] : 0;
+    jcp.dilate_h = ndims >= 4 ? cd.dilates[ndims - 4] : 0;
+    jcp.dilate_w = cd.dilates[ndims - 3];
+
+    jcp.with_bias = cd.bias_desc.ndims != 0;
+
+    const auto dat_tag = pick(ndims - 3, nwc, nhwc, ndhwc);
+    const auto wei_tag = with_groups ? pick(ndims - 3, wigo, hwigo, dhwigo)
+                                     : pick(ndims - 3, wio, hwio, dhwio);
+    if (!src_d.matches_tag(dat_tag) || !dst_d.matches_tag(dat_tag)
+            || !weights_d.matches_tag(wei_tag))
+        return status::unimplemented;
+    jcp.src_tag = jcp.dst_tag = dat_tag;
+    jcp.wei_tag = wei_tag;
+
+    /* Post-ops: sum, eltwise or sum -> eltwise */
+    const auto &p = attr.post_ops_;
+    const int sum_ind = p.find(primitive_kind::sum);
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    bool post_ops_ok = false;
+    switch (p.len()) {
+        case 0: post_ops_ok = true; break;
+        case 1: post_ops_ok = sum_ind == 0 || eltwise_ind == 0; break;
+        case 2: post_ops_ok = sum_ind == 0 && eltwise_ind == 1; break;
+        default: break;
+    }
+    if (!post_ops_ok) return status::unimplemented;
+    jcp.with_sum = sum_ind != -1;
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) {
+        jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+        // The injector is loaded without the table address.
+        if (!jit_uni_eltwise_injector_f32<avx512_common>::is_vl_agnostic(
+                    jcp.eltwise.alg))
+            return status::unimplemented;
+    }
+
+    /* Blocking: the output channels of a group are split into vectors, a
+     * kernel call takes up to max_nb_oc of them. */
+    jcp.nb_oc = div_up(jcp.oc, jcp.simd_w);
+    jcp.nb_oc_blocking = nstl::min((int)max_nb_oc, jcp.nb_oc);
+    jcp.oc_tail = 0;
+    jcp.ur_w = nstl::min((int)max_ur_w, 24 / jcp.nb_oc_blocking);
+
+    return status::success;
+}
+
+jit_conv_conf_t jit_sve_conv_fwd_kernel::tail_conf(const jit_conv_conf_t &jcp) {
+    jit_conv_conf_t tail_jcp = jcp;
+    tail_jcp.nb_oc_blocking = jcp.nb_oc
+            - (div_up(jcp.nb_oc, jcp.nb_oc_blocking) - 1) * jcp.nb_oc_blocking;
+    tail_jcp.oc_tail = jcp.oc % jcp.simd_w;
+    return tail_jcp;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
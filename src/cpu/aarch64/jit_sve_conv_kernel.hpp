@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_CONV_KERNEL_HPP
+#define CPU_AARCH64_JIT_SVE_CONV_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+#include "cpu/aarch64/jit_uni_eltwise_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Direct f32 forward convolution for the nxc activations and the weights
+// with the output channels innermost ([kd][kh][kw][ic][g][oc]), for any SVE
+// vector length. A call computes p.ur_w consecutive output points of a row
+// for jcp.nb_oc_blocking vectors of output channels, in tiles of jcp.ur_w
+// points.
+//
+// The taps are loops with runtime counts: p.src and p.filt point to the
+// first valid tap and p.kd_padding, p.kh_padding and p.kw_padding are the
+// numbers of valid taps. Since the valid kw taps are only the same for all
+// the points of a call away from the left and right paddings, the driver
+// calls the kernel for one point at a time near them.
+struct jit_sve_conv_fwd_kernel : public jit_generator {
+    jit_sve_conv_fwd_kernel(
+            const jit_conv_conf_t &ajcp, const primitive_attr_t &attr)
+        : jit_generator(nullptr, 256 * 1024)
+        , jcp(ajcp)
+        , attr_(attr)
+        , eltwise_injector_(nullptr) {
+        if (jcp.with_eltwise)
+            // The auxiliary vectors are free after the accumulation, so
+            // there is no state to save.
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise, false);
+        generate();
+        jit_ker = (void (*)(jit_conv_call_s *))getCode32();
+    }
+
+    ~jit_sve_conv_fwd_kernel() { delete eltwise_injector_; }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_conv_fwd_kernel)
+
+    static status_t init_conf(jit_conv_conf_t &jcp,
+            const convolution_desc_t &cd, const memory_desc_t &src_md,
+            const memory_desc_t &weights_md, const memory_desc_t &dst_md,
+            const primitive_attr_t &attr, int nthreads);
+
+    // Configuration of the kernel processing the last group of output
+    // channel vectors, which may be shorter and end with a partial vector.
+    static jit_conv_conf_t tail_conf(const jit_conv_conf_t &jcp);
+
+    void operator()(jit_conv_call_s *p) const { jit_ker(p); }
+
+    jit_conv_conf_t jcp;
+    const primitive_attr_t &attr_;
+    void (*jit_ker)(jit_conv_call_s *);
+
+private:
+    using reg64_t = const xa::XReg;
+
+    enum {
+        typesize = sizeof(float),
+        max_ur_w = 6,
+        max_nb_oc = 4,
+        unroll_ic = 4,
+        n_src_regs = 3,
+    };
+
+    const xa::PReg reg_p_all_ones = p2;
+    const xa::PReg reg_p_tail = p3;
+
+    /* x0 (p_table of the eltwise injector) and x4 (stack of the translated
+     * code) are not used, the call parameters are kept in reg_param. The tap
+     * counters are x23..x26, which the injector may clobber, so they are
+     * only live before it is called. */
+    reg64_t reg_src = x1;
+    reg64_t reg_filt = x2;
+    reg64_t reg_dst = x3;
+    reg64_t reg_owc = x5;
+    reg64_t reg_param = x7;
+    reg64_t reg_src_pt[max_ur_w] = {x8, x9, x10, x11, x12, x13};
+    reg64_t reg_filt_ic = x14;
+    reg64_t reg_src_w = x15;
+    reg64_t reg_filt_w = x16;
+    reg64_t reg_src_h = x17;
+    reg64_t reg_filt_h = x18;
+    reg64_t reg_tmp = x19;
+    reg64_t reg_tmp_imm = x20;
+    reg64_t reg_src_d = x21;
+    reg64_t reg_filt_d = x22;
+    reg64_t reg_kd = x23;
+    reg64_t reg_kh = x24;
+    reg64_t reg_kw = x25;
+    reg64_t reg_ic = x26;
+
+    /* Accumulators z0..z23 are numbered point-major, so the eltwise injector
+     * can process a tile as a single range. */
+    xa::ZRegS zreg_acc_s(int i, int j) const {
+        return xa::ZRegS(i * jcp.nb_oc_blocking + j);
+    }
+    xa::ZRegS zreg_wei_s(int j) const { return xa::ZRegS(24 + j); }
+    xa::ZRegS zreg_src_s(int i) const { return xa::ZRegS(28 + i % n_src_regs); }
+    xa::ZRegS zreg_sum_scale_s() const { return xa::ZRegS(31); }
+
+    bool is_tail_block(int j) const {
+        return jcp.oc_tail != 0 && j == jcp.nb_oc_blocking - 1;
+    }
+    xa::PReg block_pred(int j) const {
+        return is_tail_block(j) ? reg_p_tail : reg_p_all_ones;
+    }
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+
+    void load_dst(const xa::ZRegS &z, int i, int j);
+    void store_dst(const xa::ZRegS &z, int i, int j);
+    void init_tile(int ur);
+    void fma_step(int ur, int uk);
+    void ic_loop(int ur);
+    void kw_loop(int ur);
+    void tap_loops(int ur);
+    void store_tile(int ur);
+    void compute_tile(int ur);
+    void generate();
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,144 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_sve_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+
+namespace {
+// Range of the taps k of a kernel of size ks for which the input coordinate
+// i0 + k * (dilate + 1) falls into [0, is).
+void valid_taps(int i0, int ks, int dilate, int is, int &k_s, int &k_e) {
+    k_s = i0 < 0 ? div_up(-i0, dilate + 1) : 0;
+    k_e = i0 < is ? nstl::min(ks, div_up(is - i0, dilate + 1)) : 0;
+    k_e = nstl::max(k_s, k_e);
+}
+} // namespace
+
+void jit_sve_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    src += src_d.offset0();
+    weights += weights_d.offset0();
+    dst += dst_d.offset0();
+
+    const auto &jcp = pd()->jcp_;
+    const int simd_w = jcp.simd_w;
+    const int oc_groups = div_up(jcp.nb_oc, jcp.nb_oc_blocking);
+
+    // nxc activations and [kd][kh][kw][ic][g][oc] weights
+    const dim_t src_c = (dim_t)jcp.ngroups * jcp.ic;
+    const dim_t dst_c = (dim_t)jcp.ngroups * jcp.oc;
+    const dim_t wei_ic = (dim_t)jcp.ngroups * jcp.oc;
+
+    // The output points whose taps are all in the row, which a single call
+    // can process, are [ow_s, ow_e).
+    const int ext_kw = calculate_extended_filter_size(jcp.kw, jcp.dilate_w);
+    const int ow_s = nstl::min(jcp.ow, div_up(jcp.l_pad, jcp.stride_w));
+    const int ow_e_num = jcp.iw - ext_kw + jcp.l_pad;
+    const int ow_e = ow_e_num < 0
+            ? ow_s
+            : nstl::max(ow_s, nstl::min(jcp.ow, ow_e_num / jcp.stride_w + 1));
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        size_t start {0}, end {0};
+        const size_t work_amount = (size_t)jcp.mb * jcp.ngroups * oc_groups
+                * jcp.od * jcp.oh;
+        balance211(work_amount, nthr, ithr, start, end);
+
+        // The output rows are innermost, so consecutive calls of a thread
+        // reuse the same weights.
+        int n {0}, g {0}, ocg {0}, od {0}, oh {0};
+        nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ocg, oc_groups, od,
+                jcp.od, oh, jcp.oh);
+
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const auto *kernel = ocg == oc_groups - 1 ? kernel_tail_.get()
+                                                      : kernel_.get();
+            const int oc_off = g * jcp.oc + ocg * jcp.nb_oc_blocking * simd_w;
+
+            const int id0 = od * jcp.stride_d - jcp.f_pad;
+            const int ih0 = oh * jcp.stride_h - jcp.t_pad;
+            int kd_s, kd_e, kh_s, kh_e;
+            valid_taps(id0, jcp.kd, jcp.dilate_d, jcp.id, kd_s, kd_e);
+            valid_taps(ih0, jcp.kh, jcp.dilate_h, jcp.ih, kh_s, kh_e);
+            const int id = id0 + kd_s * (jcp.dilate_d + 1);
+            const int ih = ih0 + kh_s * (jcp.dilate_h + 1);
+
+            auto call = [&](int ow, int ow_count, int kw_s, int kw_e) {
+                const int iw = ow * jcp.stride_w - jcp.l_pad
+                        + kw_s * (jcp.dilate_w + 1);
+                const dim_t src_pt
+                        = (((dim_t)n * jcp.id + id) * jcp.ih + ih) * jcp.iw
+                        + iw;
+                const dim_t dst_pt
+                        = (((dim_t)n * jcp.od + od) * jcp.oh + oh) * jcp.ow
+                        + ow;
+                const dim_t tap = ((dim_t)kd_s * jcp.kh + kh_s) * jcp.kw + kw_s;
+
+                jit_conv_call_s p;
+                p.src = src + src_pt * src_c + g * jcp.ic;
+                p.dst = dst + dst_pt * dst_c + oc_off;
+                p.filt = weights + tap * jcp.ic * wei_ic + oc_off;
+                p.bias = bias ? bias + oc_off : nullptr;
+                p.kd_padding = kd_e - kd_s;
+                p.kh_padding = kh_e - kh_s;
+                p.kw_padding = kw_e - kw_s;
+                p.ur_w = ow_count;
+                (*kernel)(&p);
+            };
+
+            // The points near the paddings have their own kw taps.
+            auto call_point = [&](int ow) {
+                int kw_s, kw_e;
+                valid_taps(ow * jcp.stride_w - jcp.l_pad, jcp.kw, jcp.dilate_w,
+                        jcp.iw, kw_s, kw_e);
+                call(ow, 1, kw_s, kw_e);
+            };
+
+            for (int ow = 0; ow < ow_s; ow++)
+                call_point(ow);
+            if (ow_e > ow_s) call(ow_s, ow_e - ow_s, 0, jcp.kw);
+            for (int ow = ow_e; ow < jcp.ow; ow++)
+                call_point(ow);
+
+            nd_iterator_step(n, jcp.mb, g, jcp.ngroups, ocg, oc_groups, od,
+                    jcp.od, oh, jcp.oh);
+        }
+    });
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_SVE_CONVOLUTION_HPP
+#define CPU_AARCH64_JIT_SVE_CONVOLUTION_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/aarch64/jit_sve_conv_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// f32 forward convolution for any SVE vector length, on the nxc activations.
+// The last group of output channel vectors of a group of the convolution is
+// handled by a separate kernel with the channel tail.
+struct jit_sve_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", sve, ""),
+                jit_sve_convolution_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+
+            const bool with_groups = weights_md_.ndims == src_md_.ndims + 1;
+            const int sp_ndims = ndims() - 3;
+            const auto dat_tag = utils::pick(sp_ndims, nwc, nhwc, ndhwc);
+            const auto wei_tag = with_groups
+                    ? utils::pick(sp_ndims, wigo, hwigo, dhwigo)
+                    : utils::pick(sp_ndims, wio, hwio, dhwio);
+
+            bool ok = true && is_fwd()
+                    && set_default_alg_kind(alg_kind::convolution_direct)
+                    && expect_data_types(f32, f32, f32, f32, f32)
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops, f32)
+                    && !has_zero_dim_memory()
+                    && set_default_formats_common(dat_tag, wei_tag, dat_tag);
+            if (!ok) return status::unimplemented;
+
+            return jit_sve_conv_fwd_kernel::init_conf(jcp_, *desc(), src_md_,
+                    weights_md_, dst_md_, *attr(), dnnl_get_max_threads());
+        }
+
+        jit_conv_conf_t jcp_;
+    };
+
+    jit_sve_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {
+        const auto &jcp = pd()->jcp_;
+        if (jcp.nb_oc > jcp.nb_oc_blocking)
+            kernel_.reset(new jit_sve_conv_fwd_kernel(jcp, *pd()->attr()));
+        kernel_tail_.reset(new jit_sve_conv_fwd_kernel(
+                jit_sve_conv_fwd_kernel::tail_conf(jcp), *pd()->attr()));
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_sve_conv_fwd_kernel> kernel_;
+    std::unique_ptr<jit_sve_conv_fwd_kernel> kernel_tail_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,271 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_uni_eltwise_injector.hpp"
+
+#include "cpu/aarch64/jit_sve_eltwise.hpp"
+
+#define GET_OFF(field) \
+    static_cast<int32_t>(offsetof(jit_sve_eltwise_call_s, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_sve_eltwise_call_s {
+    const float *src; // fwd: src;  bwd: src/dst based on alg;
+    float *dst; // fwd: dst;  bwd: diff_src;
+    const float *diff_dst; // fwd: nullptr;  bwd: diff_dst;
+    size_t work_amount;
+};
+
+namespace {
+// Below this number of elements a thread costs more than it saves.
+constexpr dim_t min_elems_per_thr = 4096;
+
+using eltwise_injector_t = jit_uni_eltwise_injector_f32<avx512_common>;
+} // namespace
+
+// The vector length is read when the code is generated, the elements past
+// the last full vector are processed under a whilelt predicate.
+struct jit_sve_eltwise_kernel : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_eltwise_kernel)
+
+    jit_sve_eltwise_kernel(const eltwise_pd_t *pd)
+        : jit_generator()
+        , is_fwd_(pd->is_fwd())
+        , simd_w_(get_sve_length() / sizeof(float)) {
+        const auto &desc = *pd->desc();
+        // The auxiliary vectors are free outside of the injector, so there
+        // is no state to save.
+        eltwise_injector_.reset(new eltwise_injector_t(this, desc.alg_kind,
+                desc.alpha, desc.beta, 1.f, false, Xbyak::util::rax,
+                Xbyak::Opmask(1), is_fwd_, pd->use_dst()));
+        generate();
+        jit_ker = (void (*)(const jit_sve_eltwise_call_s *))getCode32();
+    }
+
+    void operator()(const jit_sve_eltwise_call_s *p) const { jit_ker(p); }
+
+    int simd_w() const { return simd_w_; }
+
+private:
+    using reg64_t = const xa::XReg;
+
+    enum {
+        typesize = sizeof(float),
+        unroll = 4,
+    };
+
+    const bool is_fwd_;
+    const int simd_w_;
+
+    const xa::PReg reg_p_all_ones = p2;
+    const xa::PReg reg_p_tail = p3;
+
+    /* x0 (p_table of the eltwise injector) and x4 (stack of the translated
+     * code) are not used, the call parameters are kept in reg_param. */
+    reg64_t reg_src = x1;
+    reg64_t reg_dst = x2;
+    reg64_t reg_diff_dst = x3;
+    reg64_t reg_work = x5;
+    reg64_t reg_param = x7;
+    reg64_t reg_tmp = x19;
+    reg64_t reg_tmp_imm = x20;
+
+    std::unique_ptr<eltwise_injector_t> eltwise_injector_;
+    void (*jit_ker)(const jit_sve_eltwise_call_s *);
+
+    // Processes n vectors z0..z(n - 1), the diff_dst vectors are loaded into
+    // the registers following them once the injector is done.
+    void compute(int n, const xa::PReg &p) {
+        for (int i = 0; i < n; i++)
+            CGA64::ld1w(xa::ZRegS(i), p / xa::T_z,
+                    xa::ptr(reg_src, static_cast<int32_t>(i), xa::MUL_VL));
+
+        eltwise_injector_->compute_vector_range(0, n);
+
+        if (!is_fwd_)
+            for (int i = 0; i < n; i++) {
+                CGA64::ld1w(xa::ZRegS(n + i), p / xa::T_z,
+                        xa::ptr(reg_diff_dst, static_cast<int32_t>(i),
+                                xa::MUL_VL));
+                CGA64::fmul(xa::ZRegS(i), xa::ZRegS(i), xa::ZRegS(n + i));
+            }
+
+        for (int i = 0; i < n; i++)
+            CGA64::st1w(xa::ZRegS(i), p,
+                    xa::ptr(reg_dst, static_cast<int32_t>(i), xa::MUL_VL));
+    }
+
+    void advance(int n) {
+        const int vlen = simd_w_ * typesize;
+        CGA64::add_imm(reg_src, reg_src, n * vlen, reg_tmp_imm);
+        CGA64::add_imm(reg_dst, reg_dst, n * vlen, reg_tmp_imm);
+        if (!is_fwd_)
+            CGA64::add_imm(reg_diff_dst, reg_diff_dst, n * vlen, reg_tmp_imm);
+        CGA64::sub_imm(reg_work, reg_work, n * simd_w_, reg_tmp_imm);
+    }
+
+    void generate() {
+        preamble();
+
+        CGA64::ptrue(reg_p_all_ones.b);
+
+        CGA64::mov(reg_param, abi_param1_aarch64);
+        CGA64::ldr(reg_src, xa::ptr(reg_param, GET_OFF(src)));
+        CGA64::ldr(reg_dst, xa::ptr(reg_param, GET_OFF(dst)));
+        if (!is_fwd_)
+            CGA64::ldr(reg_diff_dst, xa::ptr(reg_param, GET_OFF(diff_dst)));
+        CGA64::ldr(reg_work, xa::ptr(reg_param, GET_OFF(work_amount)));
+
+        xa::LabelAArch64 unroll_loop, vec_loop, tail, end;
+
+        CGA64::L_aarch64(unroll_loop);
+        {
+            CGA64::cmp_imm(reg_work, unroll * simd_w_, reg_tmp_imm);
+            CGA64::b(xa::LT, vec_loop);
+            compute(unroll, reg_p_all_ones);
+            advance(unroll);
+            CGA64::b(unroll_loop);
+        }
+
+        CGA64::L_aarch64(vec_loop);
+        {
+            CGA64::cmp_imm(reg_work, simd_w_, reg_tmp_imm);
+            CGA64::b(xa::LT, tail);
+            compute(1, reg_p_all_ones);
+            advance(1);
+            CGA64::b(vec_loop);
+        }
+
+        CGA64::L_aarch64(tail);
+        {
+            CGA64::cmp(reg_work, 0);
+            CGA64::b(xa::LE, end);
+            CGA64::mov_imm(reg_tmp, 0);
+            CGA64::whilelt(reg_p_tail.s, reg_tmp, reg_work);
+            compute(1, reg_p_tail);
+        }
+
+        CGA64::L_aarch64(end);
+        postamble();
+
+        eltwise_injector_->prepare_table();
+        binCommit();
+    }
+};
+
+namespace {
+void execute_kernel(const jit_sve_eltwise_kernel &kernel, dim_t nelems,
+        const float *src, float *dst, const float *diff_dst) {
+    const int simd_w = kernel.simd_w();
+    const int work_nthr = (int)nstl::min<dim_t>(
+            dnnl_get_max_threads(), utils::div_up(nelems, min_elems_per_thr));
+
+    parallel(work_nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
+        start = nstl::min(nelems, start * simd_w);
+        end = nstl::min(nelems, end * simd_w);
+        if (start == end) return;
+
+        jit_sve_eltwise_call_s p;
+        p.src = src + start;
+        p.dst = dst + start;
+        p.diff_dst = diff_dst ? diff_dst + start : nullptr;
+        p.work_amount = end - start;
+        kernel(&p);
+    });
+}
+} // namespace
+
+status_t jit_sve_eltwise_fwd_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper data_d(src_md());
+
+    bool ok = mayiuse_sve_any_vl() && is_fwd()
+            && src_md()->data_type == data_type::f32 && !has_zero_dim_memory()
+            && data_d.is_dense(true)
+            // the padded elements are processed as well
+            && IMPLICATION(!data_d.is_dense(), is_zero_preserved())
+            && attr()->has_default_values()
+            && eltwise_injector_t::is_vl_agnostic(desc()->alg_kind, true);
+    return ok ? status::success : status::unimplemented;
+}
+
+jit_sve_eltwise_fwd_t::jit_sve_eltwise_fwd_t(const pd_t *apd)
+    : primitive_t(apd), kernel_(new jit_sve_eltwise_kernel(pd())) {}
+
+jit_sve_eltwise_fwd_t::~jit_sve_eltwise_fwd_t() = default;
+
+status_t jit_sve_eltwise_fwd_t::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    execute_kernel(*kernel_, data_d.nelems(true), src + data_d.offset0(),
+            dst + data_d.offset0(), nullptr);
+
+    return status::success;
+}
+
+status_t jit_sve_eltwise_bwd_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper data_d(src_md());
+
+    bool ok = mayiuse_sve_any_vl() && !is_fwd()
+            && utils::everyone_is(data_type::f32, src_md()->data_type,
+                    diff_src_md()->data_type)
+            && !has_zero_dim_memory() && set_default_formats_common()
+            && data_d.is_dense(true)
+            // the padded elements are processed as well
+            && IMPLICATION(!data_d.is_dense(), is_zero_preserved())
+            && data_d == memory_desc_wrapper(diff_dst_md())
+            && attr()->has_default_values()
+            && eltwise_injector_t::is_vl_agnostic(desc()->alg_kind, false);
+    return ok ? status::success : status::unimplemented;
+}
+
+jit_sve_eltwise_bwd_t::jit_sve_eltwise_bwd_t(const pd_t *apd)
+    : primitive_t(apd), kernel_(new jit_sve_eltwise_kernel(pd())) {}
+
+jit_sve_eltwise_bwd_t::~jit_sve_eltwise_bwd_t() = default;
+
+status_t jit_sve_eltwise_bwd_t::execute(const exec_ctx_t &ctx) const {
+    auto src = pd()->use_dst() ? CTX_IN_MEM(const float *, DNNL_ARG_DST)
+                               : CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    const memory_desc_wrapper diff_data_d(pd()->diff_src_md());
+    execute_kernel(*kernel_, data_d.nelems(true), src + data_d.offset0(),
+            diff_src + diff_data_d.offset0(),
+            diff_dst + diff_data_d.offset0());
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -219,8 +219,34 @@ void jit_uni_eltwise_injector_f32<isa>::injector_postamble() {
     using namespace Xbyak::util;
     if (!save_state_) return;
 
+#ifdef DNNL_X64_IMPLEMENTATION
     for (size_t i = 0; i < preserved_vecs_count; ++i)
         h->uni_vmovups(Vmm(preserved_vec_idxs[i]), h->ptr[h->rsp + i * vlen]);
+#else //#ifdef DNNL_X64_IMPLEMENTATION
+    /* Restored with the predicate they were stored with, so the vectors of
+       the native algorithms keep their vector length. */
+    xa::XReg x_sp {IDX(h->rsp)};
+    xa::XReg x_addr {h->xtDefaultAddrIdx};
+    size_t i = 0;
+
+    while (i < preserved_vecs_count) {
+        int count = 0;
+        int ii = i;
+        do {
+            CG::add_imm(x_tmp_vec[count++], x_sp, i * vlen, x_addr);
+            i++;
+        } while (i < preserved_vecs_count && count < x_tmp_vec_size);
+
+        if (vlen != 32)
+            for (int j = 0; j < count; j++)
+                CG::ld1w(xa::ZRegS(preserved_vec_idxs[ii++]), p_lsb / xa::T_z,
+                        xa::ptr(x_tmp_vec[j]));
+        else
+            for (int j = 0; j < count; j++)
+                CG::ldr(xa::QReg(preserved_vec_idxs[ii++]),
+                        xa::ptr(x_tmp_vec[j]));
+    }
+#endif //#ifdef DNNL_X64_IMPLEMENTATION
 
     if (preserved_vecs_count) h->add(h->rsp, preserved_vecs_count * vlen);
 
@@ -1503,11 +1529,460 @@ size_t jit_uni_eltwise_injector_f32<isa>::aux_vecs_count() {
     return 0;
 }
 
+#ifndef DNNL_X64_IMPLEMENTATION
+template <cpu_isa_t isa>
+bool jit_uni_eltwise_injector_f32<isa>::is_native_alg(
+        alg_kind_t alg, bool is_fwd) {
+    using namespace alg_kind;
+    const bool common = utils::one_of(alg, eltwise_relu_use_dst_for_bwd,
+            eltwise_relu, eltwise_elu_use_dst_for_bwd, eltwise_elu,
+            eltwise_square, eltwise_abs, eltwise_sqrt_use_dst_for_bwd,
+            eltwise_sqrt, eltwise_linear, eltwise_bounded_relu, eltwise_clip,
+            eltwise_logistic_use_dst_for_bwd, eltwise_logistic,
+            eltwise_exp_use_dst_for_bwd, eltwise_exp);
+    if (is_fwd)
+        return common || utils::one_of(alg, eltwise_swish, eltwise_round);
+    return common;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::native_dup(
+        const xa::ZRegS &z, key_t key, size_t key_off_val_shift) {
+    auto it = entry_map_.lower_bound(key);
+    for (size_t i = 0; i < key_off_val_shift; i++)
+        it++;
+    assert(it != entry_map_.end() && (*it).first == key);
+    const table_entry_val_t val = (*it).second.val;
+
+    if (val == 0) {
+        CG::fmov(z); // zero clear
+    } else {
+        CG::mov_imm(h->X_TMP_0, val);
+        CG::dup(z, h->W_TMP_0);
+    }
+}
+
+// The native implementations below follow the x64 ones, with the same
+// auxiliary vector registers, so aux_vecs_count() holds for both. z_tmp is
+// free to use as it is only needed for the memory operands in the translated
+// code.
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::exp_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::ZRegS z_aux1 {IDX(vmm_aux1)};
+    const xa::ZRegS z_aux2 {IDX(vmm_aux2)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+
+    // get mask of values lower than log(FLT_MIN) to zero them in the output
+    native_dup(z_tmp.s, exp_ln_flt_min_f);
+    CG::fcmlt(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+
+    CG::fmaxnm(z_src, p_lsb / xa::T_m, z_tmp.s);
+    native_dup(z_tmp.s, exp_ln_flt_max_f);
+    CG::fminnm(z_src, p_lsb / xa::T_m, z_tmp.s);
+    CG::mov(xa::ZRegD(IDX(vmm_aux1)), xa::ZRegD(IDX(vmm_src)));
+
+    // fx = x * log2ef + 0.5
+    native_dup(z_tmp.s, exp_log2ef);
+    CG::fmul(z_src, z_src, z_tmp.s);
+    native_dup(z_tmp.s, half);
+    CG::fadd(z_src, z_src, z_tmp.s);
+
+    // tmp = floorf(fx)
+    CG::frintm(z_aux2, p_lsb / xa::T_m, z_src);
+
+    // x = x - fx * ln2
+    native_dup(z_tmp.s, ln2f);
+    CG::fmls(z_aux1, p_lsb / xa::T_m, z_aux2, z_tmp.s);
+
+    // compute 2^n, zero at the points which were < log(FLT_MIN)
+    CG::fcvtzs(z_aux2, p_lsb / xa::T_m, z_aux2);
+    native_dup(z_tmp.s, exponent_bias);
+    CG::add(z_aux2, z_aux2, z_tmp.s);
+    CG::lsl(z_aux2, z_aux2, n_mantissa_bits);
+    CG::fmov(z_tmp.s); // zero clear
+    CG::sel(z_aux2, p_mask, z_tmp.s, z_aux2);
+
+    // compute polynomial
+    native_dup(z_src, exp_pol, 4);
+    for (int i = 3; i >= 0; i--) {
+        native_dup(z_tmp.s, exp_pol, i);
+        CG::fmad(z_src, p_lsb / xa::T_m, z_aux1, z_tmp.s);
+    }
+    native_dup(z_tmp.s, one);
+    CG::fmad(z_src, p_lsb / xa::T_m, z_aux1, z_tmp.s);
+    // y = y * 2^n
+    CG::fmul(z_src, z_src, z_aux2);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::relu_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+
+    // multiply by alpha only the values <= 0
+    CG::fmov(z_tmp.s); // zero clear
+    CG::fcmle(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+    native_dup(z_tmp.s, alpha);
+    CG::fmul(z_src, xa::PReg(IDX(k_mask)) / xa::T_m, z_tmp.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::relu_zero_ns_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    CG::fmov(z_tmp.s); // zero clear
+    CG::fmaxnm(z_src, p_lsb / xa::T_m, z_tmp.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::elu_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::ZRegS z_aux3 {IDX(vmm_aux3)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+
+    // IMPORTANT: we use vmm_aux3 for the mask as exp_compute does not use it.
+    CG::mov(xa::ZRegD(IDX(vmm_aux3)), xa::ZRegD(IDX(vmm_src)));
+    exp_compute_vector_fwd_native(vmm_src);
+
+    // alpha * (exp(x) - 1)
+    native_dup(z_tmp.s, one);
+    CG::fsub(z_src, z_src, z_tmp.s);
+    native_dup(z_tmp.s, alpha);
+    CG::fmul(z_src, z_src, z_tmp.s);
+
+    // combine with mask
+    CG::fmov(z_tmp.s); // zero clear
+    CG::fcmgt(p_mask, p_lsb / xa::T_z, z_aux3, z_tmp.s);
+    CG::sel(z_src, p_mask, z_aux3, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::square_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    CG::fmul(z_src, z_src, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::abs_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    CG::fabs(z_src, p_lsb / xa::T_m, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::sqrt_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    CG::fsqrt(z_src, p_lsb / xa::T_m, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::linear_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::ZRegS z_aux0 {IDX(vmm_aux0)};
+
+    // compute x = alpha * x + beta;
+    native_dup(z_tmp.s, alpha);
+    native_dup(z_aux0, beta);
+    CG::fmad(z_src, p_lsb / xa::T_m, z_tmp.s, z_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::bounded_relu_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    CG::fmov(z_tmp.s); // zero clear
+    CG::fmaxnm(z_src, p_lsb / xa::T_m, z_tmp.s);
+    native_dup(z_tmp.s, alpha);
+    CG::fminnm(z_src, p_lsb / xa::T_m, z_tmp.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::clip_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    native_dup(z_tmp.s, alpha);
+    CG::fmaxnm(z_src, p_lsb / xa::T_m, z_tmp.s);
+    native_dup(z_tmp.s, beta);
+    CG::fminnm(z_src, p_lsb / xa::T_m, z_tmp.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::logistic_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::ZRegS z_aux1 {IDX(vmm_aux1)};
+    const xa::ZRegS z_aux2 {IDX(vmm_aux2)};
+    const xa::ZRegS z_aux3 {IDX(vmm_aux3)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+
+    // See logistic_compute_vector_fwd() for the details, we store the
+    // original sign and make x negative.
+    native_dup(z_tmp.s, sign_mask);
+    CG::and_(xa::ZRegD(IDX(vmm_aux3)), xa::ZRegD(IDX(vmm_src)), z_tmp.d);
+    CG::orr(xa::ZRegD(IDX(vmm_src)), xa::ZRegD(IDX(vmm_src)), z_tmp.d);
+
+    exp_compute_vector_fwd_native(vmm_src);
+    // y = exp(x) / (exp(x) + 1)
+    native_dup(z_tmp.s, one);
+    CG::fadd(z_aux1, z_src, z_tmp.s);
+    CG::fdiv(z_src, p_lsb / xa::T_m, z_aux1);
+
+    // Now we have to apply the "symmetry" based on original sign
+    CG::fsub(z_aux2, z_tmp.s, z_src);
+    CG::cmpne(p_mask, p_lsb / xa::T_z, z_aux3, 0);
+    CG::sel(z_src, p_mask, z_src, z_aux2);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::swish_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::ZRegS z_aux0 {IDX(vmm_aux0)};
+
+    // Unlike the translated code, the source is kept in vmm_aux0 which is
+    // not used by the native logistic, so no stack access is needed.
+    CG::mov(xa::ZRegD(IDX(vmm_aux0)), xa::ZRegD(IDX(vmm_src)));
+    // x*alpha
+    native_dup(z_tmp.s, alpha);
+    CG::fmul(z_src, z_src, z_tmp.s);
+    // sigmoid(x*alpha)
+    logistic_compute_vector_fwd_native(vmm_src);
+    // x*sigmoid(alpha*x)
+    CG::fmul(z_src, z_src, z_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::round_compute_vector_fwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    // uses the current rounding mode as _op_mxcsr does
+    CG::frinti(z_src, p_lsb / xa::T_m, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::exp_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    if (!use_dst_) exp_compute_vector_fwd_native(vmm_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::relu_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+
+    // get mask of `s` > 0, fill with alpha, then blend with 1.f
+    CG::fmov(z_tmp.s); // zero clear
+    CG::fcmgt(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+    native_dup(z_src, alpha);
+    native_dup(z_tmp.s, one);
+    CG::sel(z_src, p_mask, z_tmp.s, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::elu_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+
+    if (!use_dst_) {
+        // R = exp(s), get mask by comparing with exp(0)=1.f, not 0.f
+        exp_compute_vector_fwd_native(vmm_src);
+        native_dup(z_tmp.s, one);
+        CG::fcmgt(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+        // R * alpha, then blend with 1.f
+        native_dup(z_tmp.s, alpha);
+        CG::fmul(z_src, z_src, z_tmp.s);
+    } else {
+        // get mask of `d` > 0
+        CG::fmov(z_tmp.s); // zero clear
+        CG::fcmgt(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+        // R = `d` + alpha, then blend with 1.f
+        native_dup(z_tmp.s, alpha);
+        CG::fadd(z_src, z_src, z_tmp.s);
+    }
+    native_dup(z_tmp.s, one);
+    CG::sel(z_src, p_mask, z_tmp.s, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::square_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    // res = 2 * s
+    CG::fadd(z_src, z_src, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::abs_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+    const xa::PRegS p_neg {IDX(p_tmp0)};
+
+    // replace positive values with 1.f and negative values with -1.f
+    CG::fmov(z_tmp.s); // zero clear
+    CG::fcmgt(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+    CG::fcmlt(p_neg, p_lsb / xa::T_z, z_src, z_tmp.s);
+    native_dup(z_tmp.s, one);
+    CG::sel(z_src, p_mask, z_tmp.s, z_src);
+    native_dup(z_tmp.s, minus_one);
+    CG::sel(z_src, p_neg, z_tmp.s, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::sqrt_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    // res = 0.5 / d = 0.5 / sqrt(s)
+    if (!use_dst_) sqrt_compute_vector_fwd_native(vmm_src);
+    native_dup(z_tmp.s, half);
+    CG::fdivr(z_src, p_lsb / xa::T_m, z_tmp.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::linear_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    native_dup(xa::ZRegS(IDX(vmm_src)), alpha);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::bounded_relu_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+
+    // 1.f for 0.f < s <= alpha, 0.f otherwise
+    CG::fmov(z_tmp.s); // zero clear
+    CG::fcmgt(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+    native_dup(z_tmp.s, alpha);
+    CG::fcmle(p_mask, xa::PReg(IDX(k_mask)) / xa::T_z, z_src, z_tmp.s);
+    CG::fmov(z_src); // zero clear
+    native_dup(z_tmp.s, one);
+    CG::sel(z_src, p_mask, z_tmp.s, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::clip_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    const xa::PRegS p_mask {IDX(k_mask)};
+    const xa::PRegS p_le {IDX(p_tmp0)};
+
+    // 0.f for s > beta or s <= alpha, 1.f otherwise
+    native_dup(z_tmp.s, beta);
+    CG::fcmgt(p_mask, p_lsb / xa::T_z, z_src, z_tmp.s);
+    native_dup(z_tmp.s, alpha);
+    CG::fcmle(p_le, p_lsb / xa::T_z, z_src, z_tmp.s);
+    native_dup(z_src, one);
+    CG::fmov(z_tmp.s); // zero clear
+    CG::sel(z_src, p_mask, z_tmp.s, z_src);
+    CG::sel(z_src, p_le, z_tmp.s, z_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::logistic_compute_vector_bwd_native(
+        const Vmm &vmm_src) {
+    const xa::ZRegS z_src {IDX(vmm_src)};
+    // res = d * (1 - d) = d - d * d; d = logistic(s)
+    if (!use_dst_) logistic_compute_vector_fwd_native(vmm_src);
+    native_dup(z_tmp.s, one);
+    CG::fsub(z_tmp.s, z_tmp.s, z_src);
+    CG::fmul(z_src, z_src, z_tmp.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::compute_vector_native(
+        const Vmm &vmm_src) {
+    using namespace alg_kind;
+    if (is_fwd_) {
+        switch (alg_) {
+            case eltwise_relu_use_dst_for_bwd:
+            case eltwise_relu:
+                if (alpha_ == 0.f)
+                    relu_zero_ns_compute_vector_fwd_native(vmm_src);
+                else
+                    relu_compute_vector_fwd_native(vmm_src);
+                break;
+            case eltwise_elu_use_dst_for_bwd:
+            case eltwise_elu: elu_compute_vector_fwd_native(vmm_src); break;
+            case eltwise_square:
+                square_compute_vector_fwd_native(vmm_src);
+                break;
+            case eltwise_abs: abs_compute_vector_fwd_native(vmm_src); break;
+            case eltwise_sqrt_use_dst_for_bwd:
+            case eltwise_sqrt: sqrt_compute_vector_fwd_native(vmm_src); break;
+            case eltwise_swish: swish_compute_vector_fwd_native(vmm_src); break;
+            case eltwise_linear:
+                linear_compute_vector_fwd_native(vmm_src);
+                break;
+            case eltwise_bounded_relu:
+                bounded_relu_compute_vector_fwd_native(vmm_src);
+                break;
+            case eltwise_logistic_use_dst_for_bwd:
+            case eltwise_logistic:
+                logistic_compute_vector_fwd_native(vmm_src);
+                break;
+            case eltwise_exp_use_dst_for_bwd:
+            case eltwise_exp: exp_compute_vector_fwd_native(vmm_src); break;
+            case eltwise_clip: clip_compute_vector_fwd_native(vmm_src); break;
+            case eltwise_round: round_compute_vector_fwd_native(vmm_src); break;
+            default: assert(!"unsupported eltwise algorithm");
+        }
+    } else {
+        switch (alg_) {
+            case eltwise_relu_use_dst_for_bwd:
+            case eltwise_relu: relu_compute_vector_bwd_native(vmm_src); break;
+            case eltwise_elu_use_dst_for_bwd:
+            case eltwise_elu: elu_compute_vector_bwd_native(vmm_src); break;
+            case eltwise_square:
+                square_compute_vector_bwd_native(vmm_src);
+                break;
+            case eltwise_abs: abs_compute_vector_bwd_native(vmm_src); break;
+            case eltwise_sqrt_use_dst_for_bwd:
+            case eltwise_sqrt: sqrt_compute_vector_bwd_native(vmm_src); break;
+            case eltwise_linear:
+                linear_compute_vector_bwd_native(vmm_src);
+                break;
+            case eltwise_bounded_relu:
+                bounded_relu_compute_vector_bwd_native(vmm_src);
+                break;
+            case eltwise_logistic_use_dst_for_bwd:
+            case eltwise_logistic:
+                logistic_compute_vector_bwd_native(vmm_src);
+                break;
+            case eltwise_exp_use_dst_for_bwd:
+            case eltwise_exp: exp_compute_vector_bwd_native(vmm_src); break;
+            case eltwise_clip: clip_compute_vector_bwd_native(vmm_src); break;
+            default: assert(!"unsupported eltwise algorithm");
+        }
+    }
+    if (scale_ != 1.f) {
+        const xa::ZRegS z_src {IDX(vmm_src)};
+        native_dup(z_tmp.s, scale);
+        CG::fmul(z_src, z_src, z_tmp.s);
+    }
+}
+#endif //#ifdef DNNL_X64_IMPLEMENTATION
+
 template <cpu_isa_t isa>
 void jit_uni_eltwise_injector_f32<isa>::compute_body(
         size_t start_idx, size_t end_idx) {
     using namespace alg_kind;
     for (size_t idx = start_idx; idx < end_idx; idx++) {
+#ifndef DNNL_X64_IMPLEMENTATION
+        if (native_) {
+            compute_vector_native(Vmm(idx));
+            continue;
+        }
+#endif //#ifdef DNNL_X64_IMPLEMENTATION
         if (is_fwd_) {
             switch (alg_) {
                 case eltwise_relu_use_dst_for_bwd:
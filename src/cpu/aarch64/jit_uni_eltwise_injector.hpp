@@ -64,7 +64,8 @@ struct jit_uni_eltwise_injector_f32 {
         , is_fwd_(is_fwd)
         , use_dst_(use_dst)
 #ifndef DNNL_X64_IMPLEMENTATION
-
+        , native_(has_avx512() && get_jit_native()
+                  && is_native_alg(alg, is_fwd))
 #endif // #ifndef DNNL_X64_IMPLEMENTATION
 
     {
@@ -95,6 +96,17 @@ struct jit_uni_eltwise_injector_f32 {
     void prepare_table(bool gen_table = true);
     void load_table_addr() { h->mov(p_table, l_table); }
 
+#ifndef DNNL_X64_IMPLEMENTATION
+    /* The native algorithms work on whole SVE registers and take the
+       constants from general purpose registers, so they are correct with any
+       vector length up to the 64 bytes the preserved vectors take on the
+       stack. The translated ones require 512-bit vectors. */
+    static bool is_vl_agnostic(alg_kind_t alg, bool is_fwd = true) {
+        return has_avx512() && get_jit_native() && is_native_alg(alg, is_fwd)
+                && get_sve_length() <= (int)vlen;
+    }
+#endif //#ifdef DNNL_X64_IMPLEMENTATION
+
 private:
     const alg_kind_t alg_;
     const float alpha_;
@@ -176,6 +188,14 @@ private:
     //  const std::vector<xa::ZReg> z_tmp_vec = {
     //    z_tmp0, z_tmp1, z_tmp2, z_tmp3, z_tmp4, z_tmp5, z_tmp6, z_tmp7};
     //  constexpr static int z_tmp_vec_size = 8;
+
+    /* When true, the algorithm is generated with SVE instructions directly
+       instead of translating x64's implementation. Constants are
+       materialized with mov_imm + dup, so the table is not accessed.
+       Controlled by DNNL_JIT_NATIVE, the algorithms without a native
+       implementation are always translated. */
+    const bool native_;
+    static bool is_native_alg(alg_kind_t alg, bool is_fwd);
 #endif //#ifdef DNNL_X64_IMPLEMENTATION
 
     size_t aux_vecs_count();
@@ -231,6 +251,33 @@ private:
 
 #ifndef DNNL_X64_IMPLEMENTATION
     void uni_ldr(const Vmm &vmm_dst, const Xbyak::Operand &addr);
+
+    void compute_vector_native(const Vmm &vmm_src);
+
+    void exp_compute_vector_fwd_native(const Vmm &vmm_src);
+    void relu_compute_vector_fwd_native(const Vmm &vmm_src);
+    void relu_zero_ns_compute_vector_fwd_native(const Vmm &vmm_src);
+    void elu_compute_vector_fwd_native(const Vmm &vmm_src);
+    void square_compute_vector_fwd_native(const Vmm &vmm_src);
+    void abs_compute_vector_fwd_native(const Vmm &vmm_src);
+    void sqrt_compute_vector_fwd_native(const Vmm &vmm_src);
+    void linear_compute_vector_fwd_native(const Vmm &vmm_src);
+    void bounded_relu_compute_vector_fwd_native(const Vmm &vmm_src);
+    void clip_compute_vector_fwd_native(const Vmm &vmm_src);
+    void logistic_compute_vector_fwd_native(const Vmm &vmm_src);
+    void swish_compute_vector_fwd_native(const Vmm &vmm_src);
+    void round_compute_vector_fwd_native(const Vmm &vmm_src);
+
+    void exp_compute_vector_bwd_native(const Vmm &vmm_src);
+    void relu_compute_vector_bwd_native(const Vmm &vmm_src);
+    void elu_compute_vector_bwd_native(const Vmm &vmm_src);
+    void square_compute_vector_bwd_native(const Vmm &vmm_src);
+    void abs_compute_vector_bwd_native(const Vmm &vmm_src);
+    void sqrt_compute_vector_bwd_native(const Vmm &vmm_src);
+    void linear_compute_vector_bwd_native(const Vmm &vmm_src);
+    void bounded_relu_compute_vector_bwd_native(const Vmm &vmm_src);
+    void clip_compute_vector_bwd_native(const Vmm &vmm_src);
+    void logistic_compute_vector_bwd_native(const Vmm &vmm_src);
 #endif //#ifdef DNNL_X64_IMPLEMENTATION
 
     enum key_t {
@@ -309,6 +356,10 @@ private:
                 z_tmp.s, p_lsb / xa::T_z, xa::ptr(x_addr));
         return Vmm(z_tmp.getIdx());
     }
+
+    // Broadcasts a table value to z without accessing the table.
+    void native_dup(
+            const xa::ZRegS &z, key_t key, size_t key_off_val_shift = 0);
 #endif //#ifdef DNNL_X64_IMPLEMENTATION
 
     // we accept only 32bit hexadecimal table values to avoid any rounding
@@ -0,0 +1,955 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_sve_512_core_bf16cvt.hpp"
+#include "cpu/aarch64/jit_uni_layer_normalization_kernels.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace lnorm_utils {
+
+using namespace dnnl::impl::cpu::lnorm_utils;
+using namespace dnnl::impl::cpu::aarch64;
+using namespace data_type;
+using namespace Xbyak;
+
+namespace {
+
+// Both data types are processed in 512-bit vectors, bf16 data is converted
+// to f32 on load. The tail of the normalized axis is processed with a masked
+// vector instead of element by element.
+constexpr int simd_w = 16;
+
+// Sums the elements of zmm_vec, the result is broadcast to all the lanes.
+void horizontal_add(
+        jit_generator &gen, const Zmm &zmm_vec, const Zmm &zmm_tmp) {
+    gen.vshuff32x4(zmm_tmp, zmm_vec, zmm_vec, 0x4E); // 256-bit shuffle
+    gen.vaddps(zmm_vec, zmm_vec, zmm_tmp);
+    gen.vshuff32x4(zmm_tmp, zmm_vec, zmm_vec, 0xB1); // 128/256-bit shuffle
+    gen.vaddps(zmm_vec, zmm_vec, zmm_tmp);
+    gen.vshufps(zmm_tmp, zmm_vec, zmm_vec, 0x4E); // 64/128-bit shuffle
+    gen.vaddps(zmm_vec, zmm_vec, zmm_tmp);
+    gen.vshufps(zmm_tmp, zmm_vec, zmm_vec, 0xB1); // 32/64-bit shuffle
+    gen.vaddps(zmm_vec, zmm_vec, zmm_tmp);
+}
+
+// Broadcasts f to all the lanes of zmm.
+void broadcast_float(
+        jit_generator &gen, const Zmm &zmm, const Reg64 &reg_tmp, float f) {
+    const Xmm xmm = Xmm(zmm.getIdx());
+    gen.mov(reg_tmp, float2int(f));
+    gen.uni_vmovq(xmm, reg_tmp);
+    gen.uni_vbroadcastss(zmm, xmm);
+}
+
+// Computes 1 / sqrt(var + eps) for the variance reg_var points to.
+void broadcast_inv_sqrtvar(jit_generator &gen, const Zmm &zmm_inv_sqrtvar,
+        const Reg64 &reg_var, const Zmm &zmm_eps, const Zmm &zmm_one) {
+    const Xmm xmm_inv_sqrtvar = Xmm(zmm_inv_sqrtvar.getIdx());
+    gen.vmovss(xmm_inv_sqrtvar, gen.dword[reg_var]);
+    gen.vbroadcastss(zmm_inv_sqrtvar, xmm_inv_sqrtvar);
+    gen.vaddps(zmm_inv_sqrtvar, zmm_inv_sqrtvar, zmm_eps);
+    gen.vsqrtps(zmm_inv_sqrtvar, zmm_inv_sqrtvar);
+    gen.vdivps(zmm_inv_sqrtvar, zmm_one, zmm_inv_sqrtvar);
+}
+
+// Emits op(j, offt_elems, tail) for the vectors of a row of C elements, j
+// is the position of the vector in a block of `unroll` vectors. The full
+// blocks are processed by a runtime loop, so the code size does not grow
+// with C, and advance(elems) moves the pointers op addresses from to the
+// next block.
+template <typename F, typename A>
+void loop_over_row(jit_generator &gen, const Reg64 &reg_cnt, int C,
+        int unroll, F op, A advance) {
+    const int C_vecs = C / simd_w;
+    const int C_blocks = C_vecs / unroll;
+    // a loop running once only adds a branch
+    const int C_looped = C_blocks > 1 ? C_blocks * unroll : 0;
+
+    if (C_looped) {
+        Label l_block;
+        gen.mov(reg_cnt, C_blocks);
+        gen.L(l_block);
+        for (int j = 0; j < unroll; j++)
+            op(j, j * simd_w, false);
+        advance(unroll * simd_w);
+        gen.sub(reg_cnt, 1);
+        gen.jnz(l_block, Xbyak::CodeGenerator::T_NEAR);
+    }
+
+    for (int i = C_looped; i < C_vecs; i++)
+        op(i % unroll, (i - C_looped) * simd_w, false);
+
+    if (C % simd_w) op(C_vecs % unroll, (C_vecs - C_looped) * simd_w, true);
+}
+
+} // namespace
+
+template <data_type_t data_type>
+struct jit_transfer_t {
+    jit_transfer_t(jit_generator &gen, int C);
+
+    // Sets up the tail mask and the bf16 emulation constants, must be called
+    // once at the beginning of the kernel.
+    void prepare();
+
+    // Loads or stores simd_w elements of data_type, or the tail elements of
+    // the normalized axis if `tail` is set.
+    void load(const Zmm &zmm_src, const Reg64 &reg_src, size_t offt_elems,
+            bool tail);
+    void store(const Zmm &zmm_dst, const Reg64 &reg_dst, size_t offt_elems,
+            bool tail);
+
+    // Same for the f32 scale-shift and its gradient.
+    void load_f32(const Zmm &zmm_src, const Reg64 &reg_src, size_t offt_elems,
+            bool tail);
+    void store_f32(const Zmm &zmm_dst, const Reg64 &reg_dst,
+            size_t offt_elems, bool tail);
+
+    const Opmask k_tail = k1;
+
+private:
+    jit_generator &gen_;
+    const int tail_;
+    const bool emulate_bf16_;
+    const Reg64 reg_tmp_ = r15;
+    const Zmm bf16_emu_reserv_1_ = Zmm(28);
+    const Zmm bf16_emu_reserv_2_ = Zmm(29);
+    const Zmm bf16_emu_reserv_3_ = Zmm(30);
+    const Zmm bf16_emu_reserv_4_ = Zmm(31);
+    std::unique_ptr<bf16_emulation_t> bf16_emu_;
+};
+
+template <data_type_t data_type>
+jit_transfer_t<data_type>::jit_transfer_t(jit_generator &gen, int C)
+    : gen_(gen)
+    , tail_(C % simd_w)
+    , emulate_bf16_(data_type == bf16 && !mayiuse(avx512_core_bf16)) {
+    if (emulate_bf16_)
+        bf16_emu_ = utils::make_unique<bf16_emulation_t>(&gen_,
+                bf16_emu_reserv_1_, bf16_emu_reserv_2_, bf16_emu_reserv_3_,
+                reg_tmp_, bf16_emu_reserv_4_);
+}
+
+template <data_type_t data_type>
+void jit_transfer_t<data_type>::prepare() {
+    if (emulate_bf16_) bf16_emu_->init_vcvtneps2bf16();
+    if (tail_) {
+        gen_.mov(reg_tmp_.cvt32(), (1 << tail_) - 1);
+        gen_.kmovw(k_tail, reg_tmp_.cvt32());
+    }
+}
+
+template <data_type_t data_type>
+void jit_transfer_t<data_type>::load_f32(const Zmm &zmm_src,
+        const Reg64 &reg_src, size_t offt_elems, bool tail) {
+    const auto addr = gen_.zword[reg_src + offt_elems * sizeof(float)];
+    if (tail)
+        gen_.vmovups(zmm_src | k_tail | T_z, addr);
+    else
+        gen_.vmovups(zmm_src, addr);
+}
+
+template <data_type_t data_type>
+void jit_transfer_t<data_type>::store_f32(const Zmm &zmm_dst,
+        const Reg64 &reg_dst, size_t offt_elems, bool tail) {
+    const auto addr = gen_.zword[reg_dst + offt_elems * sizeof(float)];
+    if (tail)
+        gen_.vmovups(addr | k_tail, zmm_dst);
+    else
+        gen_.vmovups(addr, zmm_dst);
+}
+
+template <>
+void jit_transfer_t<f32>::load(const Zmm &zmm_src, const Reg64 &reg_src,
+        size_t offt_elems, bool tail) {
+    load_f32(zmm_src, reg_src, offt_elems, tail);
+}
+
+template <>
+void jit_transfer_t<f32>::store(const Zmm &zmm_dst, const Reg64 &reg_dst,
+        size_t offt_elems, bool tail) {
+    store_f32(zmm_dst, reg_dst, offt_elems, tail);
+}
+
+template <>
+void jit_transfer_t<bf16>::load(const Zmm &zmm_src, const Reg64 &reg_src,
+        size_t offt_elems, bool tail) {
+    const auto addr = gen_.yword[reg_src + offt_elems * sizeof(bfloat16_t)];
+    if (tail)
+        gen_.vpmovzxwd(zmm_src | k_tail | T_z, addr);
+    else
+        gen_.vpmovzxwd(zmm_src, addr);
+    gen_.vpslld(zmm_src, zmm_src, 0x10);
+}
+
+template <>
+void jit_transfer_t<bf16>::store(const Zmm &zmm_dst, const Reg64 &reg_dst,
+        size_t offt_elems, bool tail) {
+    const Ymm ymm_dst = Ymm(zmm_dst.getIdx());
+    if (emulate_bf16_)
+        bf16_emu_->vcvtneps2bf16(ymm_dst, zmm_dst);
+    else
+        gen_.vcvtneps2bf16(ymm_dst, zmm_dst);
+    const auto addr = gen_.yword[reg_dst + offt_elems * sizeof(bfloat16_t)];
+    if (tail)
+        gen_.vmovdqu16(addr | k_tail, ymm_dst);
+    else
+        gen_.vmovdqu16(addr, ymm_dst);
+}
+
+template <data_type_t data_type>
+struct jit_statistics_kernel_t : statistics_kernel_t<data_type>, jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_statistics_kernel_t);
+
+    jit_statistics_kernel_t(const layer_normalization_pd_t *pd);
+
+    using data_t = typename prec_traits<data_type>::type;
+    void operator()(const data_t *src, float *mean, float *var) const override;
+    void process_rows(const data_t *src, float *mean, float *var,
+            dim_t nrows) const override;
+
+private:
+    jit_transfer_t<data_type> jit_transfer_;
+    static constexpr int unroll_factor_ = 8;
+    using statistics_kernel_t<data_type>::C_;
+    using statistics_kernel_t<data_type>::C_padded_;
+
+    struct ker_args_t {
+        const data_t *src;
+        float *mean;
+        float *var;
+        size_t nrows;
+    };
+    void (*ker_)(const ker_args_t *args) = nullptr;
+
+    void generate();
+
+    template <typename F>
+    void compute(F op);
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = rdx;
+    Reg64 reg_mean = rbx;
+    Reg64 reg_var = rsi; // rbp is used by the preamble
+    Reg64 reg_tmp = rax;
+    Reg64 reg_nrows = r13;
+    Reg64 reg_src_c = r14;
+    Reg64 reg_c_blocks = r12;
+
+    // vector registers 0 .. unroll_factor_ - 1 are the accumulators and
+    // unroll_factor_ .. 2 * unroll_factor_ - 1 hold the loaded data
+    Zmm vmm_mean = Zmm(2 * unroll_factor_);
+    Zmm vmm_tmp = Zmm(2 * unroll_factor_ + 1);
+};
+
+template <data_type_t data_type>
+jit_statistics_kernel_t<data_type>::jit_statistics_kernel_t(
+        const layer_normalization_pd_t *pd)
+    : statistics_kernel_t<data_type>(pd), jit_transfer_ {*this, C_} {
+    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx512_common));
+    generate();
+}
+
+template <data_type_t data_type>
+void jit_statistics_kernel_t<data_type>::operator()(
+        const data_t *src, float *mean, float *var) const {
+    process_rows(src, mean, var, 1);
+}
+
+template <data_type_t data_type>
+void jit_statistics_kernel_t<data_type>::process_rows(
+        const data_t *src, float *mean, float *var, dim_t nrows) const {
+    assert(ker_ && nrows > 0);
+    ker_args_t args;
+    args.src = src;
+    args.mean = mean;
+    args.var = var;
+    args.nrows = nrows;
+    ker_(&args);
+}
+
+template <data_type_t data_type>
+void jit_statistics_kernel_t<data_type>::generate() {
+    preamble();
+    jit_transfer_.prepare();
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+    mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+    mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+    Label l_row;
+    L(l_row);
+    {
+        // compute mean
+        compute([=](Zmm vmm_acc, Zmm vmm_src, bool tail) {
+            vaddps(vmm_acc, vmm_acc, vmm_src);
+        });
+        vmovss(ptr[reg_mean], Xmm(0));
+
+        // compute var, the row is read again from L1 since a one-pass
+        // update would need a division per vector
+        uni_vmovups(vmm_mean, Zmm(0));
+        compute([=](Zmm vmm_acc, Zmm vmm_src, bool tail) {
+            if (tail)
+                vsubps(vmm_src | jit_transfer_.k_tail | T_z, vmm_src,
+                        vmm_mean);
+            else
+                vsubps(vmm_src, vmm_src, vmm_mean);
+            vfmadd231ps(vmm_acc, vmm_src, vmm_src);
+        });
+        vmovss(ptr[reg_var], Xmm(0));
+
+        add(reg_src, C_padded_ * sizeof(data_t));
+        add(reg_mean, sizeof(float));
+        add(reg_var, sizeof(float));
+        sub(reg_nrows, 1);
+        jnz(l_row, T_NEAR);
+    }
+
+    postamble();
+
+    ker_ = getCode<decltype(ker_)>();
+}
+
+template <data_type_t data_type>
+template <typename F>
+void jit_statistics_kernel_t<data_type>::compute(F op) {
+    const int C_vecs = C_ / simd_w;
+
+    // independent accumulators hide the latency of the FMA
+    int unroll = 1;
+    while (2 * unroll <= nstl::min(C_vecs, (int)unroll_factor_))
+        unroll *= 2;
+
+    for (int j = 0; j < unroll; j++)
+        uni_vpxor(Zmm(j), Zmm(j), Zmm(j));
+
+    mov(reg_src_c, reg_src);
+    loop_over_row(
+            *this, reg_c_blocks, C_, unroll,
+            [=](int j, size_t offt_elems, bool tail) {
+                const Zmm vmm_src = Zmm(unroll_factor_ + j);
+                jit_transfer_.load(vmm_src, reg_src_c, offt_elems, tail);
+                op(Zmm(j), vmm_src, tail);
+            },
+            [=](size_t elems) { add(reg_src_c, elems * sizeof(data_t)); });
+
+    // accumulators reduction
+    for (int n = unroll; n > 1; n /= 2)
+        for (int j = 0; j < n / 2; j++)
+            vaddps(Zmm(j), Zmm(j), Zmm(j + n / 2));
+
+    // vector reduction
+    horizontal_add(*this, Zmm(0), vmm_tmp);
+
+    // scale
+    broadcast_float(*this, vmm_tmp, reg_tmp, C_);
+    vdivps(Zmm(0), Zmm(0), vmm_tmp);
+}
+
+template <data_type_t data_type>
+struct jit_data_kernel_t : data_kernel_t<data_type>, jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_data_kernel_t);
+
+    jit_data_kernel_t(const layer_normalization_pd_t *pd);
+
+    using data_t = typename prec_traits<data_type>::type;
+    void operator()(const data_t *src, data_t *dst, const float *ss,
+            const float *mean, const float *var) const override;
+    void process_rows(const data_t *src, data_t *dst, const float *ss,
+            const float *mean, const float *var, dim_t nrows) const override;
+
+private:
+    jit_transfer_t<data_type> jit_transfer_;
+    static constexpr int unroll_ = 4;
+    using data_kernel_t<data_type>::C_;
+    using data_kernel_t<data_type>::C_padded_;
+    using data_kernel_t<data_type>::eps_;
+    using data_kernel_t<data_type>::use_scaleshift_;
+
+    struct ker_args_t {
+        const data_t *src;
+        data_t *dst;
+        const float *ss;
+        const float *mean;
+        const float *var;
+        size_t nrows;
+    };
+    void (*ker_)(const ker_args_t *args) = nullptr;
+
+    void generate();
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = rdx;
+    Reg64 reg_dst = rax;
+    Reg64 reg_ss = r9;
+    Reg64 reg_tmp = r8;
+    Reg64 reg_mean = rbx;
+    Reg64 reg_var = rsi;
+    Reg64 reg_nrows = r13;
+    Reg64 reg_src_c = r14;
+    Reg64 reg_dst_c = r10;
+    Reg64 reg_ss_c = r11;
+    Reg64 reg_c_blocks = r12;
+
+    // vector j of a block is processed in vmm_data(j), vmm_gamma(j) and
+    // vmm_beta(j)
+    Zmm vmm_data(int j) { return Zmm(j); }
+    Zmm vmm_gamma(int j) { return Zmm(unroll_ + j); }
+    Zmm vmm_beta(int j) { return Zmm(2 * unroll_ + j); }
+
+    Zmm vmm_inv_sqrtvar = Zmm(16);
+    Zmm vmm_mean = Zmm(17);
+    Zmm vmm_eps = Zmm(18);
+    Zmm vmm_one = Zmm(19);
+};
+
+template <data_type_t data_type>
+jit_data_kernel_t<data_type>::jit_data_kernel_t(
+        const layer_normalization_pd_t *pd)
+    : data_kernel_t<data_type>(pd), jit_transfer_ {*this, C_} {
+    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx512_common));
+    generate();
+}
+
+template <data_type_t data_type>
+void jit_data_kernel_t<data_type>::operator()(const data_t *src, data_t *dst,
+        const float *ss, const float *mean, const float *var) const {
+    process_rows(src, dst, ss, mean, var, 1);
+}
+
+template <data_type_t data_type>
+void jit_data_kernel_t<data_type>::process_rows(const data_t *src,
+        data_t *dst, const float *ss, const float *mean, const float *var,
+        dim_t nrows) const {
+    assert(ker_ && nrows > 0);
+    ker_args_t args;
+    args.src = src;
+    args.dst = dst;
+    args.ss = ss;
+    args.mean = mean;
+    args.var = var;
+    args.nrows = nrows;
+    ker_(&args);
+}
+
+template <data_type_t data_type>
+void jit_data_kernel_t<data_type>::generate() {
+    preamble();
+    jit_transfer_.prepare();
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+    mov(reg_ss, ptr[reg_param + PARAM_OFF(ss)]);
+    mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+    mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+    mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+    broadcast_float(*this, vmm_eps, reg_tmp, eps_);
+    broadcast_float(*this, vmm_one, reg_tmp, 1.f);
+
+    // scale and shift are applied in the same pass as the normalization
+    auto op = [=](int j, size_t offt_elems, bool tail) {
+        if (use_scaleshift_) {
+            jit_transfer_.load_f32(vmm_gamma(j), reg_ss_c, offt_elems, tail);
+            jit_transfer_.load_f32(
+                    vmm_beta(j), reg_ss_c, offt_elems + C_, tail);
+        }
+        jit_transfer_.load(vmm_data(j), reg_src_c, offt_elems, tail);
+        vsubps(vmm_data(j), vmm_data(j), vmm_mean);
+        vmulps(vmm_data(j), vmm_data(j), vmm_inv_sqrtvar);
+        if (use_scaleshift_)
+            vfmadd213ps(vmm_data(j), vmm_gamma(j), vmm_beta(j));
+        jit_transfer_.store(vmm_data(j), reg_dst_c, offt_elems, tail);
+    };
+
+    auto advance = [=](size_t elems) {
+        add(reg_src_c, elems * sizeof(data_t));
+        add(reg_dst_c, elems * sizeof(data_t));
+        if (use_scaleshift_) add(reg_ss_c, elems * sizeof(float));
+    };
+
+    Label l_row;
+    L(l_row);
+    {
+        const Xmm xmm_mean = Xmm(vmm_mean.getIdx());
+        vmovss(xmm_mean, dword[reg_mean]);
+        vbroadcastss(vmm_mean, xmm_mean);
+        broadcast_inv_sqrtvar(
+                *this, vmm_inv_sqrtvar, reg_var, vmm_eps, vmm_one);
+
+        mov(reg_src_c, reg_src);
+        mov(reg_dst_c, reg_dst);
+        mov(reg_ss_c, reg_ss);
+        loop_over_row(*this, reg_c_blocks, C_, unroll_, op, advance);
+
+        add(reg_src, C_padded_ * sizeof(data_t));
+        add(reg_dst, C_padded_ * sizeof(data_t));
+        add(reg_mean, sizeof(float));
+        add(reg_var, sizeof(float));
+        sub(reg_nrows, 1);
+        jnz(l_row, T_NEAR);
+    }
+
+    postamble();
+
+    ker_ = getCode<decltype(ker_)>();
+}
+
+template <data_type_t data_type>
+struct jit_diff_ss_kernel_t : diff_ss_kernel_t<data_type>, jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_diff_ss_kernel_t);
+
+    jit_diff_ss_kernel_t(const layer_normalization_pd_t *pd);
+
+    using data_t = typename prec_traits<data_type>::type;
+    void operator()(const data_t *src, const data_t *diff_dst,
+            float *diff_gamma, float *diff_beta, const float *mean,
+            const float *var) const override;
+    void process_rows(const data_t *src, const data_t *diff_dst,
+            float *diff_gamma, float *diff_beta, const float *mean,
+            const float *var, dim_t nrows) const override;
+
+private:
+    jit_transfer_t<data_type> jit_transfer_;
+    static constexpr int unroll_ = 4;
+    using diff_ss_kernel_t<data_type>::C_;
+    using diff_ss_kernel_t<data_type>::C_padded_;
+    using diff_ss_kernel_t<data_type>::eps_;
+
+    struct ker_args_t {
+        const data_t *src;
+        const data_t *diff_dst;
+        float *diff_gamma;
+        float *diff_beta;
+        const float *mean;
+        const float *var;
+        size_t nrows;
+    };
+    void (*ker_)(const ker_args_t *args) = nullptr;
+
+    void generate();
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = rdx;
+    Reg64 reg_diff_dst = rax;
+    Reg64 reg_diff_gamma = r9;
+    Reg64 reg_diff_beta = r8;
+    Reg64 reg_mean = rbx;
+    Reg64 reg_var = rsi;
+    Reg64 reg_nrows = r13;
+    Reg64 reg_src_c = r14;
+    Reg64 reg_diff_dst_c = r10;
+    Reg64 reg_diff_gamma_c = r11;
+    Reg64 reg_diff_beta_c = rcx;
+    Reg64 reg_c_blocks = r12;
+
+    // vector j of a block is processed in vmm_ddst(j), vmm_dgamma(j),
+    // vmm_dbeta(j) and vmm_src(j)
+    Zmm vmm_ddst(int j) { return Zmm(j); }
+    Zmm vmm_dgamma(int j) { return Zmm(unroll_ + j); }
+    Zmm vmm_dbeta(int j) { return Zmm(2 * unroll_ + j); }
+    Zmm vmm_src(int j) { return Zmm(3 * unroll_ + j); }
+
+    Zmm vmm_inv_sqrtvar = Zmm(16);
+    Zmm vmm_mean = Zmm(17);
+    Zmm vmm_eps = Zmm(18);
+    Zmm vmm_one = Zmm(19);
+};
+
+template <data_type_t data_type>
+jit_diff_ss_kernel_t<data_type>::jit_diff_ss_kernel_t(
+        const layer_normalization_pd_t *pd)
+    : diff_ss_kernel_t<data_type>(pd), jit_transfer_ {*this, C_} {
+    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx512_common));
+    generate();
+}
+
+template <data_type_t data_type>
+void jit_diff_ss_kernel_t<data_type>::operator()(const data_t *src,
+        const data_t *diff_dst, float *diff_gamma, float *diff_beta,
+        const float *mean, const float *var) const {
+    process_rows(src, diff_dst, diff_gamma, diff_beta, mean, var, 1);
+}
+
+template <data_type_t data_type>
+void jit_diff_ss_kernel_t<data_type>::process_rows(const data_t *src,
+        const data_t *diff_dst, float *diff_gamma, float *diff_beta,
+        const float *mean, const float *var, dim_t nrows) const {
+    assert(ker_ && nrows > 0);
+    ker_args_t args;
+    args.src = src;
+    args.diff_dst = diff_dst;
+    args.diff_gamma = diff_gamma;
+    args.diff_beta = diff_beta;
+    args.mean = mean;
+    args.var = var;
+    args.nrows = nrows;
+    ker_(&args);
+}
+
+template <data_type_t data_type>
+void jit_diff_ss_kernel_t<data_type>::generate() {
+    preamble();
+    jit_transfer_.prepare();
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
+    mov(reg_diff_gamma, ptr[reg_param + PARAM_OFF(diff_gamma)]);
+    mov(reg_diff_beta, ptr[reg_param + PARAM_OFF(diff_beta)]);
+    mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+    mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+    mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+    broadcast_float(*this, vmm_eps, reg_c_blocks, eps_);
+    broadcast_float(*this, vmm_one, reg_c_blocks, 1.f);
+
+    auto op = [=](int j, size_t offt_elems, bool tail) {
+        jit_transfer_.load(vmm_ddst(j), reg_diff_dst_c, offt_elems, tail);
+        jit_transfer_.load_f32(
+                vmm_dbeta(j), reg_diff_beta_c, offt_elems, tail);
+        jit_transfer_.load_f32(
+                vmm_dgamma(j), reg_diff_gamma_c, offt_elems, tail);
+        jit_transfer_.load(vmm_src(j), reg_src_c, offt_elems, tail);
+        vaddps(vmm_dbeta(j), vmm_dbeta(j), vmm_ddst(j));
+        vsubps(vmm_src(j), vmm_src(j), vmm_mean);
+        vmulps(vmm_src(j), vmm_src(j), vmm_inv_sqrtvar);
+        vfmadd231ps(vmm_dgamma(j), vmm_src(j), vmm_ddst(j));
+        jit_transfer_.store_f32(
+                vmm_dbeta(j), reg_diff_beta_c, offt_elems, tail);
+        jit_transfer_.store_f32(
+                vmm_dgamma(j), reg_diff_gamma_c, offt_elems, tail);
+    };
+
+    auto advance = [=](size_t elems) {
+        add(reg_src_c, elems * sizeof(data_t));
+        add(reg_diff_dst_c, elems * sizeof(data_t));
+        add(reg_diff_gamma_c, elems * sizeof(float));
+        add(reg_diff_beta_c, elems * sizeof(float));
+    };
+
+    Label l_row;
+    L(l_row);
+    {
+        const Xmm xmm_mean = Xmm(vmm_mean.getIdx());
+        vmovss(xmm_mean, dword[reg_mean]);
+        vbroadcastss(vmm_mean, xmm_mean);
+        broadcast_inv_sqrtvar(
+                *this, vmm_inv_sqrtvar, reg_var, vmm_eps, vmm_one);
+
+        mov(reg_src_c, reg_src);
+        mov(reg_diff_dst_c, reg_diff_dst);
+        mov(reg_diff_gamma_c, reg_diff_gamma);
+        mov(reg_diff_beta_c, reg_diff_beta);
+        loop_over_row(*this, reg_c_blocks, C_, unroll_, op, advance);
+
+        add(reg_src, C_padded_ * sizeof(data_t));
+        add(reg_diff_dst, C_padded_ * sizeof(data_t));
+        add(reg_mean, sizeof(float));
+        add(reg_var, sizeof(float));
+        sub(reg_nrows, 1);
+        jnz(l_row, T_NEAR);
+    }
+
+    postamble();
+
+    ker_ = getCode<decltype(ker_)>();
+}
+
+template <data_type_t data_type>
+struct jit_diff_data_kernel_t : diff_data_kernel_t<data_type>, jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_diff_data_kernel_t);
+
+    jit_diff_data_kernel_t(const layer_normalization_pd_t *pd);
+
+    using data_t = typename prec_traits<data_type>::type;
+    void operator()(const data_t *src, const data_t *diff_dst, data_t *diff_src,
+            const float *ss, const float *mean,
+            const float *var) const override;
+    void process_rows(const data_t *src, const data_t *diff_dst,
+            data_t *diff_src, const float *ss, const float *mean,
+            const float *var, dim_t nrows) const override;
+
+private:
+    jit_transfer_t<data_type> jit_transfer_;
+    static constexpr int unroll_ = 4;
+    using diff_data_kernel_t<data_type>::C_;
+    using diff_data_kernel_t<data_type>::C_padded_;
+    using diff_data_kernel_t<data_type>::eps_;
+    using diff_data_kernel_t<data_type>::calculate_diff_stats_;
+    using diff_data_kernel_t<data_type>::use_scaleshift_;
+
+    struct ker_args_t {
+        const data_t *src;
+        const data_t *diff_dst;
+        data_t *diff_src;
+        const float *ss;
+        const float *mean;
+        const float *var;
+        size_t nrows;
+    };
+    void (*ker_)(const ker_args_t *args) = nullptr;
+
+    void generate();
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_src = rdx;
+    Reg64 reg_diff_src = rax;
+    Reg64 reg_diff_dst = rbx;
+    Reg64 reg_gamma = r11;
+    Reg64 reg_mean = r8;
+    Reg64 reg_var = r9;
+    Reg64 reg_nrows = r13;
+    Reg64 reg_src_c = r14;
+    Reg64 reg_diff_src_c = rcx;
+    Reg64 reg_diff_dst_c = r10;
+    Reg64 reg_gamma_c = rsi;
+    Reg64 reg_c_blocks = r12;
+
+    // vector j of a block is processed in vmm_dsrc(j), vmm_gamma(j) and
+    // vmm_src(j), and accumulated in vmm_dd_gamma(j) and vmm_dd_gamma_x(j)
+    Zmm vmm_dsrc(int j) { return Zmm(j); }
+    Zmm vmm_gamma(int j) { return Zmm(unroll_ + j); }
+    Zmm vmm_src(int j) { return Zmm(2 * unroll_ + j); }
+    Zmm vmm_dd_gamma(int j) { return Zmm(3 * unroll_ + j); }
+    Zmm vmm_dd_gamma_x(int j) { return Zmm(4 * unroll_ + j); }
+
+    Zmm vmm_C = Zmm(20);
+    Zmm vmm_inv_sqrtvar = Zmm(21);
+    Zmm vmm_mean = Zmm(22);
+    Zmm vmm_tmp = Zmm(23);
+    Zmm vmm_eps = Zmm(24);
+    Zmm vmm_one = Zmm(25);
+};
+
+template <data_type_t data_type>
+jit_diff_data_kernel_t<data_type>::jit_diff_data_kernel_t(
+        const layer_normalization_pd_t *pd)
+    : diff_data_kernel_t<data_type>(pd), jit_transfer_ {*this, C_} {
+    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx512_common));
+    generate();
+}
+
+template <data_type_t data_type>
+void jit_diff_data_kernel_t<data_type>::operator()(const data_t *src,
+        const data_t *diff_dst, data_t *diff_src, const float *ss,
+        const float *mean, const float *var) const {
+    process_rows(src, diff_dst, diff_src, ss, mean, var, 1);
+}
+
+template <data_type_t data_type>
+void jit_diff_data_kernel_t<data_type>::process_rows(const data_t *src,
+        const data_t *diff_dst, data_t *diff_src, const float *ss,
+        const float *mean, const float *var, dim_t nrows) const {
+    assert(ker_ && nrows > 0);
+    ker_args_t args;
+    args.src = src;
+    args.diff_dst = diff_dst;
+    args.diff_src = diff_src;
+    args.ss = ss;
+    args.mean = mean;
+    args.var = var;
+    args.nrows = nrows;
+    ker_(&args);
+}
+
+template <data_type_t data_type>
+void jit_diff_data_kernel_t<data_type>::generate() {
+    preamble();
+    jit_transfer_.prepare();
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
+    mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
+    mov(reg_gamma, ptr[reg_param + PARAM_OFF(ss)]);
+    mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+    mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+    mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+    broadcast_float(*this, vmm_C, reg_c_blocks, C_);
+    broadcast_float(*this, vmm_eps, reg_c_blocks, eps_);
+    broadcast_float(*this, vmm_one, reg_c_blocks, 1.f);
+
+    auto compute_dd_gammas = [=](int j, size_t offt_elems, bool tail) {
+        Zmm vmm_ddst = vmm_dsrc(j);
+        jit_transfer_.load(vmm_ddst, reg_diff_dst_c, offt_elems, tail);
+        if (use_scaleshift_) {
+            jit_transfer_.load_f32(vmm_gamma(j), reg_gamma_c, offt_elems, tail);
+            vmulps(vmm_ddst, vmm_ddst, vmm_gamma(j));
+        }
+        jit_transfer_.load(vmm_src(j), reg_src_c, offt_elems, tail);
+        vaddps(vmm_dd_gamma(j), vmm_dd_gamma(j), vmm_ddst);
+        // the masked out elements of vmm_ddst are zero, no need to mask here
+        vsubps(vmm_src(j), vmm_src(j), vmm_mean);
+        vfmadd231ps(vmm_dd_gamma_x(j), vmm_ddst, vmm_src(j));
+    };
+
+    // the gradients of the statistics are reduced to vmm_dd_gamma(0) and
+    // vmm_dd_gamma_x(0)
+    auto compute_diff_src = [=](int j, size_t offt_elems, bool tail) {
+        jit_transfer_.load(vmm_dsrc(j), reg_diff_dst_c, offt_elems, tail);
+        if (use_scaleshift_) {
+            jit_transfer_.load_f32(vmm_gamma(j), reg_gamma_c, offt_elems, tail);
+            vmulps(vmm_dsrc(j), vmm_dsrc(j), vmm_gamma(j));
+        }
+        if (calculate_diff_stats_) {
+            jit_transfer_.load(vmm_src(j), reg_src_c, offt_elems, tail);
+            vsubps(vmm_src(j), vmm_src(j), vmm_mean);
+            vmulps(vmm_src(j), vmm_src(j), vmm_inv_sqrtvar);
+            vfmadd213ps(vmm_src(j), vmm_dd_gamma_x(0), vmm_dd_gamma(0));
+            vdivps(vmm_src(j), vmm_src(j), vmm_C);
+            vsubps(vmm_dsrc(j), vmm_dsrc(j), vmm_src(j));
+        }
+        vmulps(vmm_dsrc(j), vmm_dsrc(j), vmm_inv_sqrtvar);
+        jit_transfer_.store(vmm_dsrc(j), reg_diff_src_c, offt_elems, tail);
+    };
+
+    auto advance = [=](size_t elems) {
+        add(reg_src_c, elems * sizeof(data_t));
+        add(reg_diff_dst_c, elems * sizeof(data_t));
+        add(reg_diff_src_c, elems * sizeof(data_t));
+        if (use_scaleshift_) add(reg_gamma_c, elems * sizeof(float));
+    };
+
+    auto reset_pointers = [=]() {
+        mov(reg_src_c, reg_src);
+        mov(reg_diff_dst_c, reg_diff_dst);
+        mov(reg_diff_src_c, reg_diff_src);
+        mov(reg_gamma_c, reg_gamma);
+    };
+
+    Label l_row;
+    L(l_row);
+    {
+        if (calculate_diff_stats_) {
+            const Xmm xmm_mean = Xmm(vmm_mean.getIdx());
+            vmovss(xmm_mean, dword[reg_mean]);
+            vbroadcastss(vmm_mean, xmm_mean);
+        }
+        broadcast_inv_sqrtvar(
+                *this, vmm_inv_sqrtvar, reg_var, vmm_eps, vmm_one);
+
+        if (calculate_diff_stats_) {
+            for (int j = 0; j < unroll_; j++) {
+                uni_vpxor(vmm_dd_gamma(j), vmm_dd_gamma(j), vmm_dd_gamma(j));
+                uni_vpxor(vmm_dd_gamma_x(j), vmm_dd_gamma_x(j),
+                        vmm_dd_gamma_x(j));
+            }
+
+            reset_pointers();
+            loop_over_row(*this, reg_c_blocks, C_, unroll_, compute_dd_gammas,
+                    advance);
+
+            for (int j = 1; j < unroll_; j++) {
+                vaddps(vmm_dd_gamma(0), vmm_dd_gamma(0), vmm_dd_gamma(j));
+                vaddps(vmm_dd_gamma_x(0), vmm_dd_gamma_x(0),
+                        vmm_dd_gamma_x(j));
+            }
+            horizontal_add(*this, vmm_dd_gamma(0), vmm_tmp);
+            horizontal_add(*this, vmm_dd_gamma_x(0), vmm_tmp);
+
+            vmulps(vmm_dd_gamma_x(0), vmm_dd_gamma_x(0), vmm_inv_sqrtvar);
+        }
+
+        reset_pointers();
+        loop_over_row(
+                *this, reg_c_blocks, C_, unroll_, compute_diff_src, advance);
+
+        add(reg_src, C_padded_ * sizeof(data_t));
+        add(reg_diff_dst, C_padded_ * sizeof(data_t));
+        add(reg_diff_src, C_padded_ * sizeof(data_t));
+        add(reg_mean, sizeof(float));
+        add(reg_var, sizeof(float));
+        sub(reg_nrows, 1);
+        jnz(l_row, T_NEAR);
+    }
+
+    postamble();
+
+    ker_ = getCode<decltype(ker_)>();
+}
+
+template <>
+statistics_kernel_t<bf16> *statistics_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_core) ? new jit_statistics_kernel_t<bf16>(pd)
+                                : nullptr;
+}
+
+template <>
+statistics_kernel_t<f32> *statistics_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_common) ? new jit_statistics_kernel_t<f32>(pd)
+                                  : nullptr;
+}
+
+template <>
+data_kernel_t<bf16> *data_kernel_create(const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_core) ? new jit_data_kernel_t<bf16>(pd) : nullptr;
+}
+
+template <>
+data_kernel_t<f32> *data_kernel_create(const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_common) ? new jit_data_kernel_t<f32>(pd) : nullptr;
+}
+
+template <>
+diff_ss_kernel_t<bf16> *diff_ss_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_core) ? new jit_diff_ss_kernel_t<bf16>(pd) : nullptr;
+}
+
+template <>
+diff_ss_kernel_t<f32> *diff_ss_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_common) ? new jit_diff_ss_kernel_t<f32>(pd)
+                                  : nullptr;
+}
+
+template <>
+diff_data_kernel_t<bf16> *diff_data_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_core) ? new jit_diff_data_kernel_t<bf16>(pd)
+                                : nullptr;
+}
+
+template <>
+diff_data_kernel_t<f32> *diff_data_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx512_common) ? new jit_diff_data_kernel_t<f32>(pd)
+                                  : nullptr;
+}
+
+} // namespace lnorm_utils
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -21,7 +21,9 @@
 #include "dnnl_debug.h"
 
 #include "common/c_types_map.hpp"
+#include "common/math_utils.hpp"
 #include "common/memory_desc_wrapper.hpp"
+#include "common/memory_tracking.hpp"
 #include "common/nstl.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
@@ -30,6 +32,7 @@
 #include "cpu/aarch64/jit_uni_reorder.hpp"
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/cpu_reorder_pd.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/aarch64/jit_generator.hpp"
 #include "cpu/aarch64/jit_sve_512_core_bf16cvt.hpp"
@@ -2112,6 +2115,440 @@ private:
     Ymm ymm_tmp = ymm0;
 };
 
+/* Native SVE kernel for the quantization (f32/s32/s8/u8 with output scales),
+ * bf16 and s8s8 compensation problems.
+ *
+ * A vector covers simd_w() points of node 0 or, if node 0 is shorter than
+ * the vector, whole rows of node 0 taken at consecutive points of node 1.
+ * Strided operands are accessed with gathers/scatters on 32-bit byte
+ * offsets, the remaining nodes are jit loops.
+ *
+ * The compensation point of every lane gets its own int32 slot in the buffer
+ * passed by the driver (simd_w() slots per point), so lanes sharing a point
+ * never collide in a scatter. The driver sums the slots up. */
+struct jit_sve_reorder_kernel_t : public kernel_t, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_reorder_kernel_t)
+
+    enum { ndims_jit_loop_max = 3 };
+
+    static int simd_w() { return get_sve_length() / sizeof(float); }
+
+    /** returns the number of nodes a vector spans */
+    static int vec_ndims(const prb_t &p) {
+        const size_t n0 = p.nodes[0].n;
+        return (p.ndims > 1 && n0 > 1 && n0 < (size_t)simd_w()
+                       && simd_w() % n0 == 0)
+                ? 2
+                : 1;
+    }
+
+    static bool applicable(const prb_t &p) {
+        using namespace data_type;
+
+        bool ok = true && mayiuse_sve_any_vl() && p.ndims > 0
+                && utils::one_of(p.itype, f32, bf16, s32, s8, u8)
+                && utils::one_of(p.otype, f32, bf16, s32, s8, u8)
+                && IMPLICATION(
+                        p.itype == bf16, utils::one_of(p.otype, f32, bf16))
+                && IMPLICATION(
+                        p.otype == bf16, utils::one_of(p.itype, f32, bf16))
+                && utils::everyone_is(0, p.ioff, p.ooff)
+                && IMPLICATION(p.req_s8s8_comp, p.otype == s8 && p.beta == 0.f)
+                && p.ndims - vec_ndims(p) <= ndims_jit_loop_max;
+        if (!ok) return false;
+
+        /* a vector spans at most simd_w() strides of each of its nodes,
+         * the gather offsets are 32-bit */
+        const ptrdiff_t max_off = ((1LL << 31) - 1) / simd_w();
+        const ptrdiff_t comp_lanes = p.req_s8s8_comp ? simd_w() : 0;
+        for (int d = 0; d < vec_ndims(p); ++d) {
+            const node_t &n = p.nodes[d];
+            const bool strides_ok = true
+                    && n.is < max_off / (int)data_type_size(p.itype)
+                    && n.os < max_off / (int)data_type_size(p.otype)
+                    && n.ss < max_off / (int)sizeof(float)
+                    && n.cs * comp_lanes < max_off / (int)sizeof(int32_t);
+            if (!strides_ok) return false;
+        }
+
+        return true;
+    }
+
+    jit_sve_reorder_kernel_t(const desc_t &desc)
+        : kernel_t(desc), jit_generator() {
+        using namespace data_type;
+
+        itype_sz_ = data_type_size(prb_.itype);
+        otype_sz_ = data_type_size(prb_.otype);
+        vec_ndims_ = vec_ndims(prb_);
+
+        const bool with_scale = prb_.scale_type != scale_type_t::NONE
+                || prb_.scale_adjust != 1.f;
+        const bool is_int_i = utils::one_of(prb_.itype, s32, s8, u8);
+        const bool is_int_o = utils::one_of(prb_.otype, s32, s8, u8);
+        copy_ = prb_.itype == prb_.otype && !with_scale && prb_.beta == 0.f;
+        saturate_only_ = !copy_ && is_int_i && is_int_o && !with_scale
+                && prb_.beta == 0.f;
+
+        for (int s = 0; s < n_streams; ++s)
+            access_[s] = access_init(s);
+
+        generate();
+        ker_ = (void (*)(const call_param_t *))getCode32();
+    }
+
+private:
+    using reg64_t = const xa::XReg;
+
+    enum { s_in, s_out, s_scale, s_comp, n_streams };
+    enum class access_t { none, contiguous, broadcast, gather };
+
+    int itype_sz_;
+    int otype_sz_;
+    int vec_ndims_;
+    bool copy_; // the same type, nothing to compute
+    bool saturate_only_; // integer to integer, only a saturation
+    access_t access_[n_streams];
+
+    reg64_t reg_ptr[n_streams] = {x1, x2, x3, x5};
+    reg64_t reg_aux[n_streams] = {x6, x8, x9, x10};
+    reg64_t reg_loop[ndims_jit_loop_max] = {x11, x12, x13};
+    reg64_t reg_vec_loop = x14;
+    reg64_t reg_tmp = x16;
+    reg64_t reg_tmp_imm = x17;
+
+    const xa::PReg p_all = p1;
+    const xa::PReg p_tail = p2;
+    const xa::PReg p_nan = p3;
+
+    const xa::ZReg z_data = z0;
+    const xa::ZReg z_aux = z1;
+    const xa::ZReg z_tmp0 = z2;
+    const xa::ZReg z_tmp1 = z3;
+    const xa::ZReg z_scale = z16;
+    const xa::ZReg z_adjust = z17;
+    const xa::ZReg z_beta = z18;
+    const xa::ZReg z_one = z19;
+    const xa::ZReg z_bf16_round = z20;
+    const xa::ZReg z_bf16_qnan = z21;
+    const xa::ZReg z_idx[n_streams] = {z22, z23, z24, z25};
+
+    bool active(int s) const {
+        switch (s) {
+            case s_scale: return prb_.scale_type == scale_type_t::MANY;
+            case s_comp: return prb_.req_s8s8_comp;
+            default: return true;
+        }
+    }
+
+    /** returns the stride of the stream along the node d in bytes */
+    ptrdiff_t stride(int s, int d) const {
+        const node_t &n = prb_.nodes[d];
+        switch (s) {
+            case s_in: return n.is * itype_sz_;
+            case s_out: return n.os * otype_sz_;
+            case s_scale: return n.ss * (ptrdiff_t)sizeof(float);
+            case s_comp:
+                return n.cs * simd_w() * (ptrdiff_t)sizeof(int32_t);
+            default: assert(!"unknown stream"); return 0;
+        }
+    }
+
+    /** the points of node 0 in a vector row and the rows in a vector */
+    int row_len() const {
+        return vec_ndims_ == 2 ? (int)prb_.nodes[0].n : simd_w();
+    }
+    int rows() const { return simd_w() / row_len(); }
+
+    /** returns the byte offset of the lane l from the vector start */
+    ptrdiff_t lane_off(int s, int l) const {
+        const ptrdiff_t row_stride = vec_ndims_ == 2 ? stride(s, 1) : 0;
+        const ptrdiff_t comp_slot
+                = s == s_comp ? l * (ptrdiff_t)sizeof(int32_t) : 0;
+        return (l % row_len()) * stride(s, 0) + (l / row_len()) * row_stride
+                + comp_slot;
+    }
+
+    /** returns the step of the stream between two vectors in bytes */
+    ptrdiff_t vec_step(int s) const {
+        return vec_ndims_ == 2 ? rows() * stride(s, 1)
+                               : simd_w() * stride(s, 0);
+    }
+
+    access_t access_init(int s) const {
+        if (!active(s)) return access_t::none;
+        const ptrdiff_t sz = s == s_in ? itype_sz_ : s == s_out ? otype_sz_ : 4;
+        bool contiguous = true, broadcast = true;
+        for (int l = 0; l < simd_w(); ++l) {
+            contiguous = contiguous && lane_off(s, l) == l * sz;
+            broadcast = broadcast && lane_off(s, l) == 0;
+        }
+        if (broadcast && s == s_scale) return access_t::broadcast;
+        return contiguous ? access_t::contiguous : access_t::gather;
+    }
+
+    void dup_imm(const xa::ZRegS &z, int32_t imm) {
+        CG::mov_imm(reg_tmp, imm);
+        CG::dup(z, xa::WReg(reg_tmp.getIdx()));
+    }
+
+    /** z_idx = col * stride(s, 0) + row * stride(s, 1) [+ lane * 4], where
+     * col and row are the position of the lane in the row_len() x rows()
+     * tile */
+    void init_idx(int s) {
+        const xa::ZReg &z = z_idx[s];
+        const xa::ZReg &z_lane = z_data, &z_col = z_aux, &z_row = z_tmp0;
+
+        CG::index(z_lane.s, 0, 1);
+        dup_imm(z_col.s, row_len() - 1);
+        CG::and_(z_col.d, z_lane.d, z_col.d);
+        dup_imm(z.s, (int32_t)stride(s, 0));
+        CG::mul(z.s, p_all, z_col.s);
+        if (vec_ndims_ == 2) {
+            CG::lsr(z_row.s, z_lane.s, math::ilog2q(row_len()));
+            dup_imm(z_tmp1.s, (int32_t)stride(s, 1));
+            CG::mul(z_tmp1.s, p_all, z_row.s);
+            CG::add(z.s, z.s, z_tmp1.s);
+        }
+        if (s == s_comp) {
+            CG::lsl(z_lane.s, z_lane.s, 2);
+            CG::add(z.s, z.s, z_lane.s);
+        }
+    }
+
+#define SVE_LD_ST(insn, z, p, s) \
+    do { \
+        if (access_[s] == access_t::gather) \
+            CG::insn(z, p, xa::ptr(reg_aux[s], z_idx[s].s, xa::SXTW)); \
+        else \
+            CG::insn(z, p, xa::ptr(reg_aux[s])); \
+    } while (0)
+
+    /** loads the stream s of type dt into the s32/f32 lanes of z */
+    void load(const xa::ZReg &z, data_type_t dt, int s, const xa::PReg &p) {
+        switch (dt) {
+            case data_type::f32:
+            case data_type::s32: SVE_LD_ST(ld1w, z.s, p / xa::T_z, s); break;
+            case data_type::bf16: SVE_LD_ST(ld1h, z.s, p / xa::T_z, s); break;
+            case data_type::s8: SVE_LD_ST(ld1sb, z.s, p / xa::T_z, s); break;
+            case data_type::u8: SVE_LD_ST(ld1b, z.s, p / xa::T_z, s); break;
+            default: assert(!"unreachable");
+        }
+    }
+
+    /** stores the s32/f32 lanes of z truncated to the type dt */
+    void store(const xa::ZReg &z, data_type_t dt, int s, const xa::PReg &p) {
+        switch (dt) {
+            case data_type::f32:
+            case data_type::s32: SVE_LD_ST(st1w, z.s, p, s); break;
+            case data_type::bf16: SVE_LD_ST(st1h, z.s, p, s); break;
+            case data_type::s8:
+            case data_type::u8: SVE_LD_ST(st1b, z.s, p, s); break;
+            default: assert(!"unreachable");
+        }
+    }
+
+#undef SVE_LD_ST
+
+    void load_scale(const xa::ZReg &z, const xa::PReg &p) {
+        if (access_[s_scale] == access_t::broadcast)
+            CG::ld1rw(z.s, p, xa::ptr(reg_aux[s_scale]));
+        else
+            load(z, data_type::f32, s_scale, p);
+    }
+
+    void cvt_to_f32(const xa::ZReg &z, data_type_t dt, const xa::PReg &p) {
+        switch (dt) {
+            case data_type::f32: break;
+            case data_type::bf16: CG::lsl(z.s, z.s, 16); break;
+            case data_type::s32:
+            case data_type::s8:
+            case data_type::u8: CG::scvtf(z.s, p / xa::T_m, z.s); break;
+            default: assert(!"unreachable");
+        }
+    }
+
+    /** saturates the s32 lanes of z to the range of the type dt */
+    void saturate(const xa::ZReg &z, data_type_t from, data_type_t dt) {
+        using namespace data_type;
+        if (dt == s8) {
+            if (from == s32) CG::smax(z.s, -128);
+            if (utils::one_of(from, s32, u8)) CG::smin(z.s, 127);
+        } else if (dt == u8) {
+            if (utils::one_of(from, s32, s8)) CG::smax(z.s, 0);
+            if (from == s32) CG::umin(z.s, 255);
+        }
+    }
+
+    /** rounds the f32 lanes of z to bf16 (to nearest even, NaN is kept
+     * quiet), the result is in the lower halves of the lanes */
+    void cvt_f32_bf16(const xa::ZReg &z, const xa::PReg &p) {
+        CG::lsr(z_tmp0.s, z.s, 16);
+        CG::and_(z_tmp0.d, z_tmp0.d, z_one.d);
+        CG::add(z_tmp0.s, z_tmp0.s, z_bf16_round.s);
+        CG::add(z_tmp0.s, z_tmp0.s, z.s);
+        CG::lsr(z_tmp0.s, z_tmp0.s, 16);
+        CG::fcmuo(p_nan.s, p / xa::T_z, z.s, z.s);
+        CG::lsr(z.s, z.s, 16);
+        CG::orr(z.d, z.d, z_bf16_qnan.d);
+        CG::sel(z.s, p_nan, z.s, z_tmp0.s);
+    }
+
+    void cvt_from_f32(const xa::ZReg &z, data_type_t dt, const xa::PReg &p) {
+        switch (dt) {
+            case data_type::f32: break;
+            case data_type::bf16: cvt_f32_bf16(z, p); break;
+            case data_type::s32:
+            case data_type::s8:
+            case data_type::u8:
+                CG::frinti(z.s, p / xa::T_m, z.s);
+                CG::fcvtzs(z.s, p / xa::T_m, z.s);
+                saturate(z, data_type::s32, dt);
+                break;
+            default: assert(!"unreachable");
+        }
+    }
+
+    void vec_step_compute(const xa::PReg &p) {
+        load(z_data, prb_.itype, s_in, p);
+
+        if (saturate_only_) {
+            saturate(z_data, prb_.itype, prb_.otype);
+        } else if (!copy_) {
+            cvt_to_f32(z_data, prb_.itype, p);
+            if (prb_.scale_type == scale_type_t::MANY) {
+                load_scale(z_aux, p);
+                CG::fmul(z_data.s, z_data.s, z_aux.s);
+                if (prb_.scale_adjust != 1.f)
+                    CG::fmul(z_data.s, z_data.s, z_adjust.s);
+            } else if (prb_.scale_type == scale_type_t::COMMON
+                    || prb_.scale_adjust != 1.f) {
+                CG::fmul(z_data.s, z_data.s, z_scale.s);
+            }
+            if (prb_.beta != 0.f) {
+                load(z_aux, prb_.otype, s_out, p);
+                cvt_to_f32(z_aux, prb_.otype, p);
+                CG::fmla(z_data.s, p, z_aux.s, z_beta.s);
+            }
+            cvt_from_f32(z_data, prb_.otype, p);
+        }
+
+        if (prb_.req_s8s8_comp) {
+            load(z_aux, data_type::s32, s_comp, p);
+            CG::add(z_aux.s, z_aux.s, z_data.s);
+            store(z_aux, data_type::s32, s_comp, p);
+        }
+
+        store(z_data, prb_.otype, s_out, p);
+    }
+
+    void vec_loop() {
+        const size_t len = prb_.nodes[vec_ndims_ - 1].n;
+        const size_t n_vecs = len / rows();
+        const bool tail = len % rows() != 0;
+
+        auto advance = [&]() {
+            for (int s = 0; s < n_streams; ++s)
+                if (active(s) && vec_step(s) != 0)
+                    CG::add_imm(reg_aux[s], reg_aux[s], vec_step(s),
+                            reg_tmp_imm);
+        };
+
+        for (int s = 0; s < n_streams; ++s)
+            if (active(s)) CG::mov(reg_aux[s], reg_ptr[s]);
+
+        if (n_vecs > 1) {
+            xa::LabelAArch64 l_vec;
+            CG::mov_imm(reg_vec_loop, n_vecs);
+            CG::L_aarch64(l_vec);
+            vec_step_compute(p_all);
+            advance();
+            CG::subs(reg_vec_loop, reg_vec_loop, 1);
+            CG::b(xa::NE, l_vec);
+        } else if (n_vecs == 1) {
+            vec_step_compute(p_all);
+            if (tail) advance();
+        }
+        if (tail) vec_step_compute(p_tail);
+    }
+
+    void loop(int d) {
+        if (d < vec_ndims_) {
+            vec_loop();
+            return;
+        }
+
+        const reg64_t &reg_cnt = reg_loop[d - vec_ndims_];
+        const bool outermost = d == prb_.ndims - 1;
+        xa::LabelAArch64 l_loop;
+
+        CG::mov_imm(reg_cnt, prb_.nodes[d].n);
+        CG::L_aarch64(l_loop);
+        loop(d - 1);
+        for (int s = 0; s < n_streams; ++s)
+            if (active(s) && stride(s, d) != 0)
+                CG::add_imm(
+                        reg_ptr[s], reg_ptr[s], stride(s, d), reg_tmp_imm);
+        CG::subs(reg_cnt, reg_cnt, 1);
+        CG::b(xa::NE, l_loop);
+
+        if (outermost) return;
+        for (int s = 0; s < n_streams; ++s)
+            if (active(s) && stride(s, d) != 0)
+                CG::sub_imm(reg_ptr[s], reg_ptr[s],
+                        (ptrdiff_t)prb_.nodes[d].n * stride(s, d),
+                        reg_tmp_imm);
+    }
+
+    void generate() {
+#define GET_OFF(x) static_cast<int32_t>(offsetof(call_param_t, x))
+        preamble();
+
+        CG::ptrue(p_all.b);
+        const int tail = (int)(prb_.nodes[vec_ndims_ - 1].n % rows());
+        if (tail) {
+            CG::mov_imm(reg_tmp_imm, 0);
+            CG::mov_imm(reg_tmp, tail * row_len());
+            CG::whilelt(p_tail.s, reg_tmp_imm, reg_tmp);
+        }
+
+        CG::ldr(reg_ptr[s_in], xa::ptr(abi_param1_aarch64, GET_OFF(in)));
+        CG::ldr(reg_ptr[s_out], xa::ptr(abi_param1_aarch64, GET_OFF(out)));
+        if (prb_.scale_type != scale_type_t::NONE)
+            CG::ldr(reg_ptr[s_scale],
+                    xa::ptr(abi_param1_aarch64, GET_OFF(scale)));
+        if (prb_.req_s8s8_comp)
+            CG::ldr(reg_ptr[s_comp],
+                    xa::ptr(abi_param1_aarch64, GET_OFF(comp)));
+#undef GET_OFF
+
+        /* z_scale holds the whole scale unless it differs between lanes */
+        if (prb_.scale_adjust != 1.f)
+            dup_imm(z_adjust.s, float2int(prb_.scale_adjust));
+        if (prb_.scale_type == scale_type_t::COMMON) {
+            CG::ld1rw(z_scale.s, p_all, xa::ptr(reg_ptr[s_scale]));
+            if (prb_.scale_adjust != 1.f)
+                CG::fmul(z_scale.s, z_scale.s, z_adjust.s);
+        } else if (prb_.scale_type == scale_type_t::NONE
+                && prb_.scale_adjust != 1.f) {
+            dup_imm(z_scale.s, float2int(prb_.scale_adjust));
+        }
+        if (prb_.beta != 0.f) dup_imm(z_beta.s, float2int(prb_.beta));
+        if (prb_.otype == data_type::bf16 && !copy_) {
+            CG::dup(z_one.s, 1);
+            dup_imm(z_bf16_round.s, 0x7fff);
+            CG::dup(z_bf16_qnan.s, 0x40);
+        }
+
+        for (int s = 0; s < n_streams; ++s)
+            if (access_[s] == access_t::gather) init_idx(s);
+
+        loop(prb_.ndims - 1);
+
+        postamble();
+    }
+};
+
 status_t kernel_t::desc_init(
         kernel_t::desc_t &desc, const prb_t &prb, int ndims_ker_max) {
     desc.prb = prb;
@@ -2130,11 +2567,20 @@ status_t kernel_t::desc_init(
 
     /* traverse through kernel implementations */
     /* TODO: find a better way to do that... */
-    desc.id = 0;
+    /* the translated kernel is kept for the f32 copies it always did, the
+     * conversions go to the native one */
+    const bool f32_copy = !prb.req_s8s8_comp
+            && utils::everyone_is(data_type::f32, prb.itype, prb.otype);
     for (int ndims_ker = ndims_ker_max; ndims_ker > 0; --ndims_ker) {
         desc.prb.ndims = ndims_ker;
-        if (jit_uni_reorder_kernel_f32::applicable(desc.prb))
+        if (f32_copy && jit_uni_reorder_kernel_f32::applicable(desc.prb)) {
+            desc.id = 0;
             return status::success;
+        }
+        if (jit_sve_reorder_kernel_t::applicable(desc.prb)) {
+            desc.id = 1;
+            return status::success;
+        }
     }
 
     return status::unimplemented;
@@ -2143,6 +2589,7 @@ status_t kernel_t::desc_init(
 kernel_t *kernel_t::create(const kernel_t::desc_t &desc) {
     switch (desc.id) {
         case 0: return new jit_uni_reorder_kernel_f32(desc);
+        case 1: return new jit_sve_reorder_kernel_t(desc);
         default: assert(!"unknown kernel id"); return nullptr;
     }
 
@@ -2151,13 +2598,44 @@ kernel_t *kernel_t::create(const kernel_t::desc_t &desc) {
 
 } // namespace tr
 
+/** returns the number of elements of the problem in a cache line (A64FX has
+ * 256-byte lines), counted for the wider of the two data types */
+static int cache_line_elems(const tr::prb_t &prb) {
+    const size_t line_sz = mayiuse(sve) ? 256 : platform::get_cache_line_size();
+    const size_t dt_sz = nstl::max(types::data_type_size(prb.itype),
+            types::data_type_size(prb.otype));
+    return (int)(line_sz / dt_sz);
+}
+
+/** returns the number of threads worth to use for the problem, so that every
+ * thread moves at least a half of the L1 data cache (a fork-join of the whole
+ * team costs more than a small reorder itself) */
+static int prb_nthr(const tr::prb_t &prb) {
+    size_t sz_total = 1;
+    for (int d = 0; d < prb.ndims; ++d)
+        sz_total *= prb.nodes[d].n;
+    const size_t bytes_total = sz_total
+            * (types::data_type_size(prb.itype)
+                    + types::data_type_size(prb.otype));
+    const size_t bytes_thr_min = nstl::max<size_t>(
+            platform::get_A64FX_cache_size(1, true, 1) / 2, 1);
+    return (int)nstl::max<size_t>(1,
+            nstl::min<size_t>(dnnl_get_max_threads(),
+                    utils::div_up(bytes_total, bytes_thr_min)));
+}
+
 static void prb_block_for_cache(tr::prb_t &prb) {
+    /* blk -- elements in a cache line, strides that are a multiple of
+     * 4 * blk map to the same cache sets */
+    const int blk = cache_line_elems(prb);
+    const ptrdiff_t set_stride = 4 * blk;
+
     /* If strides for 0th and 1st nodes are cache friendly
      * then one can altogether do away with blocking ! */
     const bool cache_blocking_needed = false
-            || (prb.nodes[0].is % 64 == 0 && prb.nodes[0].n > 16)
-            || (prb.ndims > 1 && prb.nodes[1].is % 64 == 0
-                    && prb.nodes[1].n > 16);
+            || (prb.nodes[0].is % set_stride == 0 && prb.nodes[0].n > blk)
+            || (prb.ndims > 1 && prb.nodes[1].is % set_stride == 0
+                    && prb.nodes[1].n > blk);
     if (!cache_blocking_needed) return;
 
     int unit_input_stride_idx = -1;
@@ -2166,16 +2644,16 @@ static void prb_block_for_cache(tr::prb_t &prb) {
     }
 
     /* Re-prioritize the sequential read over sequential write:
-     *                             /-> [n0:is0:1][16n1:1:osk]...
+     *                             /-> [n0:is0:1][blk n1:1:osk]...
      * [n0:is0:1]...[nk:1:osk] -->     or
-     *                             \-> [16n1:1:osk][n0:is0:1]... */
+     *                             \-> [blk n1:1:osk][n0:is0:1]... */
     if (unit_input_stride_idx != -1) {
         const auto output_stride = prb.nodes[unit_input_stride_idx].os;
         const auto num_elems = prb.nodes[unit_input_stride_idx].n;
 
-        const bool split_needed = (num_elems > 16) && (num_elems % 16 == 0);
+        const bool split_needed = (num_elems > blk) && (num_elems % blk == 0);
         const int move_location = (output_stride % 4 != 0) ? 0 : 1;
-        if (split_needed) prb_node_split(prb, unit_input_stride_idx, 16);
+        if (split_needed) prb_node_split(prb, unit_input_stride_idx, blk);
 
         /* Because of cache-unfriendly nature of unit-output stride node, let
          * us move unit-input stride node on or near front! */
@@ -2184,16 +2662,17 @@ static void prb_block_for_cache(tr::prb_t &prb) {
 
     /* Potentially, split the node with os=1 in two and pull in the node with
      * is=1 between them for better cache reuse:
-     * [n0:is0:1][n1:1:os1] --> [16n0:is0:1][n1:1:os1][n0/16:is0*16:16] */
+     * [n0:is0:1][n1:1:os1] --> [blk n0:is0:1][n1:1:os1][n0/blk:is0*blk:blk]
+     */
     if (prb.ndims >= 2 && prb.nodes[0].os == 1 && prb.nodes[1].is == 1) {
         const auto input_stride = prb.nodes[0].is;
         const auto num_elems = prb.nodes[0].n;
 
-        const bool split_needed = true && (num_elems > 16)
-                && (num_elems % 16 == 0) && (input_stride >= 256)
-                && (input_stride % 64 == 0);
+        const bool split_needed = true && (num_elems > blk)
+                && (num_elems % blk == 0) && (input_stride >= 4 * set_stride)
+                && (input_stride % set_stride == 0);
         if (split_needed) {
-            prb_node_split(prb, 0, 16);
+            prb_node_split(prb, 0, blk);
             prb_node_move(prb, 1, 2);
         }
     }
@@ -2317,7 +2796,7 @@ struct jit_uni_reorder_t : public primitive_t {
             });
 
             int ndims_ker_max;
-            int nthr = dnnl_get_max_threads();
+            int nthr = prb_nthr(prb);
             prb_thread_kernel_balance(prb, ndims_ker_max, nthr);
 
             tr::kernel_t::desc_t ker_desc;
@@ -2343,42 +2822,63 @@ struct jit_uni_reorder_t : public primitive_t {
             }
             _pd->prb_ = prb;
             _pd->ker_desc_ = ker_desc;
-            _pd->init_scratchpad_md();
             _pd->nthr_ = nthr;
+            _pd->init_scratchpad();
+            _pd->init_scratchpad_md();
             return safe_ptr_assign<reorder_pd_t>(*reorder_pd, _pd);
         }
 
+        /** number of int32 compensation points appended to the output */
+        size_t comp_size() const {
+            return memory_desc_wrapper(dst_md()).additional_buffer_size()
+                    / sizeof(int32_t);
+        }
+
         tr::prb_t prb_;
         tr::kernel_t::desc_t ker_desc_;
         int nthr_;
+
+    private:
+        /* every thread accumulates the compensation in its own buffer with
+         * comp_lanes() slots per point */
+        void init_scratchpad() {
+            if (!prb_.req_s8s8_comp) return;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book<int32_t>(
+                    memory_tracking::names::key_reorder_space,
+                    nthr_ * comp_size() * comp_lanes());
+        }
     };
 
+    static int comp_lanes() { return tr::jit_sve_reorder_kernel_t::simd_w(); }
+
     jit_uni_reorder_t(const pd_t *apd) : primitive_t(apd) {
         kernel_ = tr::kernel_t::create(pd()->ker_desc_);
         assert(kernel_);
     }
     ~jit_uni_reorder_t() { delete kernel_; }
 
-    void omp_driver_0d(
-            int off, const char *in, char *out, const float *scale) const {
-        tr::call_param_t c {in, out, scale};
+    void omp_driver_0d(int off, const char *in, char *out, const float *scale,
+            int32_t *comp) const {
+        tr::call_param_t c {in, out, scale, comp};
         (*kernel_)(&c);
     }
 
     void omp_driver_1d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[0].n, [&](ptrdiff_t d0) {
             auto c = tr::call_param_t();
             c.in = in + d0 * ns[0].is * data_type_size(pd()->prb_.itype);
             c.out = out + d0 * ns[0].os * data_type_size(pd()->prb_.otype);
             c.scale = scale + d0 * ns[0].ss;
+            c.comp = comp + d0 * ns[0].cs * comp_lanes();
             (*kernel_)(&c);
         });
     }
 
     void omp_driver_2d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
                 [&](ptrdiff_t d1, ptrdiff_t d0) {
@@ -2390,12 +2890,14 @@ struct jit_uni_reorder_t : public primitive_t {
                             + (d0 * ns[0].os + d1 * ns[1].os)
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss;
+                    c.comp = comp
+                            + (d0 * ns[0].cs + d1 * ns[1].cs) * comp_lanes();
                     (*kernel_)(&c);
                 });
     }
 
     void omp_driver_3d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[2].n, (ptrdiff_t)ns[1].n,
                 (ptrdiff_t)ns[0].n,
@@ -2409,12 +2911,15 @@ struct jit_uni_reorder_t : public primitive_t {
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss
                             + d2 * ns[2].ss;
+                    c.comp = comp
+                            + (d0 * ns[0].cs + d1 * ns[1].cs + d2 * ns[2].cs)
+                                    * comp_lanes();
                     (*kernel_)(&c);
                 });
     }
 
     void omp_driver_4d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[3].n, (ptrdiff_t)ns[2].n,
                 (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
@@ -2430,11 +2935,16 @@ struct jit_uni_reorder_t : public primitive_t {
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss
                             + d2 * ns[2].ss + d3 * ns[3].ss;
+                    c.comp = comp
+                            + (d0 * ns[0].cs + d1 * ns[1].cs + d2 * ns[2].cs
+                                      + d3 * ns[3].cs)
+                                    * comp_lanes();
                     (*kernel_)(&c);
                 });
     }
 
-    void omp_driver(const char *in, char *out, const float *scale) const {
+    void omp_driver(const char *in, char *out, const float *scale,
+            int32_t *comp) const {
         in += pd()->prb_.ioff * data_type_size(pd()->prb_.itype);
         out += pd()->prb_.ooff * data_type_size(pd()->prb_.otype);
 
@@ -2451,22 +2961,26 @@ struct jit_uni_reorder_t : public primitive_t {
         int ndims_ker = pd()->ker_desc_.prb.ndims;
         assert(ndims - ndims_ker <= ndims_driver_max);
 
+        /* comp is the compensation buffer of the thread */
+        const size_t comp_thr_sz = comp ? pd()->comp_size() * comp_lanes() : 0;
+
         if (ndims - ndims_ker == 0) {
-            omp_driver_0d(ndims_ker, in, out, scale);
+            omp_driver_0d(ndims_ker, in, out, scale, comp);
         } else {
             parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+                int32_t *c = comp + ithr * comp_thr_sz;
                 switch (ndims - ndims_ker) {
                     case 1:
-                        omp_driver_1d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_1d(ithr, nthr, ndims_ker, in, out, scale, c);
                         break;
                     case 2:
-                        omp_driver_2d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_2d(ithr, nthr, ndims_ker, in, out, scale, c);
                         break;
                     case 3:
-                        omp_driver_3d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_3d(ithr, nthr, ndims_ker, in, out, scale, c);
                         break;
                     case 4:
-                        omp_driver_4d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_4d(ithr, nthr, ndims_ker, in, out, scale, c);
                         break;
                     default: assert(!"unimplemented");
                 }
@@ -2479,11 +2993,39 @@ struct jit_uni_reorder_t : public primitive_t {
         auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
         DEFINE_SCALES_BUFFER(scales);
 
-        omp_driver(in, out, scales);
+        int32_t *comp = nullptr;
+        if (pd()->prb_.req_s8s8_comp) {
+            comp = ctx.get_scratchpad_grantor().get<int32_t>(
+                    memory_tracking::names::key_reorder_space);
+            const dim_t comp_sz
+                    = pd()->nthr_ * pd()->comp_size() * comp_lanes();
+            parallel_nd(comp_sz, [&](dim_t i) { comp[i] = 0; });
+        }
+
+        omp_driver(in, out, scales, comp);
+
+        if (comp) reduce_compensation(out, comp);
 
         return status::success;
     }
 
+    /** writes -128 * (sum of the slots of all threads) behind the weights */
+    void reduce_compensation(char *out, const int32_t *comp) const {
+        const memory_desc_wrapper od(pd()->dst_md());
+        int32_t *cp = reinterpret_cast<int32_t *>(
+                out + od.size() - od.additional_buffer_size());
+        const dim_t comp_sz = pd()->comp_size();
+        const int nthr = pd()->nthr_;
+        const int lanes = comp_lanes();
+        parallel_nd(comp_sz, [&](dim_t i) {
+            int32_t acc = 0;
+            for_(int ithr = 0; ithr < nthr; ++ithr)
+            for (int l = 0; l < lanes; ++l)
+                acc += comp[(ithr * comp_sz + i) * lanes + l];
+            cp[i] = -128 * acc;
+        });
+    }
+
     enum { ndims_driver_max = 4 };
 
 private:
@@ -38,6 +38,7 @@ struct node_t {
     ptrdiff_t is; // input stride
     ptrdiff_t os; // output stride
     ptrdiff_t ss; // scale stride
+    ptrdiff_t cs; // compensation stride
 };
 
 enum class scale_type_t { NONE, COMMON, MANY };
@@ -51,6 +52,8 @@ struct prb_t {
     ptrdiff_t ooff;
     scale_type_t scale_type;
     float beta;
+    bool req_s8s8_comp; // s8s8 convolution compensation is appended
+    float scale_adjust; // applied on top of the output scales
 };
 
 status_t prb_init(prb_t &prb, const memory_desc_t &imd,
@@ -81,6 +84,7 @@ struct call_param_t {
     const void *in;
     void *out;
     const float *scale;
+    int32_t *comp;
 };
 
 struct kernel_t {
@@ -110,6 +110,24 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             && check_post_ops(attr);
     if (!ok) return unimplemented;
 
+    /* the only extra data the reorder appends is the s8s8 compensation */
+    const auto &extra = om_d.extra();
+    const bool req_comp
+            = extra.flags & memory_extra_flags::compensation_conv_s8s8;
+    ok = (extra.flags
+                 & ~(memory_extra_flags::compensation_conv_s8s8
+                         | memory_extra_flags::scale_adjust))
+                    == 0
+            && IMPLICATION(extra.flags & memory_extra_flags::scale_adjust,
+                    req_comp)
+            && IMPLICATION(req_comp,
+                    utils::one_of(im_d.data_type(), data_type::f32,
+                            data_type::s8)
+                            && om_d.data_type() == data_type::s8
+                            && om_d.offset0() == 0
+                            && attr->post_ops_.len() == 0);
+    if (!ok) return unimplemented;
+
     dims_t iblocks, oblocks;
     im_d.compute_blocks(iblocks);
     om_d.compute_blocks(oblocks);
@@ -149,6 +167,17 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
         }
     }
 
+    ptrdiff_t cs[max_ndims] = {0};
+    if (req_comp) {
+        ptrdiff_t last_cs = 1;
+        for (int d = old.ndims - 1; d >= 0; --d) {
+            if (extra.compensation_mask & (1 << old.id[d])) {
+                cs[d] = last_cs;
+                last_cs *= old.dims[d];
+            }
+        }
+    }
+
     int ndims = 0;
 
     int i_pos = 0; /* state for input  -- current dimension */
@@ -166,6 +195,7 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             p.nodes[ndims].is = ild.strides[i_pos];
             p.nodes[ndims].os = old.strides[o_pos];
             p.nodes[ndims].ss = ss[o_pos];
+            p.nodes[ndims].cs = cs[o_pos];
             ++ndims;
             ++i_pos;
             ++o_pos;
@@ -176,6 +206,7 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             p.nodes[ndims].is = ild.strides[i_pos];
             p.nodes[ndims].os = old.strides[o_pos] * factor;
             p.nodes[ndims].ss = ss[o_pos] * factor;
+            p.nodes[ndims].cs = cs[o_pos] * factor;
             ++ndims;
             ++i_pos;
             old.dims[o_pos] = factor;
@@ -186,6 +217,7 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             p.nodes[ndims].is = ild.strides[i_pos] * factor;
             p.nodes[ndims].os = old.strides[o_pos];
             p.nodes[ndims].ss = ss[o_pos];
+            p.nodes[ndims].cs = cs[o_pos];
             ++ndims;
             ++o_pos;
             ild.dims[i_pos] = factor;
@@ -199,6 +231,11 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
     const int sum_idx = attr->post_ops_.find(primitive_kind::sum);
     p.beta = sum_idx == -1 ? 0.f : attr->post_ops_.entry_[sum_idx].sum.scale;
 
+    p.req_s8s8_comp = req_comp;
+    p.scale_adjust = (extra.flags & memory_extra_flags::scale_adjust)
+            ? extra.scale_adjust
+            : 1.f;
+
     return success;
 }
 
@@ -231,7 +268,9 @@ void prb_simplify(prb_t &p) {
                         && next_node.is == (ptrdiff_t)this_node.n * this_node.is
                         && next_node.os == (ptrdiff_t)this_node.n * this_node.os
                         && next_node.ss
-                                == (ptrdiff_t)this_node.n * this_node.ss);
+                                == (ptrdiff_t)this_node.n * this_node.ss
+                        && next_node.cs
+                                == (ptrdiff_t)this_node.n * this_node.cs);
         if (fold) {
             this_node.n *= next_node.n;
             for (int j = d + 2; j < p.ndims; ++j)
@@ -259,6 +298,7 @@ void prb_node_split(prb_t &p, int dim, size_t n1) {
     p.nodes[dim + 1].is = p.nodes[dim].is * n1;
     p.nodes[dim + 1].os = p.nodes[dim].os * n1;
     p.nodes[dim + 1].ss = p.nodes[dim].ss * n1;
+    p.nodes[dim + 1].cs = p.nodes[dim].cs * n1;
 
     p.nodes[dim].n = n1;
 }
@@ -296,8 +336,8 @@ void prb_dump(const prb_t &p) {
     printf("@@@ type:%s:%s ndims:%d ", dnnl_dt2str(p.itype),
             dnnl_dt2str(p.otype), p.ndims);
     for (int d = 0; d < p.ndims; ++d)
-        printf("[%zu:%td:%td:%td]", p.nodes[d].n, p.nodes[d].is, p.nodes[d].os,
-                p.nodes[d].ss);
+        printf("[%zu:%td:%td:%td:%td]", p.nodes[d].n, p.nodes[d].is,
+                p.nodes[d].os, p.nodes[d].ss, p.nodes[d].cs);
     printf(" off:%zu:%zu\n", p.ioff, p.ooff);
 }
 
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/aarch64/matmul/jit_sve_512_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+// Returns true if the innermost dimension of a plain md is dense, and sets
+// is_trans if the two innermost dimensions are swapped instead.
+bool check_plain_layout(const memory_desc_t &md, bool &is_trans) {
+    if (md.format_kind != format_kind::blocked
+            || md.format_desc.blocking.inner_nblks != 0)
+        return false;
+    const dims_t &strides = md.format_desc.blocking.strides;
+    const int ndims = md.ndims;
+    is_trans = strides[ndims - 1] != 1;
+    return IMPLICATION(is_trans, strides[ndims - 2] == 1);
+}
+} // namespace
+
+status_t jit_sve_512_matmul_t::pd_t::init(engine_t *engine) {
+    auto check_bias = [&]() -> bool {
+        return !with_bias()
+                || (weights_md(1)->data_type == f32 && is_bias_1xN());
+    };
+
+    bool ok = mayiuse_sve_any_vl() && !has_zero_dim_memory()
+            && everyone_is(f32, src_md()->data_type, weights_md()->data_type,
+                    dst_md()->data_type, desc()->accum_data_type)
+            && check_bias()
+            && attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::oscale_runtime
+                    | primitive_attr_t::skip_mask_t::post_ops);
+    if (!ok) return status::unimplemented;
+
+    CHECK(check_and_configure_attributes());
+
+    if (!set_default_formats()) return status::unimplemented;
+
+    bool dst_trans = false;
+    ok = check_plain_layout(src_md_, trans_a_)
+            && check_plain_layout(weights_md_, trans_b_)
+            && check_plain_layout(dst_md_, dst_trans) && !dst_trans
+            && IMPLICATION(with_bias(),
+                    check_plain_layout(bias_md_, dst_trans) && !dst_trans)
+            // the packed buffers are booked for a known K
+            && IMPLICATION(trans_a_ || trans_b_, !is_runtime_value(K()));
+    if (!ok) return status::unimplemented;
+
+    nthr_ = dnnl_get_max_threads();
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t jit_sve_512_matmul_t::pd_t::check_and_configure_attributes() {
+    const auto &oscale = attr()->output_scales_;
+    if (!one_of(oscale.mask_, 0, 1 << (ndims() - 1)))
+        return status::unimplemented;
+
+    /* Post-ops: sum, eltwise or sum -> eltwise */
+    const auto &p = attr()->post_ops_;
+    const int sum_ind = p.find(primitive_kind::sum);
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    bool post_ops_ok = false;
+    switch (p.len()) {
+        case 0: post_ops_ok = true; break;
+        case 1: post_ops_ok = sum_ind == 0 || eltwise_ind == 0; break;
+        case 2: post_ops_ok = sum_ind == 0 && eltwise_ind == 1; break;
+        default: break;
+    }
+    if (!post_ops_ok) return status::unimplemented;
+
+    jcp_ = zero<decltype(jcp_)>();
+    jcp_.with_bias = with_bias();
+    if (oscale.mask_ != 0)
+        jcp_.oscale = oscale_per_n;
+    else if (!oscale.defined() || oscale.scales_[0] != 1.f)
+        jcp_.oscale = oscale_common;
+    else
+        jcp_.oscale = oscale_none;
+    jcp_.with_sum = sum_ind != -1;
+    jcp_.sum_scale = jcp_.with_sum ? p.entry_[sum_ind].sum.scale : 0.f;
+    jcp_.with_eltwise = eltwise_ind != -1;
+    if (jcp_.with_eltwise) {
+        jcp_.eltwise = p.entry_[eltwise_ind].eltwise;
+        if (jcp_.eltwise.alg == alg_kind::eltwise_pow)
+            return status::unimplemented;
+        // The kernel follows the vector length, the eltwise injector only
+        // for its native algorithms.
+        if (get_sve_length() != cpu_isa_traits<sve>::vlen
+                && !jit_uni_eltwise_injector_f32<
+                        avx512_common>::is_vl_agnostic(jcp_.eltwise.alg))
+            return status::unimplemented;
+    }
+
+    return status::success;
+}
+
+void jit_sve_512_matmul_t::pd_t::init_scratchpad() {
+    using kernel_t = jit_sve_512_matmul_kernel;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    if (trans_a_)
+        scratchpad.book(key_matmul_src_trans,
+                (size_t)nthr_ * max_m_block * K(), sizeof(float));
+    if (trans_b_)
+        scratchpad.book(key_matmul_wei_trans,
+                (size_t)nthr_ * K() * kernel_t::n_block(), sizeof(float));
+}
+
+status_t jit_sve_512_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
+    using kernel_t = jit_sve_512_matmul_kernel;
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
+    const auto bias_d = ctx.memory_mdw(DNNL_ARG_BIAS, pd()->weights_md(1));
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+
+    // apply offset0, since offsets are computed directly (not via mdw.off())
+    src += src_d.offset0();
+    weights += weights_d.offset0();
+    if (bias) bias += bias_d.offset0();
+    dst += dst_d.offset0();
+
+    const bool batched = pd()->batched();
+    const bool trans_a = pd()->trans_a_;
+    const bool trans_b = pd()->trans_b_;
+    const bool per_n_scales = pd()->jcp_.oscale == oscale_per_n;
+
+    const dim_t M = dst_d.dims()[batched + 0];
+    const dim_t N = dst_d.dims()[batched + 1];
+    const dim_t K = src_d.dims()[batched + 1];
+    const dim_t batch = batched ? dst_d.dims()[0] : 1;
+
+    const auto &src_strides = &src_d.blocking_desc().strides[batched];
+    const auto &weights_strides = &weights_d.blocking_desc().strides[batched];
+    const dim_t lda = src_strides[trans_a ? 1 : 0];
+    const dim_t ldb = weights_strides[trans_b ? 1 : 0];
+    const dim_t ldc = dst_d.blocking_desc().strides[batched + 0];
+
+    // Batch strides are taken from the memory descriptors, so a zero stride
+    // broadcasts an operand over the batch.
+    const dim_t src_batch_stride
+            = batched ? src_d.blocking_desc().strides[0] : 0;
+    const dim_t weights_batch_stride
+            = batched ? weights_d.blocking_desc().strides[0] : 0;
+    const dim_t dst_batch_stride
+            = batched ? dst_d.blocking_desc().strides[0] : 0;
+
+    const dim_t n_block = kernel_t::n_block();
+    const dim_t n_chunks = div_up(N, n_block);
+
+    // Split the rows so that every thread gets work when batch * N is small.
+    const dim_t mn_work = batch * n_chunks;
+    const dim_t m_chunks_min
+            = nstl::max((dim_t)1, div_up((dim_t)pd()->nthr_, mn_work));
+    dim_t m_block = nstl::min(rnd_up(div_up(M, m_chunks_min), kernel_t::ur_m),
+            (dim_t)pd_t::max_m_block);
+    m_block = nstl::max(m_block, (dim_t)kernel_t::ur_m);
+    const dim_t m_chunks = div_up(M, m_block);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *a_pack_base
+            = trans_a ? scratchpad.get<float>(key_matmul_src_trans) : nullptr;
+    float *b_pack_base
+            = trans_b ? scratchpad.get<float>(key_matmul_wei_trans) : nullptr;
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        size_t start {0}, end {0};
+        balance211((size_t)mn_work * m_chunks, nthr, ithr, start, end);
+
+        float *a_pack = trans_a
+                ? a_pack_base + (size_t)ithr * pd_t::max_m_block * K
+                : nullptr;
+        float *b_pack
+                = trans_b ? b_pack_base + (size_t)ithr * K * n_block : nullptr;
+        dim_t b_packed = -1, nc_packed = -1;
+
+        // Row chunks are the inner dimension, so consecutive work items of a
+        // thread reuse the same (packed) B columns.
+        dim_t b {0}, nc {0}, mc {0};
+        nd_iterator_init(start, b, batch, nc, n_chunks, mc, m_chunks);
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const dim_t m = mc * m_block;
+            const dim_t n = nc * n_block;
+
+            jit_matmul_call_s p;
+            p.m = nstl::min(m_block, M - m);
+            p.n = nstl::min(n_block, N - n);
+            p.k = K;
+
+            const float *a = src + b * src_batch_stride;
+            if (trans_a) {
+                for (size_t i = 0; i < p.m; i++)
+                    for (dim_t k = 0; k < K; k++)
+                        a_pack[i * K + k] = a[(m + i) + k * lda];
+                p.a = a_pack;
+                p.lda = K * sizeof(float);
+            } else {
+                p.a = a + m * lda;
+                p.lda = lda * sizeof(float);
+            }
+
+            const float *w = weights + b * weights_batch_stride;
+            if (trans_b) {
+                if (b != b_packed || nc != nc_packed) {
+                    for (dim_t k = 0; k < K; k++)
+                        for (size_t j = 0; j < p.n; j++)
+                            b_pack[k * n_block + j] = w[(n + j) * ldb + k];
+                    b_packed = b;
+                    nc_packed = nc;
+                }
+                p.b = b_pack;
+                p.ldb = n_block * sizeof(float);
+            } else {
+                p.b = w + n;
+                p.ldb = ldb * sizeof(float);
+            }
+
+            p.c = dst + b * dst_batch_stride + m * ldc + n;
+            p.ldc = ldc * sizeof(float);
+            p.bias = bias ? bias + n : nullptr;
+            p.scales = scales + (per_n_scales ? n : 0);
+
+            (*kernel_)(&p);
+
+            nd_iterator_step(b, batch, nc, n_chunks, mc, m_chunks);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
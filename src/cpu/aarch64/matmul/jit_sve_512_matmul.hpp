@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_MATMUL_JIT_SVE_512_MATMUL_HPP
+#define CPU_AARCH64_MATMUL_JIT_SVE_512_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/matmul/jit_sve_512_matmul_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+// f32 matmul on a single JIT kernel. M, N, K and the leading dimensions may
+// be runtime values. A transposed source or weights tensor is packed to the
+// row-major layout expected by the kernel, which requires K to be known at
+// creation time.
+struct jit_sve_512_matmul_t : public primitive_t {
+    struct pd_t : public cpu::matmul::cpu_matmul_pd_t {
+        using cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", sve, ""),
+                jit_sve_512_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Rows of C processed by a work item, also the number of rows of a
+        // packed source buffer.
+        enum { max_m_block = 96 };
+
+        jit_matmul_conf_t jcp_;
+        bool trans_a_;
+        bool trans_b_;
+        int nthr_;
+
+    private:
+        status_t check_and_configure_attributes();
+        void init_scratchpad();
+    };
+
+    jit_sve_512_matmul_t(const pd_t *apd)
+        : primitive_t(apd)
+        , kernel_(new jit_sve_512_matmul_kernel(pd()->jcp_)) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_sve_512_matmul_kernel> kernel_;
+};
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/matmul/jit_sve_512_matmul_kernel.hpp"
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(jit_matmul_call_s, field))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+void jit_sve_512_matmul_kernel::fma_step(int ur, int uk) {
+    for (int j = 0; j < nb_; j++)
+        CGA64::ld1w(zreg_b_s(j), p_col(j) / xa::T_z,
+                xa::ptr(reg_b_row, static_cast<int32_t>(j), xa::MUL_VL));
+    CGA64::add(reg_b_row, reg_b_row, reg_ldb);
+
+    for (int i = 0; i < ur; i++) {
+        CGA64::ld1rw(zreg_a_s(i), reg_p_all_ones,
+                xa::ptr(reg_a_row[i], static_cast<int32_t>(uk * typesize)));
+        for (int j = 0; j < nb_; j++)
+            CGA64::fmla(zreg_acc_s(i, j), reg_p_all_ones, zreg_b_s(j),
+                    zreg_a_s(i));
+    }
+}
+
+void jit_sve_512_matmul_kernel::k_loop(int ur) {
+    auto advance = [=](int nk) {
+        for (int i = 0; i < ur; i++)
+            CGA64::add_imm(reg_a_row[i], reg_a_row[i], nk * typesize,
+                    reg_tmp_imm);
+        CGA64::sub_imm(reg_kk, reg_kk, nk, reg_tmp_imm);
+    };
+
+    xa::LabelAArch64 k_loop_main, k_loop_tail, k_loop_end;
+
+    CGA64::ldr(reg_kk, xa::ptr(reg_param, GET_OFF(k)));
+    CGA64::cmp_imm(reg_kk, unroll_k, reg_tmp_imm);
+    CGA64::b(xa::LT, k_loop_tail);
+
+    CGA64::L_aarch64(k_loop_main);
+    {
+        for (int uk = 0; uk < unroll_k; uk++)
+            fma_step(ur, uk);
+        advance(unroll_k);
+        CGA64::cmp_imm(reg_kk, unroll_k, reg_tmp_imm);
+        CGA64::b(xa::GE, k_loop_main);
+    }
+
+    CGA64::L_aarch64(k_loop_tail);
+    {
+        CGA64::cmp(reg_kk, 0);
+        CGA64::b(xa::LE, k_loop_end);
+        fma_step(ur, 0);
+        advance(1);
+        CGA64::b(k_loop_tail);
+    }
+
+    CGA64::L_aarch64(k_loop_end);
+}
+
+void jit_sve_512_matmul_kernel::store_tile(int ur) {
+    // The A and B registers are free after the k-loop: B holds the bias and
+    // the per-N scales, A the common scale, the sum scale and the old C.
+    const xa::ZRegS zreg_scale = zreg_a_s(0);
+    const xa::ZRegS zreg_c_old = zreg_a_s(1);
+    const xa::ZRegS zreg_sum_scale = zreg_tmp_s();
+
+    if (jcp.with_bias) {
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(bias)));
+        for (int j = 0; j < nb_; j++)
+            CGA64::ld1w(zreg_b_s(j), p_col(j) / xa::T_z,
+                    xa::ptr(reg_tmp, static_cast<int32_t>(j), xa::MUL_VL));
+        for (int i = 0; i < ur; i++)
+            for (int j = 0; j < nb_; j++)
+                CGA64::fadd(zreg_acc_s(i, j), zreg_acc_s(i, j), zreg_b_s(j));
+    }
+
+    if (jcp.oscale != oscale_none) {
+        CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(scales)));
+        if (jcp.oscale == oscale_common)
+            CGA64::ld1rw(zreg_scale, reg_p_all_ones, xa::ptr(reg_tmp));
+        else
+            for (int j = 0; j < nb_; j++)
+                CGA64::ld1w(zreg_b_s(j), p_col(j) / xa::T_z,
+                        xa::ptr(reg_tmp, static_cast<int32_t>(j), xa::MUL_VL));
+        for (int i = 0; i < ur; i++)
+            for (int j = 0; j < nb_; j++)
+                CGA64::fmul(zreg_acc_s(i, j), zreg_acc_s(i, j),
+                        jcp.oscale == oscale_common ? zreg_scale
+                                                    : zreg_b_s(j));
+    }
+
+    if (jcp.with_sum) {
+        CGA64::mov_imm(reg_tmp, float2int(jcp.sum_scale));
+        CGA64::dup(zreg_sum_scale, xa::WReg(reg_tmp.getIdx()));
+        CGA64::mov(reg_c_row, reg_c);
+        for (int i = 0; i < ur; i++) {
+            for (int j = 0; j < nb_; j++) {
+                CGA64::ld1w(zreg_c_old, p_col(j) / xa::T_z,
+                        xa::ptr(reg_c_row, static_cast<int32_t>(j),
+                                xa::MUL_VL));
+                CGA64::fmla(zreg_acc_s(i, j), reg_p_all_ones, zreg_c_old,
+                        zreg_sum_scale);
+            }
+            CGA64::add(reg_c_row, reg_c_row, reg_ldc);
+        }
+    }
+
+    if (jcp.with_eltwise)
+        eltwise_injector_->compute_vector_range(0, ur * nb_);
+
+    CGA64::mov(reg_c_row, reg_c);
+    for (int i = 0; i < ur; i++) {
+        for (int j = 0; j < nb_; j++)
+            CGA64::st1w(zreg_acc_s(i, j), p_col(j),
+                    xa::ptr(reg_c_row, static_cast<int32_t>(j), xa::MUL_VL));
+        if (i < ur - 1) CGA64::add(reg_c_row, reg_c_row, reg_ldc);
+    }
+}
+
+void jit_sve_512_matmul_kernel::compute_tile(int ur) {
+    CGA64::mov(reg_a_row[0], reg_a);
+    for (int i = 1; i < ur; i++)
+        CGA64::add(reg_a_row[i], reg_a_row[i - 1], reg_lda);
+    CGA64::mov(reg_b_row, reg_b);
+
+    for (int i = 0; i < ur; i++)
+        for (int j = 0; j < nb_; j++)
+            CGA64::fmov(zreg_acc_s(i, j));
+
+    k_loop(ur);
+    store_tile(ur);
+}
+
+void jit_sve_512_matmul_kernel::compute_block() {
+    xa::LabelAArch64 m_loop, m_loop_tail, m_loop_end;
+
+    // Predicate of the last column block: n - (nb_ - 1) * simd_w elements.
+    CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(n)));
+    CGA64::sub_imm(reg_tmp, reg_tmp, (nb_ - 1) * simd_w(), reg_tmp_imm);
+    CGA64::mov_imm(reg_tmp_imm, 0);
+    CGA64::whilelt(reg_p_tail.s, reg_tmp_imm, reg_tmp);
+
+    CGA64::cmp_imm(reg_m, ur_m, reg_tmp_imm);
+    CGA64::b(xa::LT, m_loop_tail);
+
+    CGA64::L_aarch64(m_loop);
+    {
+        compute_tile(ur_m);
+        CGA64::mov_imm(reg_tmp, ur_m);
+        CGA64::madd(reg_a, reg_lda, reg_tmp, reg_a);
+        CGA64::madd(reg_c, reg_ldc, reg_tmp, reg_c);
+        CGA64::sub_imm(reg_m, reg_m, ur_m, reg_tmp_imm);
+        CGA64::cmp_imm(reg_m, ur_m, reg_tmp_imm);
+        CGA64::b(xa::GE, m_loop);
+    }
+
+    // At most ur_m - 1 rows are left, each remainder has its own tile.
+    CGA64::L_aarch64(m_loop_tail);
+    for (int ur = ur_m - 1; ur > 0; ur--) {
+        xa::LabelAArch64 next_ur;
+        CGA64::cmp_imm(reg_m, ur, reg_tmp_imm);
+        CGA64::b(xa::NE, next_ur);
+        compute_tile(ur);
+        CGA64::b(m_loop_end);
+        CGA64::L_aarch64(next_ur);
+    }
+
+    CGA64::L_aarch64(m_loop_end);
+}
+
+void jit_sve_512_matmul_kernel::generate() {
+    assert(ur_m * max_nb <= 24);
+
+    preamble();
+
+    CGA64::ptrue(reg_p_all_ones.b);
+
+    CGA64::mov(reg_param, abi_param1_aarch64);
+    CGA64::ldr(reg_a, xa::ptr(reg_param, GET_OFF(a)));
+    CGA64::ldr(reg_b, xa::ptr(reg_param, GET_OFF(b)));
+    CGA64::ldr(reg_c, xa::ptr(reg_param, GET_OFF(c)));
+    CGA64::ldr(reg_m, xa::ptr(reg_param, GET_OFF(m)));
+    CGA64::ldr(reg_lda, xa::ptr(reg_param, GET_OFF(lda)));
+    CGA64::ldr(reg_ldb, xa::ptr(reg_param, GET_OFF(ldb)));
+    CGA64::ldr(reg_ldc, xa::ptr(reg_param, GET_OFF(ldc)));
+
+    // The number of column blocks is only known at runtime, a copy of the
+    // whole m-loop is generated for each of them.
+    xa::LabelAArch64 done;
+    CGA64::ldr(reg_tmp, xa::ptr(reg_param, GET_OFF(n)));
+    for (nb_ = 1; nb_ <= max_nb; nb_++) {
+        xa::LabelAArch64 next_nb;
+        if (nb_ < max_nb) {
+            CGA64::cmp_imm(reg_tmp, nb_ * simd_w(), reg_tmp_imm);
+            CGA64::b(xa::GT, next_nb);
+        }
+        compute_block();
+        CGA64::b(done);
+        CGA64::L_aarch64(next_nb);
+    }
+
+    CGA64::L_aarch64(done);
+    postamble();
+
+    if (jcp.with_eltwise) {
+        eltwise_injector_->prepare_table();
+        binCommit();
+    }
+}
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_MATMUL_JIT_SVE_512_MATMUL_KERNEL_HPP
+#define CPU_AARCH64_MATMUL_JIT_SVE_512_MATMUL_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_uni_eltwise_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+enum oscale_kind_t { oscale_none, oscale_common, oscale_per_n };
+
+// Only the post-processing is fixed at creation time, the shapes and the
+// strides are passed with every call, so runtime dimensions do not require
+// a new kernel.
+struct jit_matmul_conf_t {
+    bool with_bias;
+    oscale_kind_t oscale;
+    bool with_sum;
+    float sum_scale;
+    bool with_eltwise;
+    post_ops_t::entry_t::eltwise_t eltwise;
+};
+
+struct jit_matmul_call_s {
+    const float *a; // rows are contiguous in K
+    const float *b; // rows are contiguous in N
+    float *c;
+    const float *bias; // 1 x N, already shifted to the first column
+    const float *scales; // shifted to the first column for oscale_per_n
+    size_t m;
+    size_t n; // up to n_block()
+    size_t k;
+    size_t lda; // in bytes
+    size_t ldb; // in bytes
+    size_t ldc; // in bytes
+};
+
+// Computes C[m][n] = post_ops(oscale * (A[m][k] * B[k][n] + bias)) for a
+// block of at most n_block() columns. The number of simd_w()-wide column
+// blocks is selected at runtime and the last one is always masked, so any N
+// is handled by a single kernel. The code only depends on the vector length
+// through the column tail, so it runs on any SVE implementation.
+struct jit_sve_512_matmul_kernel : public jit_generator {
+    enum {
+        max_nb = 4,
+        ur_m = 6,
+    };
+
+    static int simd_w() { return get_sve_length() / sizeof(float); }
+    static int n_block() { return max_nb * simd_w(); }
+
+    jit_sve_512_matmul_kernel(const jit_matmul_conf_t &ajcp)
+        : jit_generator(nullptr, 256 * 1024)
+        , jcp(ajcp)
+        , eltwise_injector_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise);
+        generate();
+        jit_ker = (void (*)(jit_matmul_call_s *))getCode32();
+    }
+
+    ~jit_sve_512_matmul_kernel() { delete eltwise_injector_; }
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sve_512_matmul_kernel)
+
+    void operator()(jit_matmul_call_s *p) const { jit_ker(p); }
+
+    jit_matmul_conf_t jcp;
+    void (*jit_ker)(jit_matmul_call_s *);
+
+private:
+    using reg64_t = const xa::XReg;
+
+    enum {
+        typesize = sizeof(float),
+        unroll_k = 4,
+        n_a_regs = 4,
+    };
+
+    const xa::PReg reg_p_all_ones = p2;
+    const xa::PReg reg_p_tail = p3;
+
+    /* x0 (p_table of the eltwise injector) and x4 (stack of the translated
+     * code) are not used, the call parameters are kept in reg_param. */
+    reg64_t reg_a = x1;
+    reg64_t reg_b = x2;
+    reg64_t reg_c = x3;
+    reg64_t reg_m = x5;
+    reg64_t reg_lda = x6;
+    reg64_t reg_param = x7;
+    reg64_t reg_a_row[ur_m] = {x8, x9, x10, x11, x12, x13};
+    reg64_t reg_ldb = x14;
+    reg64_t reg_ldc = x15;
+    reg64_t reg_b_row = x16;
+    reg64_t reg_kk = x17;
+    reg64_t reg_c_row = x18;
+    reg64_t reg_tmp = x19;
+    reg64_t reg_tmp_imm = x20;
+
+    int nb_ = 0; // column blocks of the code being generated
+
+    xa::ZRegS zreg_acc_s(int i, int j) const { return xa::ZRegS(i * nb_ + j); }
+    xa::ZRegS zreg_b_s(int j) const { return xa::ZRegS(24 + j); }
+    xa::ZRegS zreg_a_s(int i) const { return xa::ZRegS(28 + i % n_a_regs); }
+    xa::ZRegS zreg_tmp_s() const { return xa::ZRegS(31); }
+    xa::PReg p_col(int j) const {
+        return j == nb_ - 1 ? reg_p_tail : reg_p_all_ones;
+    }
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+
+    void fma_step(int ur, int uk);
+    void k_loop(int ur);
+    void store_tile(int ur);
+    void compute_tile(int ur);
+    void compute_block();
+    void generate();
+};
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
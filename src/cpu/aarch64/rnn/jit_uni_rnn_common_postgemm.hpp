@@ -22,7 +22,7 @@
 #include "common/rnn_pd.hpp"
 #include "common/utils.hpp"
 
-#include "cpu/aarch64/jit_avx512_core_bf16cvt.hpp"
+#include "cpu/aarch64/jit_sve_512_core_bf16cvt.hpp"
 #include "cpu/aarch64/jit_generator.hpp"
 
 #include "cpu/aarch64/jit_uni_eltwise_injector.hpp"
@@ -26,6 +26,9 @@
 #if DNNL_X64
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_sve_512_core_bf16cvt.hpp"
 #endif
 
 namespace dnnl {
@@ -87,6 +90,17 @@ void cvt_float_to_bfloat16(bfloat16_t *out, const float *inp, size_t nelems) {
         cvt_ps_to_bf16.jit_ker(&p_);
         return;
     }
+#elif DNNL_AARCH64
+    if (cpu::aarch64::mayiuse(cpu::aarch64::cpu_isa_t::sve)) {
+        cpu::aarch64::bf16_support::jit_call_t p_;
+        p_.inp = (void *)inp;
+        p_.out = (void *)out;
+        p_.nelems = nelems;
+        static const cpu::aarch64::jit_avx512_core_cvt_ps_to_bf16_t
+                cvt_ps_to_bf16;
+        cvt_ps_to_bf16.jit_ker(&p_);
+        return;
+    }
 #endif
 
     PRAGMA_OMP_SIMD()
@@ -100,6 +114,12 @@ void cvt_bfloat16_to_float(float *out, const bfloat16_t *inp, size_t nelems) {
         static const cpu::x64::jit_avx512_core_cvt_bf16_to_ps_t kernel(false);
         return kernel.jit_ker(out, inp, nelems);
     }
+#elif DNNL_AARCH64
+    if (cpu::aarch64::mayiuse(cpu::aarch64::cpu_isa_t::sve)) {
+        static const cpu::aarch64::jit_avx512_core_cvt_bf16_to_ps_t kernel(
+                false);
+        return kernel.jit_ker(out, inp, nelems);
+    }
 #endif
 
     PRAGMA_OMP_SIMD()
@@ -121,6 +141,18 @@ void add_floats_and_cvt_to_bfloat16(
         add_cvt_ps_to_bf16.jit_ker(&p_);
         return;
     }
+#elif DNNL_AARCH64
+    if (cpu::aarch64::mayiuse(cpu::aarch64::cpu_isa_t::sve)) {
+        cpu::aarch64::bf16_support::jit_call_t p_;
+        p_.inp = (void *)inp0;
+        p_.add = (void *)inp1;
+        p_.out = (void *)out;
+        p_.nelems = nelems;
+        static const cpu::aarch64::jit_avx512_core_add_cvt_ps_to_bf16_t
+                add_cvt_ps_to_bf16;
+        add_cvt_ps_to_bf16.jit_ker(&p_);
+        return;
+    }
 #endif
 
     PRAGMA_OMP_SIMD()
@@ -51,8 +51,13 @@
 using namespace dnnl::impl::cpu::x64;
 
 #elif DNNL_AARCH64
+#include "cpu/aarch64/gemm_bf16_convolution.hpp"
+#include "cpu/aarch64/gemm_winograd_convolution.hpp"
 #include "cpu/aarch64/jit_aarch64_sve_512_1x1_convolution.hpp"
 #include "cpu/aarch64/jit_aarch64_sve_512_convolution.hpp"
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_1x1_convolution.hpp"
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_convolution.hpp"
+#include "cpu/aarch64/jit_sve_convolution.hpp"
 #include "cpu/aarch64/jit_uni_dw_convolution.hpp"
 using namespace dnnl::impl::cpu::aarch64;
 #endif
@@ -103,7 +108,9 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_sse41_convolution_fwd_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_dw_convolution_fwd_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_1x1_convolution_fwd_f32_t)
+        CPU_INSTANCE_AARCH64(gemm_winograd_convolution_fwd_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_convolution_fwd_t<f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_convolution_fwd_t)
         CPU_INSTANCE(gemm_convolution_fwd_t)
         CPU_INSTANCE(ref_convolution_fwd_t<f32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -116,6 +123,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_fwd_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_fwd_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_fwd_t<f32>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_convolution_fwd_t<f32>)
         CPU_INSTANCE(ref_convolution_fwd_t<bf16, bf16, f32, f32>)
         nullptr,
     }},
@@ -126,6 +134,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_fwd_t<bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_fwd_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_fwd_t<bf16>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_convolution_fwd_t<bf16>)
         CPU_INSTANCE(ref_convolution_fwd_t<bf16, bf16, bf16, f32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
         nullptr,
@@ -143,6 +152,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx2_convolution_bwd_data_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_dw_convolution_bwd_data_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_1x1_convolution_bwd_data_f32_t)
+        CPU_INSTANCE_AARCH64(gemm_winograd_convolution_bwd_data_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_convolution_bwd_data_t<f32>)
         CPU_INSTANCE(gemm_convolution_bwd_data_t)
         CPU_INSTANCE(ref_convolution_bwd_data_t<f32, f32, f32, f32>)
@@ -153,6 +163,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_data_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_data_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_data_t<f32>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_convolution_bwd_data_t<f32>)
         CPU_INSTANCE(ref_convolution_bwd_data_t<f32, bf16, bf16, f32>)
         nullptr,
     }},
@@ -161,6 +172,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_data_t<bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_data_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_data_t<bf16>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_convolution_bwd_data_t<bf16>)
         CPU_INSTANCE(ref_convolution_bwd_data_t<bf16, bf16, bf16, f32>)
         nullptr,
     }},
@@ -177,6 +189,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx2_convolution_bwd_weights_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_dw_convolution_bwd_weights_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_1x1_convolution_bwd_weights_t)
+        CPU_INSTANCE_AARCH64(gemm_winograd_convolution_bwd_weights_t)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_512_convolution_bwd_weights_t<f32>)
         CPU_INSTANCE_AARCH64(jit_aarch64_sve_256_dw_convolution_bwd_weights_t)
         CPU_INSTANCE(gemm_convolution_bwd_weights_t)
@@ -188,6 +201,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_weights_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_weights_t<f32>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_convolution_bwd_weights_t<f32>)
         CPU_INSTANCE(ref_convolution_bwd_weights_t<bf16, f32, bf16, f32>)
         nullptr,
     }},
@@ -196,6 +210,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<bf16>)
         CPU_INSTANCE_X64(jit_avx512_core_bf16_convolution_bwd_weights_t)
         CPU_INSTANCE_X64(gemm_bf16_convolution_bwd_weights_t<bf16>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_convolution_bwd_weights_t<bf16>)
         CPU_INSTANCE(ref_convolution_bwd_weights_t<bf16, bf16, bf16, f32>)
         nullptr,
     }},
@@ -207,6 +222,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, f32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<s8, f32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<s8, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<s8, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<s8, f32>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<s8, f32>)
         CPU_INSTANCE(ref_convolution_fwd_t<s8, s8, f32, s32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -219,6 +236,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, s32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<s8, s32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<s8, s32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<s8, s32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<s8, s32>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<s8, s32>)
         CPU_INSTANCE(ref_convolution_fwd_t<s8, s8, s32, s32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -231,6 +250,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, s8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<s8, s8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<s8, s8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<s8, s8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<s8, s8>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<s8, s8>)
         CPU_INSTANCE(ref_convolution_fwd_t<s8, s8, s8, s32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -243,6 +264,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<s8, u8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<s8, u8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<s8, u8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<s8, u8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<s8, u8>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<s8, u8>)
         CPU_INSTANCE(ref_convolution_fwd_t<s8, s8, u8, s32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -257,6 +280,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, f32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<u8, f32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<u8, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<u8, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<u8, f32>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<u8, f32>)
         CPU_INSTANCE(ref_convolution_fwd_t<u8, s8, f32, s32>)
         nullptr,
@@ -269,6 +294,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, s32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<u8, s32>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<u8, s32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<u8, s32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<u8, s32>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<u8, s32>)
         CPU_INSTANCE(ref_convolution_fwd_t<u8, s8, s32, s32>)
         nullptr,
@@ -281,6 +308,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, s8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<u8, s8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<u8, s8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<u8, s8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<u8, s8>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<u8, s8>)
         CPU_INSTANCE(ref_convolution_fwd_t<u8, s8, s8, s32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -294,6 +323,8 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_core_x8s8s32x_convolution_fwd_t<u8, u8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_1x1_convolution_fwd_t<u8, u8>)
         CPU_INSTANCE_X64(jit_avx2_x8s8s32x_convolution_fwd_t<u8, u8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_1x1_convolution_fwd_t<u8, u8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_convolution_fwd_t<u8, u8>)
         CPU_INSTANCE(_gemm_x8s8s32x_convolution_fwd_t<u8, u8>)
         CPU_INSTANCE(ref_convolution_fwd_t<u8, s8, u8, s32>)
         CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -22,6 +22,9 @@
 #include "cpu/x64/jit_avx512_core_x8s8s32x_1x1_deconvolution.hpp"
 #include "cpu/x64/jit_avx512_core_x8s8s32x_deconvolution.hpp"
 using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_sve_512_x8s8s32x_deconvolution.hpp"
+using namespace dnnl::impl::cpu::aarch64;
 #endif
 
 namespace dnnl {
@@ -51,6 +54,14 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(_jit_avx512_core_x8s8s32x_deconvolution_fwd_t<s8, u8>)
         CPU_INSTANCE_X64(_jit_avx512_core_x8s8s32x_deconvolution_fwd_t<s8, s8>)
         CPU_INSTANCE_X64(_jit_avx512_core_x8s8s32x_deconvolution_fwd_t<s8, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<u8, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<u8, s32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<u8, u8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<u8, s8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<s8, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<s8, s32>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<s8, u8>)
+        CPU_INSTANCE_AARCH64(jit_sve_512_x8s8s32x_deconvolution_fwd_t<s8, s8>)
         CPU_INSTANCE(ref_deconvolution_bwd_weights_t)
         CPU_INSTANCE(ref_deconvolution_bwd_data_t)
         CPU_INSTANCE(ref_deconvolution_fwd_t)
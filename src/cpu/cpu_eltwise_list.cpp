@@ -23,6 +23,7 @@
 #include "cpu/x64/jit_uni_eltwise_int.hpp"
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
+#include "cpu/aarch64/jit_sve_eltwise.hpp"
 #include "cpu/aarch64/jit_uni_eltwise.hpp"
 #include "cpu/aarch64/jit_uni_eltwise_int.hpp"
 using namespace dnnl::impl::cpu::aarch64;
@@ -58,6 +59,8 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_uni_eltwise_int_fwd_t<sse41, u8>)
         CPU_INSTANCE_AARCH64(jit_uni_eltwise_fwd_t<avx512_common, f32>)
         CPU_INSTANCE_AARCH64(jit_uni_eltwise_bwd_t<avx512_common, f32>)
+        CPU_INSTANCE_AARCH64(jit_sve_eltwise_fwd_t)
+        CPU_INSTANCE_AARCH64(jit_sve_eltwise_bwd_t)
         CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<avx512_common, s32>)
         CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<avx512_common, s8>)
         CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<avx512_common, u8>)
@@ -42,8 +42,15 @@ status_t cpu_engine_t::create_memory_storage(
 
 status_t cpu_engine_t::create_stream(
         stream_t **stream, unsigned flags, const stream_attr_t *attr) {
-    return safe_ptr_assign<stream_t>(
-            *stream, new cpu_stream_t(this, flags, attr));
+    std::unique_ptr<cpu_stream_t> cpu_stream(
+            new cpu_stream_t(this, flags, attr));
+    if (!cpu_stream) return status::out_of_memory;
+
+    status_t status = cpu_stream->init();
+    if (status != status::success) return status;
+
+    *stream = cpu_stream.release();
+    return status::success;
 }
 
 } // namespace cpu
@@ -23,6 +23,10 @@
 #if DNNL_X64
 #include "cpu/x64/gemm_bf16_inner_product.hpp"
 using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/gemm_bf16_inner_product.hpp"
+#include "cpu/aarch64/jit_sve_512_inner_product.hpp"
+using namespace dnnl::impl::cpu::aarch64;
 #endif
 
 namespace dnnl {
@@ -37,6 +41,9 @@ using namespace dnnl::impl::data_type;
 // clang-format off
 static const pd_create_f impl_list[] = {
         /* f32 */
+        CPU_INSTANCE_AARCH64(jit_sve_512_inner_product_fwd_t)
+        CPU_INSTANCE_AARCH64(jit_sve_512_inner_product_bwd_data_t)
+        CPU_INSTANCE_AARCH64(jit_sve_512_inner_product_bwd_weights_t)
         CPU_INSTANCE(gemm_inner_product_fwd_t<f32>)
         CPU_INSTANCE(gemm_inner_product_bwd_data_t<f32>)
         CPU_INSTANCE(gemm_inner_product_bwd_weights_t<f32>)
@@ -50,6 +57,18 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(gemm_bf16_inner_product_bwd_data_t<bf16>)
         CPU_INSTANCE_X64(gemm_bf16_inner_product_bwd_weights_t<f32>)
         CPU_INSTANCE_X64(gemm_bf16_inner_product_bwd_weights_t<bf16>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_inner_product_fwd_t<f32>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_inner_product_fwd_t<bf16>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_inner_product_bwd_data_t<f32>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_inner_product_bwd_data_t<bf16>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_inner_product_bwd_weights_t<f32>)
+        CPU_INSTANCE_AARCH64(gemm_bf16_inner_product_bwd_weights_t<bf16>)
+        CPU_INSTANCE(ref_inner_product_fwd_t<bf16, bf16, f32, f32>)
+        CPU_INSTANCE(ref_inner_product_fwd_t<bf16, bf16, bf16, f32>)
+        CPU_INSTANCE(ref_inner_product_bwd_data_t<f32, bf16, bf16, f32>)
+        CPU_INSTANCE(ref_inner_product_bwd_data_t<bf16, bf16, bf16, f32>)
+        CPU_INSTANCE(ref_inner_product_bwd_weights_t<bf16, f32, bf16, f32>)
+        CPU_INSTANCE(ref_inner_product_bwd_weights_t<bf16, bf16, bf16, f32>)
         /* int */
         CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<u8, u8>)
         CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<u8, s8>)
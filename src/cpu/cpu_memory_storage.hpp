@@ -55,13 +55,22 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
+        // Large buffers (weights mostly) are aligned to pages and first
+        // touched in parallel, so that they are spread over the NUMA nodes
+        // the same way as the work of the threads using them.
+        const bool first_touch = size >= numa_first_touch_threshold
+                && platform::is_numa_first_touch_enabled();
+        void *ptr = malloc(size,
+                first_touch ? (int)PAGE_4K : platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
+        if (first_touch) platform::numa_first_touch(ptr, size);
         data_ = decltype(data_)(ptr, destroy);
         return status::success;
     }
 
 private:
+    static constexpr size_t numa_first_touch_threshold = 1024 * 1024;
+
     std::unique_ptr<void, void (*)(void *)> data_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
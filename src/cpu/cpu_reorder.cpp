@@ -102,6 +102,7 @@ static const impl_list_map_t regular_impl_list_map {
         rnn_weights_reorder_t<f32, bf16>::pd_t::create,
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(f32, any, bf16, nChw16c),
         REG_SR_BIDIR(f32, any, bf16, nCdhw16c),
@@ -287,6 +288,7 @@ static const impl_list_map_t regular_impl_list_map {
         REG_FAST_DIRECT_COPY_COMMA(f32, s32)
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(f32, any, s32, nChw16c),
 
@@ -303,6 +305,7 @@ static const impl_list_map_t regular_impl_list_map {
         REG_FAST_DIRECT_COPY_COMMA(f32, s8)
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(f32, any, s8, nChw16c),
         REG_SR_BIDIR(f32, any, s8, OIhw4i16o4i),
@@ -320,6 +323,7 @@ static const impl_list_map_t regular_impl_list_map {
         REG_FAST_DIRECT_COPY_COMMA(f32, u8)
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(f32, any, u8, nChw16c),
 
@@ -333,6 +337,7 @@ static const impl_list_map_t regular_impl_list_map {
         rnn_weights_reorder_t<bf16, bf16>::pd_t::create,
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(bf16, any, f32, nChw16c),
         REG_SR_BIDIR(bf16, any, f32, nCdhw16c),
@@ -365,6 +370,7 @@ static const impl_list_map_t regular_impl_list_map {
         REG_FAST_DIRECT_COPY_COMMA(s32, u8)
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(s32, any, f32, nChw16c),
         REG_SR_BIDIR(s32, any, s32, nChw16c),
@@ -389,6 +395,7 @@ static const impl_list_map_t regular_impl_list_map {
         REG_FAST_DIRECT_COPY_COMMA(s8, u8)
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(s8, any, f32, nChw16c),
         REG_SR_BIDIR(s8, any, s32, nChw16c),
@@ -416,6 +423,7 @@ static const impl_list_map_t regular_impl_list_map {
         REG_FAST_DIRECT_COPY_COMMA(u8, u8)
 
         DNNL_X64_ONLY(x64::jit_uni_reorder_create,)
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
 
         REG_SR_BIDIR(u8, any, f32, nChw16c),
         REG_SR_BIDIR(u8, any, s32, nChw16c),
@@ -435,6 +443,8 @@ static const impl_list_map_t regular_impl_list_map {
 static const impl_list_map_t comp_s8s8_impl_list_map {
     // f32 -> s8
     {{f32, s8, 3}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, wio, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, oiw, s8, OIw4i16o4i, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, wio, s8, OIw4i16o4i, fmt_order::keep, spec::conv_s8s8),
@@ -446,6 +456,8 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{f32, s8, 4}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, hwio, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, any, s8, wigo, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, goiw, s8, gOIw4i16o4i, fmt_order::keep, spec::conv_s8s8),
@@ -468,6 +480,8 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{f32, s8, 5}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, hwigo, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, any, s8, dhwio, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, goihw, s8, gOIhw4i16o4i, fmt_order::keep, spec::conv_s8s8),
@@ -490,6 +504,8 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{f32, s8, 6}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(f32, any, s8, dhwigo, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, goidhw, s8, gOIdhw4i16o4i, fmt_order::keep, spec::conv_s8s8),
         REG_SR(f32, goidhw, s8, gOIdhw2i8o4i, fmt_order::keep, spec::conv_s8s8),
@@ -499,6 +515,8 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
     }},
     // s8 -> s8
     {{s8, s8, 3}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, wio, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, oiw, s8, OIw4i16o4i, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, wio, s8, OIw4i16o4i, fmt_order::keep, spec::conv_s8s8),
@@ -510,6 +528,8 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{s8, s8, 4}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, hwio, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, any, s8, wigo, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, goiw, s8, gOIw4i16o4i, fmt_order::keep, spec::conv_s8s8),
@@ -532,6 +552,8 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{s8, s8, 5}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, hwigo, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, any, s8, dhwio, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, goihw, s8, gOIhw4i16o4i, fmt_order::keep, spec::conv_s8s8),
@@ -554,6 +576,8 @@ static const impl_list_map_t comp_s8s8_impl_list_map {
         nullptr,
     }},
     {{s8, s8, 6}, {
+        DNNL_AARCH64_ONLY(aarch64::jit_uni_reorder_create,)
+
         REG_SR(s8, any, s8, dhwigo, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, goidhw, s8, gOIdhw4i16o4i, fmt_order::keep, spec::conv_s8s8),
         REG_SR(s8, goidhw, s8, gOIdhw2i8o4i, fmt_order::keep, spec::conv_s8s8),
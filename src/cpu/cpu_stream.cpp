@@ -0,0 +1,232 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+struct range_t {
+    const char *begin;
+    const char *end;
+
+    bool overlaps(const range_t &other) const {
+        return begin < other.end && other.begin < end;
+    }
+};
+
+bool any_overlap(const std::vector<range_t> &a, const std::vector<range_t> &b) {
+    for (const auto &ra : a)
+        for (const auto &rb : b)
+            if (ra.overlaps(rb)) return true;
+    return false;
+}
+
+struct task_t {
+    const primitive_iface_t *primitive_iface;
+    exec_args_t args;
+    std::vector<range_t> reads, writes;
+
+    int n_deps = 0;
+    std::vector<task_t *> dependents;
+};
+
+} // namespace
+
+struct cpu_stream_t::async_executor_t {
+    async_executor_t(cpu_stream_t *stream, int n_workers) : stream_(stream) {
+        const int nthr = dnnl_get_max_threads();
+        for (int i = 0; i < n_workers; i++) {
+            int start {0}, end {0};
+            balance211(nthr, n_workers, i, start, end);
+            workers_.emplace_back(
+                    &async_executor_t::worker, this, nstl::max(end - start, 1));
+        }
+    }
+
+    ~async_executor_t() {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            shutdown_ = true;
+        }
+        ready_cv_.notify_all();
+        for (auto &w : workers_)
+            w.join();
+    }
+
+    status_t enqueue(const primitive_iface_t *primitive_iface,
+            exec_args_t &&args) {
+        std::unique_ptr<task_t> task(new task_t);
+        task->primitive_iface = primitive_iface;
+        task->args = std::move(args);
+        for (const auto &arg : task->args) {
+            const memory_t *mem = arg.second.mem;
+            void *handle = nullptr;
+            mem->get_data_handle(&handle);
+            const size_t size = memory_desc_wrapper(mem->md()).size();
+            if (handle == nullptr || size == 0) continue;
+            const char *begin = static_cast<const char *>(handle);
+            auto &ranges = arg.second.is_const ? task->reads : task->writes;
+            ranges.push_back({begin, begin + size});
+        }
+        // The scratchpad and resources of the primitive are written by every
+        // execution of it.
+        const char *p = reinterpret_cast<const char *>(primitive_iface);
+        task->writes.push_back({p, p + 1});
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (auto &t : live_) {
+            const bool depends = any_overlap(task->writes, t->writes)
+                    || any_overlap(task->writes, t->reads)
+                    || any_overlap(task->reads, t->writes);
+            if (!depends) continue;
+            t->dependents.push_back(task.get());
+            task->n_deps++;
+        }
+        live_.push_back(std::move(task));
+        if (live_.back()->n_deps == 0) {
+            ready_.push_back(live_.back().get());
+            ready_cv_.notify_one();
+        }
+        return status::success;
+    }
+
+    status_t wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&]() { return live_.empty(); });
+        const status_t status = status_;
+        status_ = status::success;
+        return status;
+    }
+
+private:
+    void worker(int nthr) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        omp_set_num_threads(nthr);
+        stream_partition::set_num_threads(nthr);
+#else
+        MAYBE_UNUSED(nthr);
+#endif
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            ready_cv_.wait(
+                    lock, [&]() { return shutdown_ || !ready_.empty(); });
+            if (ready_.empty()) return;
+            task_t *task = ready_.front();
+            ready_.pop_front();
+            lock.unlock();
+
+            exec_ctx_t ctx(stream_, std::move(task->args));
+            const status_t status
+                    = primitive_execute(task->primitive_iface, ctx);
+
+            lock.lock();
+            if (status != status::success && status_ == status::success)
+                status_ = status;
+            for (task_t *d : task->dependents)
+                if (--d->n_deps == 0) ready_.push_back(d);
+            if (!ready_.empty()) ready_cv_.notify_all();
+            for (auto it = live_.begin(); it != live_.end(); ++it)
+                if (it->get() == task) {
+                    live_.erase(it);
+                    break;
+                }
+            if (live_.empty()) done_cv_.notify_all();
+        }
+    }
+
+    cpu_stream_t *stream_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_cv_;
+    std::condition_variable done_cv_;
+    // Tasks that are not completed yet, in submission order.
+    std::list<std::unique_ptr<task_t>> live_;
+    std::deque<task_t *> ready_;
+    status_t status_ = status::success;
+    bool shutdown_ = false;
+};
+
+cpu_stream_t::cpu_stream_t(
+        engine_t *engine, unsigned flags, const stream_attr_t *attr)
+    : stream_t(engine, flags, attr) {}
+
+cpu_stream_t::~cpu_stream_t() {
+    if (executor_) executor_->wait();
+}
+
+status_t cpu_stream_t::init() {
+    if (!(flags() & stream_flags::out_of_order)) return status::success;
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
+    // With the sequential runtime every partition is a single thread.
+    const int max_partitions
+            = DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
+            ? (int)nstl::max(std::thread::hardware_concurrency(), 1u)
+            : dnnl_get_max_threads();
+    const int n_partitions = nstl::max(1,
+            nstl::min(getenv_int("DNNL_CPU_STREAM_PARTITIONS", 2),
+                    max_partitions));
+    executor_.reset(new async_executor_t(this, n_partitions));
+    return status::success;
+#else
+    // TBB, threadpool and native runtimes own their threads, which cannot be
+    // partitioned between the threads of the stream.
+    return status::unimplemented;
+#endif
+}
+
+status_t cpu_stream_t::wait() {
+    // In-order execution is synchronous, so return immediately.
+    return executor_ ? executor_->wait() : status::success;
+}
+
+status_t cpu_stream_t::enqueue(
+        const primitive_iface_t *primitive_iface, exec_args_t &&args) {
+    if (!executor_) return status::runtime_error;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Backward primitives split their work between the threads they were
+    // created for, so they cannot run on a part of the threads.
+    prop_kind_t prop_kind = prop_kind::undef;
+    if (primitive_iface->pd()->impl()->query(query::prop_kind, 0, &prop_kind)
+                    == status::success
+            && !utils::one_of(prop_kind, prop_kind::forward_training,
+                    prop_kind::forward_inference))
+        return status::unimplemented;
+#endif
+    return executor_->enqueue(primitive_iface, std::move(args));
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -21,6 +21,8 @@
 #include "dnnl_threadpool_iface.hpp"
 #endif
 
+#include <memory>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
@@ -30,14 +32,18 @@ namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
-    cpu_stream_t(engine_t *engine, unsigned flags, const stream_attr_t *attr)
-        : stream_t(engine, flags, attr) {}
-    virtual ~cpu_stream_t() = default;
+    cpu_stream_t(engine_t *engine, unsigned flags, const stream_attr_t *attr);
+    virtual ~cpu_stream_t();
 
-    dnnl::impl::status_t wait() override {
-        // CPU execution is synchronous so return immediately
-        return dnnl::impl::status::success;
-    }
+    // Starts the threads of an out-of-order stream.
+    status_t init();
+
+    dnnl::impl::status_t wait() override;
+
+    bool is_host_async() const override { return executor_ != nullptr; }
+
+    status_t enqueue(const primitive_iface_t *primitive_iface,
+            exec_args_t &&args) override;
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     void before_exec_hook() override {
@@ -50,6 +56,19 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    // Out-of-order streams run primitives on their own threads, each with a
+    // part of the threads of the threading runtime. An execution waits for
+    // the earlier ones whose memory arguments overlap with its own ones where
+    // at least one of the two writes to them, and for the earlier executions
+    // of the same primitive, which share its scratchpad and resources.
+    // Memory objects and primitives passed to an out-of-order stream must
+    // stay alive until wait() returns.
+    struct async_executor_t;
+    std::unique_ptr<async_executor_t> executor_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_stream_t);
 };
 
 } // namespace cpu
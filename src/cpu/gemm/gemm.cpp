@@ -43,6 +43,13 @@
 #include "cpu/x64/gemm/gemm_driver.hpp"
 
 using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+#include "cpu/aarch64/gemm/f32/jit_sve_512_gemm_f32.hpp"
+#include "cpu/aarch64/gemm/s8x8s32/jit_sve_512_gemm_s8x8s32.hpp"
+
+using namespace dnnl::impl::cpu::aarch64;
 #endif
 
 namespace dnnl {
@@ -131,6 +138,12 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
                 lda, dummy_ao, B, ldb, dummy_bo, beta, C, ldc, bias,
                 force_jit_nocopy_gemm);
     }
+#elif DNNL_AARCH64
+    if (mayiuse(sve)) {
+        status = jit_sve_512_gemm_f32(transa, transb, M, N, K, alpha, A, lda,
+                B, ldb, beta, C, ldc, bias);
+        if (status != dnnl_unimplemented) return status;
+    }
 #endif
 
     return ref_gemm<float>(
@@ -193,6 +206,12 @@ dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
     if (mayiuse(sse41) && !mayiuse(avx512_mic))
         return gemm_driver(transa, transb, offsetc, M, N, K, alpha, A, LDA, ao,
                 B, LDB, bo, beta, C, LDC, co, false);
+#elif DNNL_AARCH64
+    if (mayiuse(sve)) {
+        status = jit_sve_512_gemm_s8x8s32(transa, transb, offsetc, M, N, K,
+                alpha, A, LDA, ao, B, LDB, bo, beta, C, LDC, co);
+        if (status != dnnl_unimplemented) return status;
+    }
 #endif
 
     return ref_gemm_s8x8s32(transa, transb, offsetc, M, N, K, alpha, A, LDA, ao,
@@ -223,6 +242,12 @@ dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
     else if (use_s8u8)
         return simple_gemm_s8s8s32(transa, transb, offsetc, M, N, K, alpha, A,
                 LDA, ao, B, LDB, bo, beta, C, LDC, co);
+#elif DNNL_AARCH64
+    if (mayiuse(sve)) {
+        status = jit_sve_512_gemm_s8x8s32(transa, transb, offsetc, M, N, K,
+                alpha, A, LDA, ao, B, LDB, bo, beta, C, LDC, co);
+        if (status != dnnl_unimplemented) return status;
+    }
 #endif
 
     return ref_gemm_s8x8s32(transa, transb, offsetc, M, N, K, alpha, A, LDA, ao,
@@ -247,6 +272,12 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         return gemm_driver(transa, transb, dummyOffsetC, M, N, K, alpha,
                 (const bfloat16_t *)A, lda, dummy_ao, (const bfloat16_t *)B,
                 ldb, dummy_bo, beta, (float *)C, ldc, dummy_co, false);
+#elif DNNL_AARCH64
+    if (utils::one_of(*transa, 'P', 'p') || utils::one_of(*transb, 'P', 'p'))
+        return dnnl_unimplemented;
+    if (mayiuse_sve_any_vl())
+        return jit_sve_512_gemm_bf16bf16f32(
+                transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 #endif
 
     return dnnl_unimplemented;
@@ -20,6 +20,8 @@
 
 #if DNNL_X64
 #include "cpu/x64/gemm/gemm_pack.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/gemm/gemm_pack.hpp"
 #endif
 
 namespace dnnl {
@@ -29,6 +31,8 @@ namespace cpu {
 bool pack_sgemm_supported() {
 #if DNNL_X64
     return x64::pack_sgemm_supported();
+#elif DNNL_AARCH64
+    return aarch64::pack_sgemm_supported();
 #endif
     return false;
 }
@@ -45,6 +49,9 @@ dnnl_status_t sgemm_pack_get_size(const char *identifier, const char *transa,
 #if DNNL_X64
     return x64::sgemm_pack_get_size(
             identifier, transa, transb, M, N, K, lda, ldb, size, pack);
+#elif DNNL_AARCH64
+    return aarch64::sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size, pack);
 #endif
     return dnnl_unimplemented;
 }
@@ -67,6 +74,9 @@ dnnl_status_t gemm_s8u8s32_pack_get_size(const char *identifier,
 #if DNNL_X64
     return x64::gemm_s8u8s32_pack_get_size(
             identifier, transa, transb, M, N, K, lda, ldb, size, pack);
+#elif DNNL_AARCH64
+    return aarch64::gemm_s8u8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size, pack);
 #endif
     return dnnl_unimplemented;
 }
@@ -88,6 +98,9 @@ dnnl_status_t sgemm_pack(const char *identifier, const char *transa,
 #if DNNL_X64
     return x64::sgemm_pack(
             identifier, transa, transb, M, N, K, lda, ldb, src, dst);
+#elif DNNL_AARCH64
+    return aarch64::sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst);
 #endif
     return dnnl_unimplemented;
 }
@@ -109,6 +122,9 @@ dnnl_status_t gemm_s8u8s32_pack(const char *identifier, const char *transa,
 #if DNNL_X64
     return x64::gemm_s8u8s32_pack(
             identifier, transa, transb, M, N, K, lda, ldb, src, dst);
+#elif DNNL_AARCH64
+    return aarch64::gemm_s8u8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst);
 #endif
     return dnnl_unimplemented;
 }
@@ -130,6 +146,9 @@ dnnl_status_t sgemm_compute(const char *transa, const char *transb,
 #if DNNL_X64
     return x64::sgemm_compute(
             transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc);
+#elif DNNL_AARCH64
+    return aarch64::sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc);
 #endif
     return dnnl_unimplemented;
 }
@@ -152,6 +171,9 @@ dnnl_status_t gemm_s8u8s32_compute(const char *transa, const char *transb,
 #if DNNL_X64
     return x64::gemm_s8u8s32_compute(
             transa, transb, offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co);
+#elif DNNL_AARCH64
+    return aarch64::gemm_s8u8s32_compute(
+            transa, transb, offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co);
 #endif
     return dnnl_unimplemented;
 }
@@ -465,14 +465,34 @@ status_t gemm_convolution_bwd_data_t::execute_backward_data_thr_nspc(
             jit_gemm_convolution_utils::col2im_dt<data_t>(
                     jcp, col, (acc_needed ? acc : diff_src));
 
+        // The bias is added while the image of the group is still in cache
+        // instead of a separate pass over diff_src.
+        const data_t *__restrict bia
+                = jcp.with_bias ? bia_base + g * jcp.ic : nullptr;
         if (acc_needed) {
             parallel_nd(static_cast<size_t>(jcp.is) * jcp.id, [&](size_t is) {
                 data_t *__restrict diff_src_arr
                         = diff_src + is * diff_src_os_stride;
                 const data_t *__restrict acc_arr = acc + is * jcp.ic;
+                if (bia) {
+                    PRAGMA_OMP_SIMD()
+                    for (int ic = 0; ic < jcp.ic; ic++) {
+                        diff_src_arr[ic] = acc_arr[ic] + bia[ic];
+                    }
+                } else {
+                    PRAGMA_OMP_SIMD()
+                    for (int ic = 0; ic < jcp.ic; ic++) {
+                        diff_src_arr[ic] = acc_arr[ic];
+                    }
+                }
+            });
+        } else if (bia) {
+            parallel_nd(static_cast<size_t>(jcp.is) * jcp.id, [&](size_t is) {
+                data_t *__restrict diff_src_arr
+                        = diff_src + is * diff_src_os_stride;
                 PRAGMA_OMP_SIMD()
                 for (int ic = 0; ic < jcp.ic; ic++) {
-                    diff_src_arr[ic] = acc_arr[ic];
+                    diff_src_arr[ic] += bia[ic];
                 }
             });
         }
@@ -485,6 +505,7 @@ status_t gemm_convolution_bwd_data_t::execute_backward_data_ncsp(
         const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
     auto col = ctx.get_scratchpad_grantor().get<data_t>(key_conv_gemm_col);
@@ -550,6 +571,18 @@ status_t gemm_convolution_bwd_data_t::execute_backward_data_ncsp(
                     }
                 }
             }
+            if (jcp.with_bias) {
+                // Added right after the image is computed, while it is still
+                // in cache, instead of a separate pass over diff_src.
+                const size_t spatial = (size_t)jcp.id * jcp.ih * jcp.iw;
+                for (int ic = 0; ic < jcp.ic; ++ic) {
+                    const data_t b = bias[g * jcp.ic + ic];
+                    data_t *__restrict d = _diff_src + ic * spatial;
+                    PRAGMA_OMP_SIMD()
+                    for (size_t sp = 0; sp < spatial; ++sp)
+                        d[sp] += b;
+                }
+            }
             nd_iterator_step(g, jcp.ngroups, n, jcp.mb);
         }
     });
@@ -125,7 +125,7 @@ struct gemm_convolution_bwd_data_t : public primitive_t {
             bool ok = true && desc()->prop_kind == prop_kind::backward_data
                     && set_default_alg_kind(alg_kind::convolution_direct)
                     && expect_data_types(data_type::f32, data_type::f32,
-                            data_type::undef, data_type::f32, data_type::f32)
+                            data_type::f32, data_type::f32, data_type::f32)
                     && !has_zero_dim_memory() && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
@@ -135,6 +135,9 @@ struct gemm_convolution_bwd_data_t : public primitive_t {
                     *attr(), dnnl_get_max_threads());
         }
 
+        // The bias is used by deconvolution, see ref_deconvolution_fwd_t.
+        bool support_bias() const override { return true; }
+
         conv_gemm_conf_t jcp_;
     };
 
@@ -0,0 +1,388 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <climits>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "dnnl_version.h"
+
+#include "common/utils.hpp"
+
+#include "cpu/jit_persistent_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace jit_persistent_cache {
+
+#ifdef __linux__
+namespace {
+
+// File layout: file_header_t followed by a sequence of entries, each entry is
+// entry_header_t followed by the key and the code. A truncated or corrupted
+// tail (e.g. left by a killed process) ends the sequence.
+//
+// Writers serialize on an exclusive lock of a separate lock file, which they
+// hold while they read the cache file, append to it or replace it. Locking the
+// cache file itself would not do, since a replaced file is a different inode.
+struct file_header_t {
+    char magic[8];
+    uint32_t format_version;
+    int32_t version_major;
+    int32_t version_minor;
+    int32_t version_patch;
+    char version_hash[48];
+};
+
+struct entry_header_t {
+    uint32_t isa;
+    uint32_t key_size;
+    uint64_t code_size;
+    uint64_t checksum;
+};
+
+constexpr uint32_t format_version = 1;
+
+file_header_t make_file_header() {
+    file_header_t h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, "DNNLJITC", sizeof(h.magic));
+    h.format_version = format_version;
+    h.version_major = DNNL_VERSION_MAJOR;
+    h.version_minor = DNNL_VERSION_MINOR;
+    h.version_patch = DNNL_VERSION_PATCH;
+    std::strncpy(
+            h.version_hash, DNNL_VERSION_HASH, sizeof(h.version_hash) - 1);
+    return h;
+}
+
+bool is_valid_header(const void *p) {
+    const file_header_t h = make_file_header();
+    return std::memcmp(p, &h, sizeof(h)) == 0;
+}
+
+// FNV-1a
+uint64_t checksum(const uint8_t *p, size_t size, uint64_t seed) {
+    uint64_t h = seed;
+    for (size_t i = 0; i < size; i++)
+        h = (h ^ p[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+uint64_t entry_checksum(const std::string &key, const uint8_t *code,
+        size_t code_size, unsigned isa) {
+    uint64_t h = checksum(reinterpret_cast<const uint8_t *>(&isa),
+            sizeof(isa), 0xcbf29ce484222325ULL);
+    h = checksum(reinterpret_cast<const uint8_t *>(key.data()), key.size(), h);
+    return checksum(code, code_size, h);
+}
+
+std::string index_key(const std::string &key, unsigned isa) {
+    return std::to_string(isa) + ":" + key;
+}
+
+struct code_t {
+    const uint8_t *ptr;
+    size_t size;
+};
+
+const std::string &cache_path() {
+    static const std::string path = []() {
+        char buf[PATH_MAX];
+        if (getenv("DNNL_JIT_PERSISTENT_CACHE", buf, sizeof(buf)) > 0)
+            return std::string(buf);
+        return std::string();
+    }();
+    return path;
+}
+
+// The cache holds executable code, so only the files and directories that
+// belong to the current user and that nobody else can modify are used.
+bool is_trusted(const struct stat &st) {
+    return st.st_uid == geteuid() && (st.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+bool is_trusted_dir() {
+    const std::string &path = cache_path();
+    const size_t pos = path.find_last_of('/');
+    const std::string dir = pos == std::string::npos
+            ? std::string(".")
+            : pos == 0 ? std::string("/") : path.substr(0, pos);
+    struct stat st;
+    return stat(dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode)
+            && is_trusted(st);
+}
+
+// Opens a regular file, symbolic links are not followed. Returns -1 if the
+// file cannot be opened or is not trusted.
+int open_trusted(const std::string &path, int flags) {
+    int fd = open(path.c_str(), flags | O_CLOEXEC | O_NOFOLLOW, 0600);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || !is_trusted(st)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// A read-only mapping of the whole cache file.
+struct mapping_t {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+// Returns an empty mapping if the file does not exist, is not trusted or
+// does not start with a valid header.
+mapping_t map_file() {
+    mapping_t m;
+    int fd = open_trusted(cache_path(), O_RDONLY);
+    if (fd < 0) return m;
+
+    struct stat st;
+    const size_t size = fstat(fd, &st) == 0 ? (size_t)st.st_size : 0;
+    void *base = size >= sizeof(file_header_t)
+            ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)
+            : MAP_FAILED;
+    close(fd);
+    if (base == MAP_FAILED) return m;
+
+    if (!is_valid_header(base)) {
+        munmap(base, size);
+        return m;
+    }
+    m.data = static_cast<const uint8_t *>(base);
+    m.size = size;
+    return m;
+}
+
+// Calls f(key, isa, entry, entry_size, code, code_size) for every valid entry
+// of the mapped file, in order. Returns the offset where the valid entries
+// end, which is less than the file size if the file has a corrupted tail.
+template <typename F>
+size_t for_each_entry(const mapping_t &m, F f) {
+    size_t off = sizeof(file_header_t);
+    while (off + sizeof(entry_header_t) <= m.size) {
+        entry_header_t e;
+        std::memcpy(&e, m.data + off, sizeof(e));
+        const size_t body = off + sizeof(e);
+        if (e.key_size > m.size - body
+                || e.code_size > m.size - body - e.key_size)
+            break;
+
+        const std::string key(
+                reinterpret_cast<const char *>(m.data + body), e.key_size);
+        const uint8_t *code = m.data + body + e.key_size;
+        if (e.checksum != entry_checksum(key, code, e.code_size, e.isa))
+            break;
+
+        const size_t entry_size = sizeof(e) + e.key_size + e.code_size;
+        f(key, e.isa, m.data + off, entry_size, code, (size_t)e.code_size);
+        off += entry_size;
+    }
+    return off;
+}
+
+bool write_all(int fd, const std::vector<uint8_t> &buf) {
+    size_t off = 0;
+    while (off < buf.size()) {
+        ssize_t n = write(fd, buf.data() + off, buf.size() - off);
+        if (n <= 0) return false;
+        off += (size_t)n;
+    }
+    return true;
+}
+
+// Replaces the cache file with a new one holding the given entries. The new
+// file is renamed over the old one, so the processes that have the old file
+// mapped are not affected.
+void replace_file(const std::vector<uint8_t> &entries) {
+    std::string tmp_path = cache_path() + ".XXXXXX";
+    int fd = mkstemp(&tmp_path[0]);
+    if (fd < 0) return;
+
+    const file_header_t h = make_file_header();
+    std::vector<uint8_t> buf(reinterpret_cast<const uint8_t *>(&h),
+            reinterpret_cast<const uint8_t *>(&h) + sizeof(h));
+    buf.insert(buf.end(), entries.begin(), entries.end());
+
+    const bool ok = fchmod(fd, 0644) == 0 && write_all(fd, buf);
+    close(fd);
+    if (!ok || rename(tmp_path.c_str(), cache_path().c_str()) != 0)
+        unlink(tmp_path.c_str());
+}
+
+// Merges the entry, if any, into the cache file. Must be called under the
+// exclusive lock. The entry is dropped if the file already has one with the
+// same key. The entry is appended to a clean file. A file with a stale
+// header, duplicate keys or a corrupted tail is replaced with a compacted
+// copy of its valid entries followed by the new one.
+void merge(const std::string *key, unsigned isa,
+        const std::vector<uint8_t> *entry) {
+    const mapping_t m = map_file();
+
+    std::unordered_set<std::string> keys;
+    std::vector<uint8_t> entries;
+    bool has_duplicates = false;
+    const size_t end = for_each_entry(m,
+            [&](const std::string &k, unsigned k_isa, const uint8_t *e,
+                    size_t e_size, const uint8_t *, size_t) {
+                if (keys.insert(index_key(k, k_isa)).second)
+                    entries.insert(entries.end(), e, e + e_size);
+                else
+                    has_duplicates = true;
+            });
+    if (m.data) munmap(const_cast<uint8_t *>(m.data), m.size);
+
+    const bool exists = entry && keys.count(index_key(*key, isa)) != 0;
+    const bool is_clean = m.data && end == m.size && !has_duplicates;
+    if (is_clean) {
+        if (!entry || exists) return;
+        int fd = open_trusted(cache_path(), O_WRONLY | O_APPEND);
+        if (fd < 0) return;
+        write_all(fd, *entry);
+        close(fd);
+        return;
+    }
+
+    if (!m.data && !entry) return;
+    if (entry && !exists)
+        entries.insert(entries.end(), entry->begin(), entry->end());
+    replace_file(entries);
+}
+
+// Runs merge() under the exclusive lock shared by all the processes.
+void locked_merge(const std::string *key, unsigned isa,
+        const std::vector<uint8_t> *entry) {
+    if (!is_trusted_dir()) return;
+
+    // Serializes the writers within the process, the file lock serializes
+    // them across processes.
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> guard(mutex);
+
+    int fd = open_trusted(cache_path() + ".lock", O_RDWR | O_CREAT);
+    if (fd < 0) return;
+    if (flock(fd, LOCK_EX) == 0) {
+        merge(key, isa, entry);
+        flock(fd, LOCK_UN);
+    }
+    close(fd);
+}
+
+// The index is built once per process and is read-only afterwards, so
+// lookups do not need any synchronization.
+const std::unordered_map<std::string, code_t> &index() {
+    static std::unordered_map<std::string, code_t> index;
+    static std::once_flag initialized;
+    std::call_once(initialized, []() {
+        if (!is_trusted_dir()) return;
+        const mapping_t m = map_file();
+        if (!m.data) return;
+
+        // The mapping is never released: the code pointers are handed out
+        // for the lifetime of the process.
+        bool has_duplicates = false;
+        const size_t end = for_each_entry(m,
+                [&](const std::string &key, unsigned isa, const uint8_t *,
+                        size_t, const uint8_t *code, size_t code_size) {
+                    const code_t c = {code, code_size};
+                    has_duplicates
+                            |= !index.emplace(index_key(key, isa), c).second;
+                });
+
+        // Entries may be duplicated by the processes that generated the same
+        // kernel concurrently, before either of them stored it.
+        if (has_duplicates || end != m.size)
+            locked_merge(nullptr, 0, nullptr);
+    });
+    return index;
+}
+
+} // namespace
+
+bool enabled() {
+    return !cache_path().empty();
+}
+
+const uint8_t *find(const std::string &key, unsigned isa, size_t *size) {
+    if (!enabled()) return nullptr;
+
+    const auto &idx = index();
+    const auto it = idx.find(index_key(key, isa));
+    if (it == idx.end()) return nullptr;
+
+    *size = it->second.size;
+    return it->second.ptr;
+}
+
+void store(const std::string &key, unsigned isa, const uint8_t *code,
+        size_t size) {
+    if (!enabled()) return;
+
+    entry_header_t e;
+    e.isa = isa;
+    e.key_size = (uint32_t)key.size();
+    e.code_size = size;
+    e.checksum = entry_checksum(key, code, size, isa);
+
+    std::vector<uint8_t> entry(reinterpret_cast<const uint8_t *>(&e),
+            reinterpret_cast<const uint8_t *>(&e) + sizeof(e));
+    entry.insert(entry.end(), key.begin(), key.end());
+    entry.insert(entry.end(), code, code + size);
+
+    locked_merge(&key, isa, &entry);
+}
+
+#else
+
+bool enabled() {
+    return false;
+}
+
+const uint8_t *find(const std::string &key, unsigned isa, size_t *size) {
+    UNUSED(key);
+    UNUSED(isa);
+    UNUSED(size);
+    return nullptr;
+}
+
+void store(const std::string &key, unsigned isa, const uint8_t *code,
+        size_t size) {
+    UNUSED(key);
+    UNUSED(isa);
+    UNUSED(code);
+    UNUSED(size);
+}
+
+#endif
+
+} // namespace jit_persistent_cache
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_PERSISTENT_CACHE_HPP
+#define CPU_JIT_PERSISTENT_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Opt-in cache of generated JIT code shared between processes. It is enabled
+// by pointing the DNNL_JIT_PERSISTENT_CACHE environment variable to a file.
+//
+// The file is memory mapped once per process, on the first lookup. The code
+// generated by the process is appended to the file unless it is there
+// already, and becomes available to the processes started later. A file
+// written by another library version is considered stale and is replaced on
+// the first store, a file with duplicate or corrupted entries is compacted.
+// The file and its directory must belong to the current user and must not be
+// writable by anybody else, otherwise the cache is not used. Entries are validated
+// against the ISA mask they were generated for, so on a mismatch the kernel
+// falls back to JIT compilation.
+//
+// Only the code that does not embed absolute addresses can be reused, hence
+// kernels opt in explicitly via their jit_generator. So far only the SVE-512
+// gemm microkernels do. The found code is copied into the code buffer of the
+// kernel, primitive descriptors are not stored.
+namespace jit_persistent_cache {
+
+bool enabled();
+
+// Returns the code stored for the key and the ISA mask or nullptr if there is
+// none. The returned memory stays valid till the end of the process.
+const uint8_t *find(const std::string &key, unsigned isa, size_t *size);
+
+// Appends the code to the cache file. Failures are ignored since the cache
+// only affects the kernel creation time.
+void store(const std::string &key, unsigned isa, const uint8_t *code,
+        size_t size);
+
+} // namespace jit_persistent_cache
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
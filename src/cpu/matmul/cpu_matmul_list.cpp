@@ -21,6 +21,11 @@
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
 
+#if DNNL_AARCH64
+#include "cpu/aarch64/matmul/jit_sve_512_matmul.hpp"
+using namespace dnnl::impl::cpu::aarch64::matmul;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -32,6 +37,7 @@ using namespace dnnl::impl::data_type;
 
 #define INSTANCE(...) &primitive_desc_t::create<__VA_ARGS__::pd_t>
 static const pd_create_f impl_list[] = {
+        CPU_INSTANCE_AARCH64(jit_sve_512_matmul_t)
         INSTANCE(matmul::gemm_f32_matmul_t),
         INSTANCE(matmul::gemm_bf16_matmul_t<f32>),
         INSTANCE(matmul::gemm_bf16_matmul_t<bf16>),
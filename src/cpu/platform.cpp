@@ -14,7 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <stdio.h>
+#include <string.h>
+
 #include "cpu/platform.hpp"
+
+#include "common/dnnl_thread.hpp"
 #include "common/utils.hpp"
 
 #if DNNL_X64
@@ -57,6 +62,8 @@ bool has_data_type_support(data_type_t data_type) {
         case data_type::bf16:
 #if DNNL_X64
             return x64::mayiuse(x64::avx512_core);
+#elif DNNL_AARCH64
+            return aarch64::mayiuse_sve_any_vl();
 #else
             return false;
 #endif
@@ -131,6 +138,57 @@ unsigned get_num_cores() {
 #endif
 }
 
+int get_num_numa_nodes() {
+    static const int n_nodes = []() {
+        int n = 0;
+#if defined(__linux__)
+        // The list of online nodes, e.g. "0-3" or "0,2-3".
+        FILE *f = impl::fopen("/sys/devices/system/node/online", "r");
+        if (f) {
+            int first = 0, last = 0;
+            while (fscanf(f, "%d", &first) == 1) {
+                last = first;
+                int c = fgetc(f);
+                if (c == '-') {
+                    if (fscanf(f, "%d", &last) != 1) break;
+                    c = fgetc(f);
+                }
+                n += last - first + 1;
+                if (c != ',') break;
+            }
+            fclose(f);
+        }
+#endif
+        return nstl::max(n, 1);
+    }();
+    return n_nodes;
+}
+
+bool is_numa_first_touch_enabled() {
+    static const bool enabled = getenv_int("DNNL_NUMA_FIRST_TOUCH",
+                                        get_num_numa_nodes() > 1 ? 1 : 0)
+            != 0;
+    return enabled;
+}
+
+void numa_first_touch(void *ptr, size_t size) {
+    const size_t page_size = PAGE_4K;
+    const size_t n_pages = utils::div_up(size, page_size);
+    const int n_nodes = get_num_numa_nodes();
+    // Nested parallel regions run on one thread, so there is no point to
+    // split the pages there.
+    if (ptr == nullptr || n_pages < 2 || dnnl_in_parallel()) return;
+
+    char *base = static_cast<char *>(ptr);
+    parallel(0, [&](const int ithr, const int nthr) {
+        size_t start {0}, end {0};
+        balance211_numa(n_pages, nthr, ithr, n_nodes, start, end);
+        if (start == end) return;
+        const size_t off = start * page_size;
+        memset(base + off, 0, nstl::min(end * page_size, size) - off);
+    });
+}
+
 int get_vector_register_size() {
 #if DNNL_X64
     using namespace x64;
@@ -82,6 +82,17 @@ float s8s8_weights_scale_factor();
 
 unsigned get_per_core_cache_size(int level);
 unsigned get_num_cores();
+
+// NUMA topology and placement. On A64FX every CMG is a NUMA node.
+int get_num_numa_nodes();
+// Returns true if buffers allocated by the CPU engine are first touched by
+// the threads that compute on them. Defaults to true on NUMA systems, can be
+// overridden with the DNNL_NUMA_FIRST_TOUCH environment variable.
+bool is_numa_first_touch_enabled();
+// Touches the pages of [ptr, ptr + size) from the threads of parallel() with
+// the balance211_numa() split of the pages, so that every page is placed on
+// the node of the thread that owns the matching slice of the buffer.
+void numa_first_touch(void *ptr, size_t size);
 #if DNNL_AARCH64
 unsigned int get_A64FX_cache_size(int level, bool per_core, int nthreads);
 #endif
@@ -113,6 +113,8 @@ void ref_inner_product_fwd_t<src_type, wei_type, dst_type,
 
 using namespace data_type;
 template struct ref_inner_product_fwd_t<f32>;
+template struct ref_inner_product_fwd_t<bf16, bf16, f32, f32>;
+template struct ref_inner_product_fwd_t<bf16, bf16, bf16, f32>;
 template struct ref_inner_product_fwd_t<u8, s8, f32, s32>;
 template struct ref_inner_product_fwd_t<u8, s8, s32, s32>;
 template struct ref_inner_product_fwd_t<u8, s8, s8, s32>;
@@ -193,14 +195,17 @@ void ref_inner_product_bwd_data_t<diff_src_type, wei_type, diff_dst_type,
 }
 
 template struct ref_inner_product_bwd_data_t<f32, f32, f32, f32>;
+template struct ref_inner_product_bwd_data_t<f32, bf16, bf16, f32>;
+template struct ref_inner_product_bwd_data_t<bf16, bf16, bf16, f32>;
 
-template <impl::data_type_t data_type>
-void ref_inner_product_bwd_weights_t<data_type>::execute_backward_weights(
-        const exec_ctx_t &ctx) const {
-    auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
-    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto diff_weights = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_WEIGHTS);
-    auto diff_bias = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_BIAS);
+template <data_type_t src_type, data_type_t diff_wei_type,
+        data_type_t diff_dst_type, data_type_t acc_type>
+void ref_inner_product_bwd_weights_t<src_type, diff_wei_type, diff_dst_type,
+        acc_type>::execute_backward_weights(const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto diff_weights = CTX_OUT_MEM(diff_wei_data_t *, DNNL_ARG_DIFF_WEIGHTS);
+    auto diff_bias = CTX_OUT_MEM(diff_wei_data_t *, DNNL_ARG_DIFF_BIAS);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
@@ -222,7 +227,7 @@ void ref_inner_product_bwd_weights_t<data_type>::execute_backward_weights(
             for (int kd = 0; kd < KD; ++kd) {
                 for (int kh = 0; kh < KH; ++kh) {
                     for (int kw = 0; kw < KW; ++kw) {
-                        data_t *dw(nullptr);
+                        diff_wei_data_t *dw(nullptr);
                         switch (ndims) {
                             case 3:
                                 dw = &diff_weights[diff_weights_d.off(
@@ -238,35 +243,40 @@ void ref_inner_product_bwd_weights_t<data_type>::execute_backward_weights(
                                 break;
                             default: assert(!"unsupported ndims size");
                         }
-                        *dw = data_t(0);
+                        acc_data_t d = acc_data_t(0);
                         for (int mb = 0; mb < MB; ++mb) {
+                            const acc_data_t dd = (acc_data_t)
+                                    diff_dst[diff_dst_d.off(mb, oc)];
                             switch (ndims) {
                                 case 3:
-                                    *dw += diff_dst[diff_dst_d.off(mb, oc)]
-                                            * src[src_d.off(
+                                    d += dd
+                                            * (acc_data_t)src[src_d.off(
                                                     mb, ic, kd, kh, kw)];
                                     break;
                                 case 2:
-                                    *dw += diff_dst[diff_dst_d.off(mb, oc)]
-                                            * src[src_d.off(mb, ic, kh, kw)];
+                                    d += dd
+                                            * (acc_data_t)src[src_d.off(
+                                                    mb, ic, kh, kw)];
                                     break;
                                 case 1:
-                                    *dw += diff_dst[diff_dst_d.off(mb, oc)]
-                                            * src[src_d.off(mb, ic, kw)];
+                                    d += dd
+                                            * (acc_data_t)src[src_d.off(
+                                                    mb, ic, kw)];
                                     break;
                                 default: assert(!"unsupported ndims size");
                             }
                         }
+                        *dw = (diff_wei_data_t)d;
                     }
                 }
             }
         } else {
-            data_t *dw = &diff_weights[diff_weights_d.off(oc, ic)];
-            *dw = data_t(0);
+            acc_data_t d = acc_data_t(0);
             for (int mb = 0; mb < MB; ++mb) {
-                *dw += diff_dst[diff_dst_d.off(mb, oc)]
-                        * src[src_d.off(mb, ic)];
+                d += (acc_data_t)diff_dst[diff_dst_d.off(mb, oc)]
+                        * (acc_data_t)src[src_d.off(mb, ic)];
             }
+            diff_weights[diff_weights_d.off(oc, ic)] = (diff_wei_data_t)d;
         }
     });
 
@@ -274,15 +284,17 @@ void ref_inner_product_bwd_weights_t<data_type>::execute_backward_weights(
         diff_bias += diff_bias_d.offset0();
 
         parallel_nd(OC, [&](int oc) {
-            data_t *db = &diff_bias[oc];
-            *db = data_t(0);
+            acc_data_t db = acc_data_t(0);
             for (int mb = 0; mb < MB; ++mb)
-                *db += diff_dst[diff_dst_d.off(mb, oc)];
+                db += (acc_data_t)diff_dst[diff_dst_d.off(mb, oc)];
+            diff_bias[oc] = (diff_wei_data_t)db;
         });
     }
 }
 
-template struct ref_inner_product_bwd_weights_t<data_type::f32>;
+template struct ref_inner_product_bwd_weights_t<f32>;
+template struct ref_inner_product_bwd_weights_t<bf16, f32, bf16, f32>;
+template struct ref_inner_product_bwd_weights_t<bf16, bf16, bf16, f32>;
 
 } // namespace cpu
 } // namespace impl
@@ -25,6 +25,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_inner_product_pd.hpp"
+#include "cpu/platform.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -46,9 +47,12 @@ struct ref_inner_product_fwd_t : public primitive_t {
                     && weights_md()->data_type == wei_type
                     && desc()->accum_data_type == acc_type
                     && dst_md()->data_type == dst_type
+                    && platform::has_data_type_support(src_type)
+                    && platform::has_data_type_support(wei_type)
+                    && platform::has_data_type_support(dst_type)
                     && IMPLICATION(with_bias(),
-                            utils::one_of(
-                                    weights_md(1)->data_type, f32, s32, s8, u8))
+                            utils::one_of(weights_md(1)->data_type, f32, bf16,
+                                    s32, s8, u8))
                     && attr()->has_default_values(
                             primitive_attr_t::skip_mask_t::post_ops)
                     && attr()->post_ops_.len() <= 1
@@ -91,6 +95,9 @@ struct ref_inner_product_bwd_data_t : public primitive_t {
                     && weights_md()->data_type == wei_type
                     && desc()->accum_data_type == acc_type
                     && diff_dst_md()->data_type == diff_dst_type
+                    && platform::has_data_type_support(diff_src_type)
+                    && platform::has_data_type_support(wei_type)
+                    && platform::has_data_type_support(diff_dst_type)
                     && attr()->has_default_values()
                     && set_default_params() == status::success;
             return ok ? status::success : status::unimplemented;
@@ -114,7 +121,10 @@ private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 };
 
-template <impl::data_type_t data_type>
+template <impl::data_type_t src_type,
+        impl::data_type_t diff_wei_type = src_type,
+        impl::data_type_t diff_dst_type = src_type,
+        impl::data_type_t acc_type = diff_wei_type>
 struct ref_inner_product_bwd_weights_t : public primitive_t {
     struct pd_t : public cpu_inner_product_bwd_weights_pd_t {
         using cpu_inner_product_bwd_weights_pd_t::
@@ -124,11 +134,15 @@ struct ref_inner_product_bwd_weights_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             bool ok = true && desc()->prop_kind == prop_kind::backward_weights
-                    && utils::everyone_is(data_type, src_md()->data_type,
-                            diff_dst_md()->data_type,
-                            diff_weights_md()->data_type)
+                    && src_md()->data_type == src_type
+                    && diff_weights_md()->data_type == diff_wei_type
+                    && desc()->accum_data_type == acc_type
+                    && diff_dst_md()->data_type == diff_dst_type
                     && IMPLICATION(with_bias(),
-                            data_type == diff_weights_md(1)->data_type)
+                            diff_wei_type == diff_weights_md(1)->data_type)
+                    && platform::has_data_type_support(src_type)
+                    && platform::has_data_type_support(diff_wei_type)
+                    && platform::has_data_type_support(diff_dst_type)
                     && attr()->has_default_values()
                     && set_default_params() == status::success;
             return ok ? status::success : status::unimplemented;
@@ -136,7 +150,11 @@ struct ref_inner_product_bwd_weights_t : public primitive_t {
     };
 
     ref_inner_product_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {}
-    typedef typename prec_traits<data_type>::type data_t;
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<diff_wei_type>::type diff_wei_data_t;
+    typedef typename prec_traits<diff_dst_type>::type diff_dst_data_t;
+    typedef typename prec_traits<acc_type>::type acc_data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
         execute_backward_weights(ctx);
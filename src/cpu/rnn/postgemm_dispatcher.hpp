@@ -122,6 +122,7 @@ struct rnn_postgemm_dispatcher {
         }
 
         DNNL_X64_ONLY(initialize_jit(rnn));
+        DNNL_AARCH64_ONLY(initialize_jit(rnn));
     }
 
     ~rnn_postgemm_dispatcher() = default;
@@ -162,7 +163,7 @@ struct rnn_postgemm_dispatcher {
 
     // template <typename src_data_t, typename acc_data_t>
     rnn_postgemm_sig(execute) {
-#if DNNL_X64
+#if DNNL_X64 || DNNL_AARCH64
         if (rnn_postgemm_) {
             rnn_postgemm_->execute(rnn, cell_position, ws_gates_,
                     scratch_gates_, dst_layer_, dst_iter_c_, src_iter_,
@@ -187,7 +188,7 @@ struct rnn_postgemm_dispatcher {
 
     // template <typename src_data_t, typename acc_data_t>
     rnn_postgemm_sig(execute_part2) {
-#if DNNL_X64
+#if DNNL_X64 || DNNL_AARCH64
         if (rnn_postgemm_part2_) {
             rnn_postgemm_part2_->execute(rnn, cell_position, ws_gates_,
                     scratch_gates_, dst_layer_, dst_iter_c_, src_iter_,
@@ -225,12 +226,21 @@ private:
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(rnn_postgemm_dispatcher);
 
+#if DNNL_X64 || DNNL_AARCH64
 #if DNNL_X64
-    std::unique_ptr<x64::jit_uni_rnn_postgemm> rnn_postgemm_;
-    std::unique_ptr<x64::jit_uni_rnn_postgemm> rnn_postgemm_part2_;
+    using jit_uni_rnn_postgemm_t = x64::jit_uni_rnn_postgemm;
+#else
+    using jit_uni_rnn_postgemm_t = aarch64::jit_uni_rnn_postgemm;
+#endif
+    std::unique_ptr<jit_uni_rnn_postgemm_t> rnn_postgemm_;
+    std::unique_ptr<jit_uni_rnn_postgemm_t> rnn_postgemm_part2_;
 
     void initialize_jit(const rnn_utils::rnn_conf_t &rnn) {
+#if DNNL_X64
         using namespace dnnl::impl::cpu::x64;
+#else
+        using namespace dnnl::impl::cpu::aarch64;
+#endif
 
         if (pd_->attr()->rnn_tparams_.test_mode_) return;
 
@@ -240,6 +250,7 @@ private:
         const bool jit_bwd = !pd_->is_fwd()
                 && utils::one_of(src_type, data_type::f32, data_type::bf16);
 
+#if DNNL_X64
 #define CREATE_WITH_DIR(k, ker_t) \
     do { \
         if (mayiuse(avx512_core)) \
@@ -249,6 +260,15 @@ private:
         else \
             k.reset(new ker_t<sse41, src_type, scratch_type>(rnn, pd_)); \
     } while (0)
+#else
+        // The kernels are translated to SVE-512, without it the reference
+        // postgemm is used.
+#define CREATE_WITH_DIR(k, ker_t) \
+    do { \
+        if (mayiuse(avx512_core)) \
+            k.reset(new ker_t<avx512_core, src_type, scratch_type>(rnn, pd_)); \
+    } while (0)
+#endif
 #define CREATE(k, ker_t) \
     do { \
         if (jit_fwd) CREATE_WITH_DIR(k, CONCAT2(ker_t, _fwd)); \
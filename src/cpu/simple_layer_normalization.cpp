@@ -121,24 +121,26 @@ void simple_layer_normalization_fwd_t<data_type>::execute_forward(
     const dim_t N = pd()->across_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
 
-    const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
 
-    parallel_nd(N, [&](dim_t n) {
-        auto v_mean = calculate_stats ? 0 : mean[n];
-        auto v_variance = calculate_stats ? 0 : variance[n];
+    // The rows are passed to the kernels in blocks that fit in L1, so the
+    // data kernel finds the rows just read by the statistics kernel there
+    // and short rows do not pay a kernel call each.
+    const dim_t row_size = C_padded * sizeof(data_t);
+    const dim_t block_rows = nstl::max<dim_t>(1, 16384 / row_size);
 
-        if (calculate_stats)
-            (*stat_kernel_)(&src[n * C_padded], &v_mean, &v_variance);
-
-        (*data_kernel_)(&src[n * C_padded], &dst[n * C_padded], scaleshift,
-                &v_mean, &v_variance);
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t N_s = 0, N_e = 0;
+        balance211(N, nthr, ithr, N_s, N_e);
 
-        if (calculate_stats) {
-            if (save_stats) {
-                mean[n] = v_mean;
-                variance[n] = v_variance;
-            }
+        for (dim_t n = N_s; n < N_e; n += block_rows) {
+            const dim_t nrows = nstl::min(block_rows, N_e - n);
+            if (calculate_stats)
+                stat_kernel_->process_rows(
+                        &src[n * C_padded], &mean[n], &variance[n], nrows);
+            data_kernel_->process_rows(&src[n * C_padded],
+                    &dst[n * C_padded], scaleshift, &mean[n], &variance[n],
+                    nrows);
         }
     });
 }
@@ -213,10 +215,10 @@ void simple_layer_normalization_bwd_t<data_type>::execute_backward(
             my_diff_gamma[c] = 0.;
             my_diff_beta[c] = 0.;
         }
-        for (dim_t n = N_s; n < N_e; n++) {
-            (*diff_ss_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
-                    my_diff_gamma, my_diff_beta, &mean[n], &variance[n]);
-        }
+        if (N_s < N_e)
+            diff_ss_kernel_->process_rows(&src[N_s * C_padded],
+                    &diff_dst[N_s * C_padded], my_diff_gamma, my_diff_beta,
+                    &mean[N_s], &variance[N_s], N_e - N_s);
     });
 
     parallel_nd(C, [&](dim_t c) {
@@ -234,11 +236,10 @@ void simple_layer_normalization_bwd_t<data_type>::execute_backward(
         dim_t N_s = 0, N_e = 0;
         balance211(N, nthr, ithr, N_s, N_e);
 
-        for (dim_t n = N_s; n < N_e; n++) {
-            (*diff_data_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
-                    &diff_src[n * C_padded], scaleshift, &mean[n],
-                    &variance[n]);
-        }
+        if (N_s < N_e)
+            diff_data_kernel_->process_rows(&src[N_s * C_padded],
+                    &diff_dst[N_s * C_padded], &diff_src[N_s * C_padded],
+                    scaleshift, &mean[N_s], &variance[N_s], N_e - N_s);
     });
 }
 
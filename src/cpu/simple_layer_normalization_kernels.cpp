@@ -18,6 +18,8 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_layer_normalization_kernels.hpp"
 #endif
 
 #include "cpu/simple_layer_normalization_kernels.hpp"
@@ -29,9 +31,9 @@ namespace lnorm_utils {
 
 using namespace data_type;
 
-template <>
-void statistics_kernel_t<f32>::operator()(
-        const float *src, float *mean, float *var) const {
+template <data_type_t data_type>
+void statistics_kernel_t<data_type>::operator()(
+        const data_t *src, float *mean, float *var) const {
     float v_mean = 0;
     PRAGMA_OMP_SIMD(reduction(+ : v_mean))
     for (dim_t c = 0; c < C_; ++c) {
@@ -42,7 +44,7 @@ void statistics_kernel_t<f32>::operator()(
     float v_variance = 0;
     PRAGMA_OMP_SIMD(reduction(+ : v_variance))
     for (dim_t c = 0; c < C_; ++c) {
-        auto m = src[c] - v_mean;
+        auto m = (float)src[c] - v_mean;
         v_variance += m * m;
     }
     v_variance /= C_;
@@ -51,34 +53,34 @@ void statistics_kernel_t<f32>::operator()(
     *var = v_variance;
 }
 
-template <>
-void data_kernel_t<f32>::operator()(const float *src, float *dst,
+template <data_type_t data_type>
+void data_kernel_t<data_type>::operator()(const data_t *src, data_t *dst,
         const float *ss, const float *mean, const float *var) const {
     const float inv_sqrtvar = 1. / sqrtf(*var + eps_);
     PRAGMA_OMP_SIMD()
     for (dim_t c = 0; c < C_; ++c) {
         const float sm = (use_scaleshift_ ? ss[c] : 1.0f) * inv_sqrtvar;
         const float sv = use_scaleshift_ ? ss[C_ + c] : 0;
-        dst[c] = sm * (src[c] - *mean) + sv;
+        dst[c] = sm * ((float)src[c] - *mean) + sv;
     }
 }
 
-template <>
-void diff_ss_kernel_t<f32>::operator()(const float *src, const float *diff_dst,
-        float *diff_gamma, float *diff_beta, const float *mean,
-        const float *var) const {
+template <data_type_t data_type>
+void diff_ss_kernel_t<data_type>::operator()(const data_t *src,
+        const data_t *diff_dst, float *diff_gamma, float *diff_beta,
+        const float *mean, const float *var) const {
     const float inv_sqrtvar = 1. / sqrtf(*var + eps_);
     PRAGMA_OMP_SIMD()
     for (dim_t c = 0; c < C_; c++) {
         float dd = diff_dst[c];
-        diff_gamma[c] += (src[c] - *mean) * dd * inv_sqrtvar;
+        diff_gamma[c] += ((float)src[c] - *mean) * dd * inv_sqrtvar;
         diff_beta[c] += dd;
     }
 }
 
-template <>
-void diff_data_kernel_t<f32>::operator()(const float *src,
-        const float *diff_dst, float *diff_src, const float *ss,
+template <data_type_t data_type>
+void diff_data_kernel_t<data_type>::operator()(const data_t *src,
+        const data_t *diff_dst, data_t *diff_src, const float *ss,
         const float *mean, const float *var) const {
     const float inv_sqrtvar = 1.f / sqrtf(*var + eps_);
     float dd_gamma = 0, dd_gamma_x = 0;
@@ -86,47 +88,55 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
         PRAGMA_OMP_SIMD(reduction(+ : dd_gamma, dd_gamma_x))
         for (dim_t c = 0; c < C_; c++) {
             float gamma = use_scaleshift_ ? ss[c] : 1;
-            dd_gamma += diff_dst[c] * gamma;
-            dd_gamma_x += diff_dst[c] * gamma * (src[c] - *mean);
+            dd_gamma += (float)diff_dst[c] * gamma;
+            dd_gamma_x += (float)diff_dst[c] * gamma * ((float)src[c] - *mean);
         }
         dd_gamma_x *= inv_sqrtvar;
     }
     PRAGMA_OMP_SIMD()
     for (dim_t c = 0; c < C_; c++) {
         const float gamma = use_scaleshift_ ? ss[c] : 1;
-        float v_diff_src = diff_dst[c] * gamma;
+        float v_diff_src = (float)diff_dst[c] * gamma;
         if (calculate_diff_stats_)
             v_diff_src -= dd_gamma / C_
-                    + (src[c] - *mean) * dd_gamma_x * inv_sqrtvar / C_;
+                    + ((float)src[c] - *mean) * dd_gamma_x * inv_sqrtvar / C_;
         v_diff_src *= inv_sqrtvar;
         diff_src[c] = v_diff_src;
     }
 }
 
-template <>
-void diff_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
-        const bfloat16_t *diff_dst, bfloat16_t *diff_src, const float *ss,
-        const float *mean, const float *var) const {
-    assert(!"No default diff_data_kernel_t operator() for bf16 input!");
+template <data_type_t data_type>
+void statistics_kernel_t<data_type>::process_rows(
+        const data_t *src, float *mean, float *var, dim_t nrows) const {
+    for (dim_t n = 0; n < nrows; n++)
+        (*this)(&src[n * C_padded_], &mean[n], &var[n]);
 }
 
-template <>
-void statistics_kernel_t<bf16>::operator()(
-        const bfloat16_t *src, float *mean, float *var) const {
-    assert(!"No default statistics_kernel_t operator() for bf16 input!");
+template <data_type_t data_type>
+void data_kernel_t<data_type>::process_rows(const data_t *src, data_t *dst,
+        const float *ss, const float *mean, const float *var,
+        dim_t nrows) const {
+    for (dim_t n = 0; n < nrows; n++)
+        (*this)(&src[n * C_padded_], &dst[n * C_padded_], ss, &mean[n],
+                &var[n]);
 }
 
-template <>
-void data_kernel_t<bf16>::operator()(const bfloat16_t *src, bfloat16_t *dst,
-        const float *ss, const float *mean, const float *var) const {
-    assert(!"No default data_kernel_t operator() for bf16 input!");
+template <data_type_t data_type>
+void diff_ss_kernel_t<data_type>::process_rows(const data_t *src,
+        const data_t *diff_dst, float *diff_gamma, float *diff_beta,
+        const float *mean, const float *var, dim_t nrows) const {
+    for (dim_t n = 0; n < nrows; n++)
+        (*this)(&src[n * C_padded_], &diff_dst[n * C_padded_], diff_gamma,
+                diff_beta, &mean[n], &var[n]);
 }
 
-template <>
-void diff_ss_kernel_t<bf16>::operator()(const bfloat16_t *src,
-        const bfloat16_t *diff_dst, float *diff_gamma, float *diff_beta,
-        const float *mean, const float *var) const {
-    assert(!"No default diff_ss_kernel_t operator() for bf16 input!");
+template <data_type_t data_type>
+void diff_data_kernel_t<data_type>::process_rows(const data_t *src,
+        const data_t *diff_dst, data_t *diff_src, const float *ss,
+        const float *mean, const float *var, dim_t nrows) const {
+    for (dim_t n = 0; n < nrows; n++)
+        (*this)(&src[n * C_padded_], &diff_dst[n * C_padded_],
+                &diff_src[n * C_padded_], ss, &mean[n], &var[n]);
 }
 
 // Interface section
@@ -137,11 +147,11 @@ statistics_kernel_t<data_type> *statistics_kernel_t<data_type>::create(
 #if DNNL_X64
     if (auto *res = x64::lnorm_utils::statistics_kernel_create<data_type>(pd))
         return res;
+#elif DNNL_AARCH64
+    if (auto *res
+            = aarch64::lnorm_utils::statistics_kernel_create<data_type>(pd))
+        return res;
 #endif
-    if (data_type == bf16) {
-        assert(!"No default statistics_kernel_t for bf16 input!");
-        return nullptr;
-    }
     return new statistics_kernel_t<data_type>(pd);
 }
 
@@ -151,11 +161,10 @@ data_kernel_t<data_type> *data_kernel_t<data_type>::create(
 #if DNNL_X64
     if (auto *res = x64::lnorm_utils::data_kernel_create<data_type>(pd))
         return res;
+#elif DNNL_AARCH64
+    if (auto *res = aarch64::lnorm_utils::data_kernel_create<data_type>(pd))
+        return res;
 #endif
-    if (data_type == bf16) {
-        assert(!"No default data_kernel_t for bf16 input!");
-        return nullptr;
-    }
     return new data_kernel_t<data_type>(pd);
 }
 
@@ -165,11 +174,10 @@ diff_ss_kernel_t<data_type> *diff_ss_kernel_t<data_type>::create(
 #if DNNL_X64
     if (auto *res = x64::lnorm_utils::diff_ss_kernel_create<data_type>(pd))
         return res;
+#elif DNNL_AARCH64
+    if (auto *res = aarch64::lnorm_utils::diff_ss_kernel_create<data_type>(pd))
+        return res;
 #endif
-    if (data_type == bf16) {
-        assert(!"No default diff_ss_kernel_t for bf16 input!");
-        return nullptr;
-    }
     return new diff_ss_kernel_t<data_type>(pd);
 }
 
@@ -179,11 +187,11 @@ diff_data_kernel_t<data_type> *diff_data_kernel_t<data_type>::create(
 #if DNNL_X64
     if (auto *res = x64::lnorm_utils::diff_data_kernel_create<data_type>(pd))
         return res;
+#elif DNNL_AARCH64
+    if (auto *res
+            = aarch64::lnorm_utils::diff_data_kernel_create<data_type>(pd))
+        return res;
 #endif
-    if (data_type == bf16) {
-        assert(!"No default diff_data_kernel_t for bf16 input!");
-        return nullptr;
-    }
     return new diff_data_kernel_t<data_type>(pd);
 }
 
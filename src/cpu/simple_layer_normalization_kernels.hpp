@@ -18,12 +18,18 @@
 #define CPU_SIMPLE_LAYER_NORMALIZATION_KERNELS_HPP
 
 #include "common/layer_normalization_pd.hpp"
+#include "common/memory_desc_wrapper.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace lnorm_utils {
 
+// Distance between two consecutive rows of the normalized axis.
+inline dim_t padded_norm_axis(const layer_normalization_pd_t *pd) {
+    return memory_desc_wrapper(pd->src_md()).padded_dims()[pd->ndims() - 1];
+}
+
 template <data_type_t data_type>
 struct statistics_kernel_t {
     using data_t = typename prec_traits<data_type>::type;
@@ -33,11 +39,17 @@ struct statistics_kernel_t {
 
     virtual void operator()(const data_t *src, float *mean, float *var) const;
 
+    // Processes `nrows` consecutive rows, `mean` and `var` hold a value per
+    // row. Kernels that can amortize the call over the rows override it.
+    virtual void process_rows(
+            const data_t *src, float *mean, float *var, dim_t nrows) const;
+
 protected:
     statistics_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis()) {}
+        : C_(pd->norm_axis()), C_padded_(padded_norm_axis(pd)) {}
 
     int C_;
+    dim_t C_padded_;
 };
 
 template <data_type_t data_type>
@@ -48,14 +60,18 @@ struct data_kernel_t {
 
     virtual void operator()(const data_t *src, data_t *dst, const float *ss,
             const float *mean, const float *var) const;
+    virtual void process_rows(const data_t *src, data_t *dst, const float *ss,
+            const float *mean, const float *var, dim_t nrows) const;
 
 protected:
     data_kernel_t(const layer_normalization_pd_t *pd)
         : C_(pd->norm_axis())
+        , C_padded_(padded_norm_axis(pd))
         , use_scaleshift_(pd->use_scaleshift())
         , eps_(pd->desc()->layer_norm_epsilon) {}
 
     int C_;
+    dim_t C_padded_;
     bool use_scaleshift_;
     const float eps_;
 };
@@ -70,12 +86,18 @@ struct diff_ss_kernel_t {
     virtual void operator()(const data_t *src, const data_t *diff_dst,
             float *diff_gamma, float *diff_beta, const float *mean,
             const float *var) const;
+    virtual void process_rows(const data_t *src, const data_t *diff_dst,
+            float *diff_gamma, float *diff_beta, const float *mean,
+            const float *var, dim_t nrows) const;
 
 protected:
     diff_ss_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis()), eps_(pd->desc()->layer_norm_epsilon) {}
+        : C_(pd->norm_axis())
+        , C_padded_(padded_norm_axis(pd))
+        , eps_(pd->desc()->layer_norm_epsilon) {}
 
     int C_;
+    dim_t C_padded_;
     const float eps_;
 };
 
@@ -89,15 +111,20 @@ struct diff_data_kernel_t {
     virtual void operator()(const data_t *src, const data_t *diff_dst,
             data_t *diff_src, const float *ss, const float *mean,
             const float *var) const;
+    virtual void process_rows(const data_t *src, const data_t *diff_dst,
+            data_t *diff_src, const float *ss, const float *mean,
+            const float *var, dim_t nrows) const;
 
 protected:
     diff_data_kernel_t(const layer_normalization_pd_t *pd)
         : C_(pd->norm_axis())
+        , C_padded_(padded_norm_axis(pd))
         , eps_(pd->desc()->layer_norm_epsilon)
         , calculate_diff_stats_(!pd->use_global_stats())
         , use_scaleshift_(pd->use_scaleshift()) {}
 
     int C_;
+    dim_t C_padded_;
     const float eps_;
     bool calculate_diff_stats_;
     bool use_scaleshift_;
@@ -1525,6 +1525,15 @@ public:
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(jit_generator);
 
+    // The code is final once it is requested. Callers may request it more
+    // than once, so its size is accounted only the first time.
+    bool code_size_accounted_ = false;
+    void account_code_size() {
+        if (code_size_accounted_) return;
+        add_jit_code_size(getSize());
+        code_size_accounted_ = true;
+    }
+
 public:
     jit_generator(void *code_ptr = nullptr, size_t code_size = MAX_CODE_SIZE,
             bool use_autogrow = true)
@@ -1544,6 +1553,7 @@ public:
         this->ready();
         const Xbyak::uint8 *code = CodeGenerator::getCode();
         register_jit_code(code, getSize());
+        account_code_size();
         return code;
     }
 
@@ -57,6 +57,7 @@ const char *driver_name = "";
 double max_ms_per_prb {3e3};
 int min_times_per_prb {5};
 int fix_times_per_prb {0};
+bool perf_counters {false};
 
 bool fast_ref_gpu {true};
 
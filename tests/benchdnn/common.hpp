@@ -132,6 +132,7 @@ extern const char *driver_name;
 extern double max_ms_per_prb; /** maximum time spends per prb in ms */
 extern int min_times_per_prb; /** minimal amount of runs per prb */
 extern int fix_times_per_prb; /** if non-zero run prb that many times */
+extern bool perf_counters; /** collect hardware counters while measuring */
 
 extern bool fast_ref_gpu;
 
@@ -165,6 +165,13 @@ int measure_perf(benchdnn_timer_t &t, dnnl_primitive_t prim, args_t &args) {
         std::vector<dnnl_exec_arg_t> dnnl_args;
         execute_unmap_args(args, dnnl_args);
 
+        // The counters are reset here and read by the perf report, so only
+        // the executions measured below are reported.
+        if (perf_counters) {
+            DNN_SAFE(dnnl_set_perf_counters(1), WARN);
+            DNN_SAFE(dnnl_reset_perf_counters(), WARN);
+        }
+
         // For CPU: measure indiividual iterations
         // For GPU: measure iterations in batches to hide driver overhead
         if (engine_kind == dnnl_cpu)
@@ -172,6 +179,8 @@ int measure_perf(benchdnn_timer_t &t, dnnl_primitive_t prim, args_t &args) {
         else
             ret = measure_perf_aggregate(t, stream, prim, dnnl_args);
 
+        if (perf_counters) DNN_SAFE(dnnl_set_perf_counters(0), WARN);
+
         if (ret == OK) execute_map_args(args);
     }
     return ret;
@@ -27,6 +27,42 @@
 
 namespace eltwise {
 
+// Runs the problem with the code translated from x64 and with the native
+// AArch64 code and reports the size of the generated code and the time for
+// both. The primitive cache is disabled so the code is generated every time.
+static void compare_jit(const prb_t *p, const char *pstr) {
+    int capacity = 0;
+    DNN_SAFE_V(dnnl_get_primitive_cache_capacity(&capacity));
+    DNN_SAFE_V(dnnl_set_primitive_cache_capacity(0));
+    int jit_native = 1;
+    DNN_SAFE_V(dnnl_get_jit_native(&jit_native));
+
+    const char *names[2] = {"translated", "native"};
+    size_t code_size[2] = {0, 0};
+    double ms[2] = {0, 0};
+    for (int native = 0; native < 2; native++) {
+        DNN_SAFE_V(dnnl_set_jit_native(native));
+        size_t code_size_start = 0, code_size_end = 0;
+        DNN_SAFE_V(dnnl_get_jit_code_size(&code_size_start));
+
+        res_t res {};
+        const int status = doit(p, &res);
+        DNN_SAFE_V(dnnl_get_jit_code_size(&code_size_end));
+        code_size[native] = code_size_end - code_size_start;
+        ms[native] = res.timer.ms();
+
+        bool want_perf_report = false;
+        parse_result(res, want_perf_report, status, pstr);
+        benchdnn_stat.tests++;
+    }
+
+    BENCHDNN_PRINT(0, "jit-compare,%s,%s:%zuB:%gms,%s:%zuB:%gms\n", pstr,
+            names[0], code_size[0], ms[0], names[1], code_size[1], ms[1]);
+
+    DNN_SAFE_V(dnnl_set_jit_native(jit_native));
+    DNN_SAFE_V(dnnl_set_primitive_cache_capacity(capacity));
+}
+
 void check_correctness(const settings_t &s) {
     for_(const auto &i_dir : s.dir)
     for_(const auto &i_dt : s.dt)
@@ -86,6 +122,11 @@ void check_correctness(const settings_t &s) {
         const char *pstr = cpp_pstr.c_str();
         BENCHDNN_PRINT(1, "run: %s\n", pstr);
 
+        if (s.jit_compare) {
+            compare_jit(&p, pstr);
+            continue;
+        }
+
         res_t res {};
         const int status = doit(&p, &res);
 
@@ -119,6 +160,8 @@ int bench(int argc, char **argv) {
                         s.alg, def.alg, attr_t::post_ops_t::str2kind, argv[0])
                 || parse_inplace(s.inplace, def.inplace, argv[0])
                 || parse_mb(s.mb, def.mb, argv[0])
+                || parse_single_value_option(s.jit_compare, def.jit_compare,
+                        str2bool, argv[0], "jit-compare")
                 || parse_perf_template(s.perf_template, s.perf_template_def,
                         s.perf_template_csv, argv[0])
                 || parse_reset(s, argv[0]);
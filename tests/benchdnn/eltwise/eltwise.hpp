@@ -48,6 +48,7 @@ struct settings_t {
     std::vector<float> scales {0, 0.25, -0.25}, alpha {scales}, beta {scales};
     std::vector<int64_t> mb {0};
     std::vector<bool> inplace {false};
+    bool jit_compare = false;
 
     const char *perf_template_csv
             = "perf,%engine%,%impl%,%dir%,%dt%,%tag%,%alg%,%DESC%,%-time%,%"
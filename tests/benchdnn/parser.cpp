@@ -22,6 +22,7 @@
 #include "dnnl.h"
 #include "dnnl_memory.hpp"
 #include "parser.hpp"
+#include "perf_report.hpp"
 
 namespace parser {
 
@@ -163,6 +164,7 @@ bool parse_perf_template(const char *&pt, const char *pt_def,
             pt = pt_def;
         else
             pt = str;
+        perf_counters = base_perf_report_t::uses_perf_counters(pt);
         return true;
     }
     return false;
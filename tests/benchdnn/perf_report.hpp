@@ -70,6 +70,19 @@ struct base_perf_report_t {
             return t.ticks(mode) / t.sec(mode) / unit;
         };
 
+        // Hardware counters are averaged over the measured executions.
+        dnnl_perf_counters_t pc = {};
+        if (perf_counters)
+            dnnl_get_perf_counters(r->impl_name.c_str(), &pc);
+        auto per_exec = [&](uint64_t value) -> double {
+            if (!pc.executions) return 0;
+            return (double)value / pc.executions / unit;
+        };
+        auto get_ipc = [&]() -> double {
+            if (!pc.cycles) return 0;
+            return (double)pc.instructions / pc.cycles;
+        };
+
         HANDLE("alg", dump_alg(s));
         HANDLE("cfg", dump_cfg(s));
         HANDLE("desc", dump_desc(s));
@@ -102,6 +115,12 @@ struct base_perf_report_t {
         HANDLE("ops", s << ops() / unit);
         HANDLE("time", s << t.ms(mode) / unit);
         HANDLE("impl", s << r->impl_name);
+        HANDLE("cycles", s << per_exec(pc.cycles));
+        HANDLE("insts", s << per_exec(pc.instructions));
+        HANDLE("ipc", s << get_ipc());
+        HANDLE("l1d_misses", s << per_exec(pc.l1d_misses));
+        HANDLE("l2_misses", s << per_exec(pc.l2_misses));
+        HANDLE("sve_insts", s << per_exec(pc.sve_instructions));
 
 #undef HANDLE
 
@@ -127,6 +146,15 @@ struct base_perf_report_t {
         BENCHDNN_PRINT(0, "%s\n", str.c_str());
     };
 
+    // Returns true if the template has fields that need hardware counters.
+    static bool uses_perf_counters(const char *pt) {
+        static const char *fields[] = {"cycles%", "insts%", "ipc%",
+                "l1d_misses%", "l2_misses%", "sve_insts%"};
+        for (const char *f : fields)
+            if (strstr(pt, f)) return true;
+        return false;
+    }
+
     /* truly common types */
     virtual double ops() const { return 0.; }
     virtual const attr_t *attr() const { return nullptr; }
@@ -68,6 +68,10 @@ CPU_INST_TEST_CASE(SimpleZeroDim, PARAMS_NC({0, 9}), PARAMS_NC({1, 0}));
 CPU_INST_TEST_CASE(
         Simple_NC, PARAMS_NC({1, 100}), PARAMS_NC({20, 8}), PARAMS_NC({2, 10}));
 
+// normalized axes that are not a multiple of the vector length
+CPU_INST_TEST_CASE(Tail_NC, PARAMS_NC({64, 17}), PARAMS_NC({5, 771}),
+        PARAMS_NC({3, 1000}));
+
 CPU_INST_TEST_CASE(Simple_TNC, PARAMS_TNC({6, 32, 8}), PARAMS_TNC({2, 10, 4}),
         PARAMS_TNC({2, 8, 16}));
 
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/common/dnnl_thread.hpp"
+
+namespace dnnl {
+
+using impl::balance211;
+using impl::balance211_numa;
+
+TEST(test_balance211_numa, TestSingleNode) {
+    for (int n : {0, 1, 7, 100})
+        for (int nthr : {1, 3, 48}) {
+            for (int ithr = 0; ithr < nthr; ithr++) {
+                int s0 = 0, e0 = 0, s1 = 0, e1 = 0;
+                balance211(n, nthr, ithr, s0, e0);
+                balance211_numa(n, nthr, ithr, 1, s1, e1);
+                ASSERT_EQ(s0, s1);
+                ASSERT_EQ(e0, e1);
+            }
+        }
+}
+
+TEST(test_balance211_numa, TestCoverage) {
+    for (int n : {0, 1, 5, 47, 1000})
+        for (int nthr : {4, 6, 13, 48})
+            for (int n_nodes : {2, 4}) {
+                // Slices are adjacent, in thread order, and cover the range.
+                int expected_start = 0;
+                for (int ithr = 0; ithr < nthr; ithr++) {
+                    int start = 0, end = 0;
+                    balance211_numa(n, nthr, ithr, n_nodes, start, end);
+                    ASSERT_EQ(start, expected_start);
+                    ASSERT_LE(start, end);
+                    expected_start = end;
+                }
+                ASSERT_EQ(expected_start, n);
+            }
+}
+
+TEST(test_balance211_numa, TestNodeSplit) {
+    // 13 threads on 4 nodes: the first node has 4 threads, the others 3. The
+    // work is still split evenly between the nodes.
+    const int n = 400, nthr = 13, n_nodes = 4;
+    int node_start[n_nodes] = {0}, node_end[n_nodes] = {0};
+    for (int node = 0; node < n_nodes; node++) {
+        int ts = 0, te = 0;
+        balance211(nthr, n_nodes, node, ts, te);
+        int s = 0, e = 0;
+        balance211_numa(n, nthr, ts, n_nodes, node_start[node], e);
+        balance211_numa(n, nthr, te - 1, n_nodes, s, node_end[node]);
+    }
+    for (int node = 0; node < n_nodes; node++) {
+        ASSERT_EQ(node_start[node], node * n / n_nodes);
+        ASSERT_EQ(node_end[node], (node + 1) * n / n_nodes);
+    }
+}
+
+} // namespace dnnl
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
@@ -29,6 +30,23 @@ TEST(test_parallel, Test) {
     });
 }
 
+TEST(test_parallel, TestEveryThreadOnce) {
+    // Regions of different sizes in a row, with nested regions.
+    for (int i = 0; i < 100; i++) {
+        const int nthr = 1 + i % dnnl_get_max_threads();
+        std::vector<int> calls(nthr, 0);
+        impl::parallel(nthr, [&](int ithr, int nthr_) {
+            ASSERT_EQ(nthr_, nthr);
+            calls[ithr]++;
+            std::atomic<int> nested_calls(0);
+            impl::parallel(0, [&](int, int) { nested_calls++; });
+            ASSERT_GE(nested_calls, 1);
+        });
+        for (int c : calls)
+            ASSERT_EQ(c, 1);
+    }
+}
+
 typedef ptrdiff_t data_t;
 
 struct nd_params_t {
@@ -1153,8 +1153,14 @@ protected:
         bool pack = (p.pack_params.pack_a || p.pack_params.pack_b);
         SKIP_IF(get_test_engine_kind() == engine::kind::gpu && pack,
                 "GPU does not support packed GEMM.");
-        SKIP_IF(!DNNL_X64 && pack,
-                "Packed GEMM does not support non-x64 CPUs.");
+        // AArch64 packs f32 and u8s8s32 (s8u8s32 internally) matrices only.
+        constexpr bool is_f32 = std::is_same<a_dt, float>::value
+                && std::is_same<b_dt, float>::value;
+        constexpr bool is_u8s8 = std::is_same<a_dt, uint8_t>::value
+                && std::is_same<b_dt, int8_t>::value;
+        constexpr bool aarch64_pack_dt = is_f32 || is_u8s8;
+        SKIP_IF(!DNNL_X64 && !(DNNL_AARCH64 && aarch64_pack_dt) && pack,
+                "Packed GEMM does not support this CPU and data type.");
         SKIP_IF((p.alpha != 1.f || p.igemm_params.oa() != 0
                         || p.igemm_params.ob() != 0)
                         && pack,
@@ -81,6 +81,37 @@ struct conv_ctx_t {
     struct conv_t c_;
 };
 
+// Scratchpad buffers of destroyed primitives are kept in the arena and
+// reused by the primitives created later. Runs before the global primitives
+// below are set up, so no other scratchpad is alive.
+HANDLE_EXCEPTIONS_FOR_TEST(global_scratchpad, TestArenaReuse) {
+    engine eng(engine::kind::cpu, 0);
+    auto create_conv = [&]() {
+        auto desc = convolution_forward::desc(prop_kind::forward,
+                algorithm::convolution_direct,
+                {{2, 16, 32, 32}, dt::f32, tag::any},
+                {{16, 16, 3, 3}, dt::f32, tag::any},
+                {{2, 16, 32, 32}, dt::f32, tag::any}, {1, 1}, {1, 1}, {1, 1});
+        auto pd = convolution_forward::primitive_desc(desc, eng);
+        auto conv = convolution_forward(pd);
+        return pd.query_s64(query::memory_consumption_s64);
+    };
+
+    const auto stats0 = get_scratchpad_arena_stats();
+    if (create_conv() == 0) return;
+    const auto stats1 = get_scratchpad_arena_stats();
+    // The arena is not used in builds with memory debug.
+    if (stats1.hits + stats1.misses == stats0.hits + stats0.misses) return;
+    create_conv();
+    const auto stats2 = get_scratchpad_arena_stats();
+
+    ASSERT_EQ(stats1.in_use_bytes, stats0.in_use_bytes);
+    ASSERT_EQ(stats2.in_use_bytes, stats0.in_use_bytes);
+    ASSERT_GT(stats2.hits, stats1.hits);
+    ASSERT_EQ(stats2.misses, stats1.misses);
+    ASSERT_GE(stats2.peak_bytes, stats2.in_use_bytes + stats2.idle_bytes);
+}
+
 conv_ctx_t global_conv_ctx1;
 conv_ctx_t global_conv_ctx2;
 
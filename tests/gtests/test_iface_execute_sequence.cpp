@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "dnnl_test_macros.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+class execute_sequence_test : public ::testing::Test {
+protected:
+    using args_t = std::unordered_map<int, memory>;
+
+    void SetUp() override {
+        eng = get_test_engine();
+        md = memory::desc({2, 16, 7, 7}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        stat_md = memory::desc(
+                {16}, memory::data_type::f32, memory::format_tag::a);
+    }
+
+    // Returns a primitive computing dst = alpha * src + beta.
+    eltwise_forward make_linear(float alpha, float beta) {
+        auto d = eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_linear, md, alpha, beta);
+        return eltwise_forward(eltwise_forward::primitive_desc(d, eng));
+    }
+
+    batch_normalization_forward make_bnorm() {
+        auto d = batch_normalization_forward::desc(
+                prop_kind::forward_training, md, 1e-5f, normalization_flags());
+        return batch_normalization_forward(
+                batch_normalization_forward::primitive_desc(d, eng));
+    }
+
+    memory make_memory(const memory::desc &amd, float shift) {
+        memory m(amd, eng);
+        float *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t nelems = amd.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = shift + (float)(i % 13) - 6.f;
+        return m;
+    }
+
+    void check_equal(const memory &a, const memory &b) {
+        const float *pa = static_cast<const float *>(a.get_data_handle());
+        const float *pb = static_cast<const float *>(b.get_data_handle());
+        const size_t nelems = a.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(pa[i], pb[i]);
+    }
+
+    // Builds the arguments of src -> linear -> bnorm -> linear -> dst.
+    void make_chain(std::vector<memory> &mems, std::vector<args_t> &args) {
+        mems = {make_memory(md, 1.f), make_memory(md, 0.f),
+                make_memory(md, 0.f), make_memory(md, 0.f),
+                make_memory(stat_md, 0.f), make_memory(stat_md, 0.f)};
+        args = {{{DNNL_ARG_SRC, mems[0]}, {DNNL_ARG_DST, mems[1]}},
+                {{DNNL_ARG_SRC, mems[1]}, {DNNL_ARG_DST, mems[2]},
+                        {DNNL_ARG_MEAN, mems[4]},
+                        {DNNL_ARG_VARIANCE, mems[5]}},
+                {{DNNL_ARG_SRC, mems[2]}, {DNNL_ARG_DST, mems[3]}}};
+    }
+
+    engine eng;
+    memory::desc md, stat_md;
+};
+
+TEST_F(execute_sequence_test, TestSameResults) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Direct access to the memory requires a CPU engine");
+    stream strm(eng);
+
+    std::vector<primitive> primitives
+            = {make_linear(2.f, 1.f), make_bnorm(), make_linear(0.5f, -1.f)};
+
+    std::vector<memory> ref_mems, mems;
+    std::vector<args_t> ref_args, args;
+    make_chain(ref_mems, ref_args);
+    make_chain(mems, args);
+
+    for (size_t i = 0; i < primitives.size(); i++)
+        primitives[i].execute(strm, ref_args[i]);
+    strm.wait();
+
+    // Several times to reuse the workers of the previous sequences.
+    for (int iter = 0; iter < 4; iter++) {
+        execute_sequence(strm, primitives, args);
+        strm.wait();
+        for (size_t m = 0; m < mems.size(); m++)
+            check_equal(mems[m], ref_mems[m]);
+    }
+}
+
+TEST_F(execute_sequence_test, TestEmptySequence) {
+    stream strm(eng);
+    EXPECT_NO_THROW(execute_sequence(strm, {}, {}));
+}
+
+TEST_F(execute_sequence_test, TestMismatchedArguments) {
+    stream strm(eng);
+    std::vector<primitive> primitives = {make_linear(1.f, 0.f)};
+    EXPECT_ANY_THROW(execute_sequence(strm, primitives, {}));
+}
+
+} // namespace dnnl
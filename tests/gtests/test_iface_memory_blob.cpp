@@ -0,0 +1,214 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "dnnl_test_common.hpp"
+#include "dnnl_test_macros.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+class memory_blob_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        eng = get_test_engine();
+        // The output channels are not a multiple of the block, so the blocked
+        // weights have a padding area.
+        const memory::dims dims = {20, 16, 3, 3};
+        plain_md = memory::desc(
+                dims, memory::data_type::f32, memory::format_tag::oihw);
+        blocked_md = memory::desc(
+                dims, memory::data_type::f32, memory::format_tag::OIhw16i16o);
+    }
+
+    // Returns blocked weights reordered from plain ones.
+    memory make_weights() {
+        memory plain(plain_md, eng);
+        float *ptr = static_cast<float *>(plain.get_data_handle());
+        const size_t nelems = plain_md.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = (float)(i % 17) - 8.f;
+
+        memory blocked(blocked_md, eng);
+        stream strm(eng);
+        reorder(plain, blocked).execute(strm, plain, blocked);
+        strm.wait();
+        return blocked;
+    }
+
+    void check_equal(const memory &a, const memory &b) {
+        ASSERT_TRUE(a.get_desc() == b.get_desc());
+        const size_t size = a.get_desc().get_size();
+        ASSERT_EQ(memcmp(a.get_data_handle(), b.get_data_handle(), size), 0);
+    }
+
+    // Returns a buffer aligned to 64 bytes in storage.
+    static uint8_t *aligned(std::vector<uint8_t> &storage, size_t size) {
+        storage.resize(size + 64);
+        uint8_t *ptr = storage.data();
+        return ptr + (64 - reinterpret_cast<uintptr_t>(ptr) % 64) % 64;
+    }
+
+    engine eng;
+    memory::desc plain_md, blocked_md;
+};
+
+TEST_F(memory_blob_test, TestRoundTrip) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Blobs are supported on CPU engines only");
+    memory weights = make_weights();
+
+    const size_t size = weights.get_blob_size();
+    ASSERT_GE(size, blocked_md.get_size());
+    std::vector<uint8_t> storage;
+    uint8_t *blob = aligned(storage, size);
+    weights.write_blob(blob, size);
+
+    memory loaded(eng, blob, size);
+    check_equal(loaded, weights);
+    // The data is not copied.
+    const uint8_t *data
+            = static_cast<const uint8_t *>(loaded.get_data_handle());
+    ASSERT_TRUE(data >= blob && data + blocked_md.get_size() <= blob + size);
+}
+
+TEST_F(memory_blob_test, TestInvalidBlobs) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Blobs are supported on CPU engines only");
+    memory weights = make_weights();
+
+    const size_t size = weights.get_blob_size();
+    std::vector<uint8_t> storage;
+    uint8_t *blob = aligned(storage, size + 1);
+
+    EXPECT_ANY_THROW(weights.write_blob(blob, size - 1));
+
+    weights.write_blob(blob, size);
+    EXPECT_ANY_THROW(memory(eng, blob, size - 1));
+    // Buffers that hold the header but end before the data offset.
+    EXPECT_ANY_THROW(memory(eng, blob, 64));
+    EXPECT_ANY_THROW(memory(eng, blob, size - blocked_md.get_size() - 1));
+
+    memmove(blob + 1, blob, size);
+    EXPECT_ANY_THROW(memory(eng, blob + 1, size));
+
+    memmove(blob, blob + 1, size);
+    blob[0] ^= 0xff;
+    EXPECT_ANY_THROW(memory(eng, blob, size));
+}
+
+TEST_F(memory_blob_test, TestCorruptedHeader) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Blobs are supported on CPU engines only");
+    memory weights = make_weights();
+
+    const size_t size = weights.get_blob_size();
+    std::vector<uint8_t> storage;
+    uint8_t *blob = aligned(storage, size);
+    weights.write_blob(blob, size);
+
+    // The memory descriptor is stored as is in the header.
+    const dnnl_memory_desc_t &md = blocked_md.data;
+    size_t md_off = 0;
+    while (md_off + sizeof(md) <= size - blocked_md.get_size()
+            && memcmp(blob + md_off, &md, sizeof(md)) != 0)
+        md_off++;
+    ASSERT_LE(md_off + sizeof(md), size - blocked_md.get_size());
+    std::vector<uint8_t> good(blob, blob + size);
+
+    auto expect_rejected = [&](void (*corrupt)(dnnl_memory_desc_t &)) {
+        memcpy(blob, good.data(), size);
+        dnnl_memory_desc_t bad;
+        memcpy(&bad, blob + md_off, sizeof(bad));
+        corrupt(bad);
+        memcpy(blob + md_off, &bad, sizeof(bad));
+        EXPECT_ANY_THROW(memory(eng, blob, size));
+    };
+
+    expect_rejected([](dnnl_memory_desc_t &md) { md.ndims = 100; });
+    expect_rejected([](dnnl_memory_desc_t &md) { md.ndims = -1; });
+    expect_rejected([](dnnl_memory_desc_t &md) {
+        md.format_kind = dnnl_format_kind_wino;
+    });
+    expect_rejected([](dnnl_memory_desc_t &md) {
+        md.format_kind = (dnnl_format_kind_t)0x7f;
+    });
+    expect_rejected([](dnnl_memory_desc_t &md) {
+        md.format_desc.blocking.inner_nblks = 1000;
+    });
+    expect_rejected([](dnnl_memory_desc_t &md) {
+        md.format_desc.blocking.inner_idxs[0] = 50;
+    });
+    expect_rejected([](dnnl_memory_desc_t &md) { md.padded_dims[0] = 1; });
+
+    // The untouched blob is still accepted.
+    memcpy(blob, good.data(), size);
+    memory loaded(eng, blob, size);
+    check_equal(loaded, weights);
+}
+
+#if defined(__linux__)
+TEST_F(memory_blob_test, TestReadOnlyMapping) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Blobs are supported on CPU engines only");
+    memory weights = make_weights();
+
+    const size_t size = weights.get_blob_size();
+    std::vector<uint8_t> storage;
+    uint8_t *blob = aligned(storage, size);
+    weights.write_blob(blob, size);
+
+    char path[] = "/tmp/dnnl_memory_blob_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1);
+    unlink(path);
+    ASSERT_EQ(write(fd, blob, size), (ssize_t)size);
+
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(mapped, MAP_FAILED);
+    {
+        // Weights are only read by the primitives, so a read-only mapping is
+        // enough to run one.
+        memory loaded(eng, mapped, size);
+        check_equal(loaded, weights);
+
+        memory plain(plain_md, eng);
+        stream strm(eng);
+        reorder(loaded, plain).execute(strm, loaded, plain);
+        strm.wait();
+        const float *ptr = static_cast<const float *>(plain.get_data_handle());
+        const size_t nelems = plain_md.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(ptr[i], (float)(i % 17) - 8.f);
+    }
+    munmap(mapped, size);
+}
+#endif
+
+} // namespace dnnl
@@ -103,6 +103,42 @@ TEST(primitive_cache_test, TestCacheHit) {
     fill_primitive_cache(1);
     ASSERT_EQ(get_primitive_cache_size(), 1);
 }
+
+TEST(primitive_cache_test, TestStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(2);
+    set_primitive_cache_stats(1);
+    reset_primitive_cache_stats();
+
+    fill_primitive_cache(1);
+    fill_primitive_cache(1);
+    fill_primitive_cache(3);
+
+    auto stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 2u);
+    ASSERT_EQ(stats.misses, 3u);
+    ASSERT_EQ(stats.evictions, 1u);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+
+    reset_primitive_cache_stats();
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits + stats.misses + stats.evictions, 0u);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+
+    // Nothing is counted while the collection is disabled
+    set_primitive_cache_stats(0);
+    fill_primitive_cache(3);
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits + stats.misses + stats.evictions, 0u);
+    ASSERT_EQ(stats.lookup_time_ns + stats.lock_wait_time_ns, 0u);
+}
+#else
+
+TEST(primitive_cache_test, TestStats) {
+    fill_primitive_cache(1);
+    auto stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits + stats.misses + stats.evictions, 0u);
+}
 #endif
 
 } // namespace dnnl
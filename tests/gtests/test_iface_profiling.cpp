@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+class profiling_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        profiling_stop();
+        profiling_drain();
+    }
+    void TearDown() override { profiling_stop(); }
+
+    // Returns the implementation name of the primitive.
+    std::string run_relu(int n) {
+        using tag = memory::format_tag;
+        using dt = memory::data_type;
+
+        engine eng = get_test_engine();
+        stream strm(eng);
+        memory::desc md({2, 3, 4, 5}, dt::f32, tag::nchw);
+        auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, 0.f, 0.f);
+        auto relu_pd = eltwise_forward::primitive_desc(relu_d, eng);
+        auto relu = eltwise_forward(relu_pd);
+        memory src(md, eng), dst(md, eng);
+        for (int i = 0; i < n; i++)
+            relu.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+        return relu_pd.impl_info_str();
+    }
+};
+
+TEST_F(profiling_test, TestRecords) {
+    run_relu(1);
+    ASSERT_EQ(profiling_drain().size(), 0u);
+
+    profiling_start();
+    run_relu(3);
+    profiling_stop();
+    run_relu(1);
+
+    auto records = profiling_drain();
+    ASSERT_EQ(records.size(), 3u);
+    for (const auto &rec : records) {
+        ASSERT_EQ(rec.kind, dnnl_eltwise);
+        ASSERT_NE(rec.impl_name, nullptr);
+        ASSERT_NE(rec.info, nullptr);
+        ASSERT_LE(rec.start_ns, rec.end_ns);
+        ASSERT_GE(rec.nthr, 1);
+        ASSERT_LE(rec.nthr, dnnl_get_max_threads());
+        ASSERT_EQ(rec.tid, records[0].tid);
+    }
+    ASSERT_EQ(records[0].impl_name, records[2].impl_name);
+    ASSERT_LE(records[0].end_ns, records[1].start_ns);
+
+    ASSERT_EQ(profiling_drain().size(), 0u);
+}
+
+TEST_F(profiling_test, TestPartialDrain) {
+    profiling_start();
+    run_relu(3);
+    profiling_stop();
+
+    dnnl_profiling_record_t rec;
+    size_t count = 0;
+    ASSERT_EQ(dnnl_profiling_drain(&rec, 1, &count), dnnl_success);
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(profiling_drain().size(), 2u);
+
+    ASSERT_EQ(dnnl_profiling_drain(nullptr, 0, &count), dnnl_success);
+    ASSERT_EQ(count, 0u);
+    ASSERT_EQ(dnnl_profiling_drain(nullptr, 1, &count),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_profiling_drain(&rec, 1, nullptr), dnnl_invalid_arguments);
+}
+
+TEST_F(profiling_test, TestChromeTrace) {
+    profiling_start();
+    run_relu(2);
+    profiling_stop();
+    auto records = profiling_drain();
+    ASSERT_EQ(records.size(), 2u);
+
+    const std::string file_name = "test_iface_profiling_trace.json";
+    profiling_write_chrome_trace(records, file_name);
+
+    std::ifstream f(file_name);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    const std::string trace = ss.str();
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(trace.find("{\"traceEvents\":["), 0u);
+    ASSERT_NE(trace.find("\"cat\":\"eltwise\""), std::string::npos);
+    ASSERT_NE(trace.find(records[0].impl_name), std::string::npos);
+}
+
+TEST_F(profiling_test, TestPerfCounters) {
+    if (set_perf_counters(1) != status::success) return;
+    reset_perf_counters();
+    const std::string impl_name = run_relu(3);
+    set_perf_counters(0);
+    run_relu(1);
+
+    auto counters = get_perf_counters(impl_name);
+    ASSERT_EQ(counters.executions, 3u);
+    ASSERT_GT(counters.time_ns, 0u);
+    ASSERT_EQ(get_perf_counters().executions, 3u);
+    ASSERT_EQ(get_perf_counters("no such implementation").executions, 0u);
+
+    reset_perf_counters();
+    ASSERT_EQ(get_perf_counters(impl_name).executions, 0u);
+}
+
+} // namespace dnnl
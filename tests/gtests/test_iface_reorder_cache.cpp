@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "dnnl_test_macros.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+class reorder_cache_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        eng = get_test_engine();
+        const memory::dims dims = {32, 32, 3, 3};
+        plain_md = memory::desc(
+                dims, memory::data_type::f32, memory::format_tag::oihw);
+        blocked_md = memory::desc(
+                dims, memory::data_type::f32, memory::format_tag::OIhw16i16o);
+        saved_capacity = get_reorder_cache_capacity();
+        set_reorder_cache_capacity(16);
+    }
+
+    void TearDown() override { set_reorder_cache_capacity(saved_capacity); }
+
+    static void fill(const memory &m, float value) {
+        float *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t nelems = m.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = value + (float)(i % 7);
+    }
+
+    // Reorders the blocked memory back and checks it against fill().
+    void check(memory &blocked, float value) {
+        memory plain(plain_md, eng);
+        stream strm(eng);
+        reorder(blocked, plain).execute(strm, blocked, plain);
+        strm.wait();
+        const float *ptr = static_cast<const float *>(plain.get_data_handle());
+        const size_t nelems = plain_md.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(ptr[i], value + (float)(i % 7));
+    }
+
+    engine eng;
+    memory::desc plain_md, blocked_md;
+    int saved_capacity = 0;
+};
+
+TEST_F(reorder_cache_test, TestHitsAndInvalidation) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The reorder cache is supported on CPU engines only");
+    ASSERT_EQ(get_reorder_cache_capacity(), 16);
+
+    stream strm(eng);
+    memory src(plain_md, eng), dst(blocked_md, eng), dst2(blocked_md, eng);
+    auto r = reorder(src, dst);
+
+    fill(src, 1.f);
+    r.execute(strm, src, dst);
+    strm.wait();
+    check(dst, 1.f);
+
+    // A change of the data the library is not told about is not seen: the
+    // result comes from the cache.
+    fill(src, 2.f);
+    r.execute(strm, src, dst);
+    r.execute(strm, src, dst2);
+    strm.wait();
+    check(dst, 1.f);
+    check(dst2, 1.f);
+
+    // Destination changed by the user, the cached result is copied back.
+    fill(dst, 5.f);
+    dst.set_data_handle(dst.get_data_handle());
+    r.execute(strm, src, dst);
+    strm.wait();
+    check(dst, 1.f);
+
+    // Setting the handle again tells the library that the data has changed.
+    src.set_data_handle(src.get_data_handle());
+    r.execute(strm, src, dst);
+    strm.wait();
+    check(dst, 2.f);
+}
+
+TEST_F(reorder_cache_test, TestIdenticalPrimitives) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The reorder cache is supported on CPU engines only");
+    stream strm(eng);
+    memory src(plain_md, eng), dst(blocked_md, eng), dst2(blocked_md, eng);
+
+    fill(src, 3.f);
+    reorder(src, dst).execute(strm, src, dst);
+    reorder(src, dst2).execute(strm, src, dst2);
+    strm.wait();
+    check(dst, 3.f);
+    check(dst2, 3.f);
+}
+
+TEST_F(reorder_cache_test, TestSumPostOp) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The reorder cache is supported on CPU engines only");
+    stream strm(eng);
+    memory src(plain_md, eng), dst(plain_md, eng);
+
+    // The result of a reorder with a sum depends on the destination, so it
+    // must accumulate on every execution instead of coming from the cache.
+    post_ops po;
+    po.append_sum(1.f);
+    primitive_attr attr;
+    attr.set_post_ops(po);
+    auto r = reorder(reorder::primitive_desc(src, dst, attr));
+
+    fill(src, 1.f);
+    float *ptr = static_cast<float *>(dst.get_data_handle());
+    const size_t nelems = plain_md.get_size() / sizeof(float);
+    for (size_t i = 0; i < nelems; i++)
+        ptr[i] = 0.f;
+    dst.set_data_handle(dst.get_data_handle());
+
+    for (int iter = 1; iter <= 2; iter++) {
+        r.execute(strm, src, dst);
+        strm.wait();
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(ptr[i], iter * (1.f + (float)(i % 7)));
+    }
+}
+
+TEST_F(reorder_cache_test, TestDisabled) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The reorder cache is supported on CPU engines only");
+    set_reorder_cache_capacity(0);
+    ASSERT_EQ(get_reorder_cache_capacity(), 0);
+
+    stream strm(eng);
+    memory src(plain_md, eng), dst(blocked_md, eng);
+    auto r = reorder(src, dst);
+
+    fill(src, 1.f);
+    r.execute(strm, src, dst);
+    fill(src, 2.f);
+    r.execute(strm, src, dst);
+    strm.wait();
+    check(dst, 2.f);
+
+    EXPECT_ANY_THROW(set_reorder_cache_capacity(-1));
+}
+
+} // namespace dnnl
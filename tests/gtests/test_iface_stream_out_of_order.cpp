@@ -0,0 +1,259 @@
+/*******************************************************************************
+* Copyright 2020 FUJITSU LIMITED
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "dnnl_test_macros.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+class stream_out_of_order_test : public ::testing::Test {
+protected:
+    static const memory::dim n = 1024;
+
+    void SetUp() override {
+        eng = get_test_engine();
+        md = memory::desc({n}, memory::data_type::f32, memory::format_tag::a);
+    }
+
+    static bool is_supported() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
+        return get_test_engine_kind() == engine::kind::cpu;
+#else
+        return false;
+#endif
+    }
+
+    // Returns a primitive computing dst = alpha * src + beta.
+    eltwise_forward make_linear(float alpha, float beta) {
+        auto d = eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_linear, md, alpha, beta);
+        return eltwise_forward(eltwise_forward::primitive_desc(d, eng));
+    }
+
+    memory make_memory(float value) {
+        memory m(md, eng);
+        float *ptr = static_cast<float *>(m.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = value;
+        return m;
+    }
+
+    void check(const memory &m, float value) {
+        const float *ptr = static_cast<const float *>(m.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_EQ(ptr[i], value);
+    }
+
+    engine eng;
+    memory::desc md;
+};
+
+TEST_F(stream_out_of_order_test, TestDependencies) {
+    SKIP_IF(!is_supported(), "Out-of-order streams are not supported");
+    stream strm(eng, stream::flags::out_of_order);
+
+    auto twice = make_linear(2.f, 0.f);
+    auto plus_one = make_linear(1.f, 1.f);
+
+    // Two independent chains, each with in-place steps that only give the
+    // expected values if the executions are ordered within the chain.
+    memory a = make_memory(1.f), b = make_memory(0.f);
+    memory c = make_memory(3.f), d = make_memory(0.f);
+    for (int i = 0; i < 8; i++) {
+        twice.execute(strm, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}});
+        plus_one.execute(strm, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, a}});
+        plus_one.execute(strm, {{DNNL_ARG_SRC, c}, {DNNL_ARG_DST, c}});
+        twice.execute(strm, {{DNNL_ARG_SRC, c}, {DNNL_ARG_DST, d}});
+    }
+    strm.wait();
+
+    // a = 2 * a + 1 eight times starting from 1, c = c + 1 starting from 3.
+    check(a, 511.f);
+    check(b, 510.f);
+    check(c, 11.f);
+    check(d, 22.f);
+}
+
+TEST_F(stream_out_of_order_test, TestIndependentExecutions) {
+    SKIP_IF(!is_supported(), "Out-of-order streams are not supported");
+    stream strm(eng, stream::flags::out_of_order);
+
+    auto twice = make_linear(2.f, 0.f);
+    std::vector<memory> src, dst;
+    for (int i = 0; i < 16; i++) {
+        src.push_back(make_memory((float)i));
+        dst.push_back(make_memory(0.f));
+    }
+    for (int i = 0; i < 16; i++)
+        twice.execute(strm, {{DNNL_ARG_SRC, src[i]}, {DNNL_ARG_DST, dst[i]}});
+    strm.wait();
+
+    for (int i = 0; i < 16; i++)
+        check(dst[i], 2.f * i);
+}
+
+// A primitive created for all the threads runs on the threads of one
+// partition of the stream only.
+TEST_F(stream_out_of_order_test, TestPartitionTeamSize) {
+    SKIP_IF(!is_supported(), "Out-of-order streams are not supported");
+    SKIP_IF(getenv("DNNL_CPU_STREAM_PARTITIONS") != nullptr,
+            "The number of partitions is not the default one");
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    memory::desc src_md({2, 16, 28, 28}, dt::f32, tag::any);
+    memory::desc wei_md({32, 16, 3, 3}, dt::f32, tag::any);
+    memory::desc dst_md({2, 32, 28, 28}, dt::f32, tag::any);
+    auto d = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+    auto pd = convolution_forward::primitive_desc(d, eng);
+    auto conv = convolution_forward(pd);
+
+    const int n_runs = 8;
+    memory wei(pd.weights_desc(), eng);
+    std::vector<memory> src, dst;
+    for (int i = 0; i < n_runs; i++) {
+        src.push_back(memory(pd.src_desc(), eng));
+        dst.push_back(memory(pd.dst_desc(), eng));
+    }
+
+    profiling_stop();
+    profiling_drain();
+    profiling_start();
+    stream strm(eng, stream::flags::out_of_order);
+    for (int i = 0; i < n_runs; i++)
+        conv.execute(strm,
+                {{DNNL_ARG_SRC, src[i]}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst[i]}});
+    strm.wait();
+    profiling_stop();
+
+    // The two partitions split the threads as evenly as possible.
+    const int max_nthr = dnnl_get_max_threads();
+    const int partition_nthr = std::max(1, (max_nthr + 1) / 2);
+    auto records = profiling_drain();
+    ASSERT_EQ(records.size(), (size_t)n_runs);
+    for (const auto &rec : records) {
+        ASSERT_GE(rec.nthr, 1);
+        ASSERT_LE(rec.nthr, partition_nthr);
+    }
+}
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+TEST_F(stream_out_of_order_test, TestBackwardRejected) {
+    SKIP_IF(!is_supported(), "Out-of-order streams are not supported");
+    auto fwd_d = eltwise_forward::desc(prop_kind::forward_training,
+            algorithm::eltwise_relu, md, 0.f, 0.f);
+    auto fwd_pd = eltwise_forward::primitive_desc(fwd_d, eng);
+    auto bwd_d = eltwise_backward::desc(
+            algorithm::eltwise_relu, md, md, 0.f, 0.f);
+    auto bwd = eltwise_backward(
+            eltwise_backward::primitive_desc(bwd_d, eng, fwd_pd));
+
+    memory src = make_memory(1.f), diff_dst = make_memory(1.f);
+    memory diff_src = make_memory(0.f);
+    stream strm(eng, stream::flags::out_of_order);
+    EXPECT_ANY_THROW(bwd.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DIFF_DST, diff_dst},
+                    {DNNL_ARG_DIFF_SRC, diff_src}}));
+    strm.wait();
+}
+#endif
+
+// RNN uses the global scratchpad, which is thread-local and is not visible
+// on the threads of the stream.
+TEST_F(stream_out_of_order_test, TestGlobalScratchpad) {
+    SKIP_IF(!is_supported(), "Out-of-order streams are not supported");
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    const memory::dim T = 3, N = 2, C = 16, L = 1, D = 1, G = 1;
+    memory::desc src_md({T, N, C}, dt::f32, tag::tnc);
+    memory::desc wei_md({L, D, C, G, C}, dt::f32, tag::any);
+    memory::desc bia_md({L, D, G, C}, dt::f32, tag::ldgo);
+    auto d = vanilla_rnn_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_tanh, rnn_direction::unidirectional_left2right,
+            src_md, memory::desc(), wei_md, wei_md, bia_md, src_md,
+            memory::desc());
+    auto pd = vanilla_rnn_forward::primitive_desc(d, eng);
+    auto rnn = vanilla_rnn_forward(pd);
+
+    auto make_filled = [&](const memory::desc &md, float scale) {
+        memory m(md, eng);
+        float *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t nelems = md.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = scale * (float)((i * 7) % 13 - 6);
+        return m;
+    };
+
+    stream in_order_strm(eng);
+    memory::desc user_wei_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+    memory user_wei = make_filled(user_wei_md, 0.01f);
+    memory wei_layer(pd.weights_layer_desc(), eng);
+    memory wei_iter(pd.weights_iter_desc(), eng);
+    reorder(user_wei, wei_layer).execute(in_order_strm, user_wei, wei_layer);
+    reorder(user_wei, wei_iter).execute(in_order_strm, user_wei, wei_iter);
+    in_order_strm.wait();
+    memory bias = make_filled(bia_md, 0.1f);
+
+    const int n_runs = 4;
+    std::vector<memory> src, dst, dst_ref;
+    for (int i = 0; i < n_runs; i++) {
+        src.push_back(make_filled(src_md, 0.1f * (i + 1)));
+        dst.push_back(memory(src_md, eng));
+        dst_ref.push_back(memory(src_md, eng));
+    }
+
+    auto args = [&](const memory &s, const memory &dd) {
+        std::unordered_map<int, memory> a;
+        a[DNNL_ARG_SRC_LAYER] = s;
+        a[DNNL_ARG_WEIGHTS_LAYER] = wei_layer;
+        a[DNNL_ARG_WEIGHTS_ITER] = wei_iter;
+        a[DNNL_ARG_BIAS] = bias;
+        a[DNNL_ARG_DST_LAYER] = dd;
+        return a;
+    };
+
+    for (int i = 0; i < n_runs; i++)
+        rnn.execute(in_order_strm, args(src[i], dst_ref[i]));
+    in_order_strm.wait();
+
+    stream strm(eng, stream::flags::out_of_order);
+    for (int i = 0; i < n_runs; i++)
+        rnn.execute(strm, args(src[i], dst[i]));
+    strm.wait();
+
+    for (int i = 0; i < n_runs; i++) {
+        const float *ptr = static_cast<const float *>(dst[i].get_data_handle());
+        const float *ref
+                = static_cast<const float *>(dst_ref[i].get_data_handle());
+        for (memory::dim j = 0; j < T * N * C; j++)
+            ASSERT_NEAR(ptr[j], ref[j], 1e-6f);
+    }
+}
+
+} // namespace dnnl
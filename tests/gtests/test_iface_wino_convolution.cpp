@@ -54,7 +54,10 @@ protected:
         input_int8.wino_supported = get_test_engine_kind() == engine::kind::cpu
                 && impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core);
         input_f32.backward_supported = impl::dnnl_thr_syncable();
-
+#elif DNNL_AARCH64
+        input_f32.wino_supported = get_test_engine_kind() == engine::kind::cpu;
+        input_int8.wino_supported = false;
+        input_f32.backward_supported = true;
 #else
         input_f32.wino_supported = false;
         input_int8.wino_supported = false;